@@ -8,10 +8,13 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <glm/glm.hpp>
+#include <cstdint>
 
 namespace Cesium
 {
     class Interpolator;
+    class GeoReferenceInterpolator;
+    class DestinationPrefetch;
 
     class GeoReferenceCameraFlyController
         : public AZ::Component
@@ -61,6 +64,18 @@ namespace Cesium
 
         void BindCameraStopFlyEventHandler(CameraStopFlyEvent::Handler& handler) override;
 
+        void SetPrefetchDestination(bool prefetchDestination) override;
+
+        bool GetPrefetchDestination() const override;
+
+        void SetPrefetchWaypointCount(std::uint32_t waypointCount) override;
+
+        std::uint32_t GetPrefetchWaypointCount() const override;
+
+        bool IsDestinationReady() const override;
+
+        void BindCameraDestinationReadyEventHandler(CameraDestinationReadyEvent::Handler& handler) override;
+
         void Init() override;
 
         void Activate() override;
@@ -89,13 +104,22 @@ namespace Cesium
         void FlyToECEFLocationImpl(
             const glm::dvec3& location, const glm::dvec3& direction, const float* duration = nullptr, const double* flyHeight = nullptr);
 
+        void StartDestinationPrefetch(const glm::dvec3& destination, const GeoReferenceInterpolator& interpolator);
+
+        void UpdateDestinationPrefetch();
+
+        void StopDestinationPrefetch();
+
         // configurations for controller
         double m_mouseSensitivity;
         double m_movementSpeed;
         double m_panningSpeed;
+        bool m_prefetchDestination;
+        std::uint32_t m_prefetchWaypointCount;
 
         AZStd::unique_ptr<Interpolator> m_ecefPositionInterpolator;
         CameraStopFlyEvent m_stopFlyEvent;
+        AZStd::unique_ptr<DestinationPrefetch> m_destinationPrefetch;
         CameraFlyState m_cameraFlyState;
         double m_cameraPitch;
         double m_cameraHead;
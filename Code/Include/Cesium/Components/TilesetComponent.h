@@ -57,6 +57,30 @@ namespace Cesium
 
         void BindTilesetLoadedHandler(TilesetLoadedEvent::Handler& handler) override;
 
+        TilesetLoadPipelineMetrics GetLoadPipelineMetrics() const override;
+
+        TilesetMemoryUsage GetMemoryUsage() const override;
+
+        TilesetStreamingStatistics GetStreamingStatistics() const override;
+
+        TilesetRollingStreamingStatistics GetRollingStreamingStatistics() const override;
+
+        void ResetStreamingStatistics() override;
+
+        double GetEffectiveScreenSpaceError() const override;
+
+        bool SaveStartupSnapshot() override;
+
+        float GetTimeToFirstFullDetail() const override;
+
+        std::uint32_t GetEffectiveSimultaneousTileLoads() const override;
+
+        void SetDebugConfiguration(const TilesetDebugConfiguration& debugConfiguration) override;
+
+        const TilesetDebugConfiguration& GetDebugConfiguration() const override;
+
+        AZStd::vector<TilesetDebugTileInfo> GetDebugTileInfos() const override;
+
         void Init() override;
 
         void Activate() override;
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace Cesium
+{
+    enum class CameraBookmarkState
+    {
+        // the tiles of the bookmark are not loaded in the background
+        Cold,
+
+        // the tilesets are loading the tiles of the bookmark
+        Preloading,
+
+        // every tileset rendered the bookmark at full detail last frame
+        Ready,
+
+        // the tiles of the bookmark need more than its memory budget, so they are not kept anymore
+        OverBudget
+    };
+
+    struct CameraBookmarkStatus final
+    {
+        AZ_RTTI(CameraBookmarkStatus, "{2C7E5B81-4F0A-4D96-B3E8-95A1D6C04F27}");
+        AZ_CLASS_ALLOCATOR(CameraBookmarkStatus, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        CameraBookmarkStatus();
+
+        CameraBookmarkState m_state;
+
+        // bytes of the tiles rendered by all the tilesets for the bookmark last frame
+        std::uint64_t m_loadedBytes;
+
+        std::uint64_t m_memoryBudgetBytes;
+
+        bool m_keepWarm;
+    };
+
+    class CameraBookmarkRequest : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        // Add or replace the bookmark with the camera pose in ECEF. A warm bookmark keeps its tiles loaded in the background until
+        // they need more than memoryBudgetBytes. Zero does not limit the bytes
+        virtual void AddCameraBookmark(
+            const AZStd::string& name,
+            const glm::dvec3& ecefPosition,
+            const glm::dvec3& ecefDirection,
+            const glm::dvec3& ecefUp,
+            std::uint64_t memoryBudgetBytes,
+            bool keepWarm) = 0;
+
+        // add or replace the bookmark with the current pose of the camera entity
+        virtual bool AddCameraBookmarkFromCamera(
+            const AZStd::string& name, AZ::EntityId cameraEntityId, std::uint64_t memoryBudgetBytes, bool keepWarm) = 0;
+
+        virtual bool RemoveCameraBookmark(const AZStd::string& name) = 0;
+
+        virtual AZStd::vector<AZStd::string> GetCameraBookmarkNames() const = 0;
+
+        // start loading the tiles of the bookmark. OnCameraBookmarkReady is signalled when every tileset rendered it at full detail
+        virtual bool PreloadCameraBookmark(const AZStd::string& name) = 0;
+
+        // stop loading the tiles of a bookmark that is not kept warm
+        virtual bool ReleaseCameraBookmark(const AZStd::string& name) = 0;
+
+        virtual bool IsCameraBookmarkReady(const AZStd::string& name) const = 0;
+
+        virtual CameraBookmarkStatus GetCameraBookmarkStatus(const AZStd::string& name) const = 0;
+
+        // move the camera entity to the bookmark. A bookmark that is not kept warm is released, since the camera now loads its tiles
+        virtual bool JumpToCameraBookmark(const AZStd::string& name, AZ::EntityId cameraEntityId) = 0;
+    };
+
+    using CameraBookmarkRequestBus = AZ::EBus<CameraBookmarkRequest>;
+
+    class CameraBookmarkNotification : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        virtual void OnCameraBookmarkReady(const AZStd::string& name) = 0;
+    };
+
+    using CameraBookmarkNotificationBus = AZ::EBus<CameraBookmarkNotification>;
+
+    class CameraBookmarkNotificationEBusHandler
+        : public CameraBookmarkNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        static void Reflect(AZ::ReflectContext* reflectContext);
+
+        AZ_EBUS_BEHAVIOR_BINDER(
+            CameraBookmarkNotificationEBusHandler, "{8A4D2F19-C6B3-4E70-9D15-3B7E0A6F82C4}", AZ::SystemAllocator, OnCameraBookmarkReady);
+
+        void OnCameraBookmarkReady(const AZStd::string& name) override;
+    };
+} // namespace Cesium
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE(Cesium::CameraBookmarkState, "{E53A9C70-1B8D-4F26-A7C4-6D02B9E1F385}");
+}
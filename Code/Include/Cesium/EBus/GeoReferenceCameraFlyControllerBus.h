@@ -4,6 +4,7 @@
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/EBus/Event.h>
 #include <glm/glm.hpp>
+#include <cstdint>
 
 namespace Cesium
 {
@@ -43,6 +44,8 @@ namespace Cesium
 
     using CameraStopFlyEvent = AZ::Event<const glm::dvec3&>;
 
+    using CameraDestinationReadyEvent = AZ::Event<const glm::dvec3&>;
+
     class GeoReferenceCameraFlyControllerRequest : public AZ::ComponentBus
     {
     public:
@@ -68,6 +71,20 @@ namespace Cesium
             const glm::dvec3& location, const glm::dvec3& direction, const GeoreferenceCameraFlyConfiguration& config) = 0;
 
         virtual void BindCameraStopFlyEventHandler(CameraStopFlyEvent::Handler& handler) = 0;
+
+        // load the tiles of the destination as soon as a fly starts, and of evenly spaced waypoints of the fly path
+        virtual void SetPrefetchDestination(bool prefetchDestination) = 0;
+
+        virtual bool GetPrefetchDestination() const = 0;
+
+        virtual void SetPrefetchWaypointCount(std::uint32_t waypointCount) = 0;
+
+        virtual std::uint32_t GetPrefetchWaypointCount() const = 0;
+
+        // true when all the tilesets rendered the destination of the last fly at full detail
+        virtual bool IsDestinationReady() const = 0;
+
+        virtual void BindCameraDestinationReadyEventHandler(CameraDestinationReadyEvent::Handler& handler) = 0;
     };
 
     using GeoReferenceCameraFlyControllerRequestBus = AZ::EBus<GeoReferenceCameraFlyControllerRequest>;
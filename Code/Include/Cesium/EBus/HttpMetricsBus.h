@@ -0,0 +1,110 @@
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Histogram with power of two buckets. Bucket 0 counts zero values and bucket i counts values in [2^(i-1), 2^i), so times in
+    // microseconds and sizes in bytes both fit without configuration. The last bucket also counts everything above it.
+    struct HttpHistogram final
+    {
+        AZ_RTTI(HttpHistogram, "{4C1E7A93-2B5D-4F08-9E61-D3A8B7C0F215}");
+        AZ_CLASS_ALLOCATOR(HttpHistogram, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        HttpHistogram();
+
+        void Add(std::uint64_t value);
+
+        double GetMean() const;
+
+        // return the upper bound of the bucket that contains the percentile, clamped to the maximum value. Percentile is in [0, 1]
+        std::uint64_t GetPercentile(double percentile) const;
+
+        static constexpr std::size_t BUCKET_COUNT = 40;
+
+        AZStd::vector<std::uint64_t> m_buckets;
+        std::uint64_t m_count;
+        std::uint64_t m_sum;
+        std::uint64_t m_max;
+    };
+
+    struct HttpHostMetrics final
+    {
+        AZ_RTTI(HttpHostMetrics, "{9B3F0D72-6E14-4A5C-8D27-1F5E9C4B6A80}");
+        AZ_CLASS_ALLOCATOR(HttpHostMetrics, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        HttpHostMetrics();
+
+        AZStd::string m_host;
+
+        // in microseconds
+        HttpHistogram m_queueWait;
+        HttpHistogram m_timeToFirstByte;
+        HttpHistogram m_latency;
+
+        // response body bytes received over the network
+        HttpHistogram m_bytes;
+
+        std::uint64_t m_requestCount;
+        std::uint64_t m_informationalResponses;
+        std::uint64_t m_successfulResponses;
+        std::uint64_t m_redirectResponses;
+        std::uint64_t m_clientErrorResponses;
+        std::uint64_t m_serverErrorResponses;
+
+        // requests that did not receive any response
+        std::uint64_t m_failedRequests;
+
+        // gzip bodies before and after decoding
+        std::uint64_t m_compressedBytes;
+        std::uint64_t m_decompressedBytes;
+
+        std::uint32_t m_activeRequests;
+        std::uint32_t m_peakActiveRequests;
+    };
+
+    struct HttpMetricsSnapshot final
+    {
+        AZ_RTTI(HttpMetricsSnapshot, "{E06A5C38-7F91-4B2D-A4C3-5D8B2E1F9076}");
+        AZ_CLASS_ALLOCATOR(HttpMetricsSnapshot, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        HttpMetricsSnapshot();
+
+        AZStd::vector<HttpHostMetrics> m_hosts;
+
+        // requests waiting for a thread of the HTTP job pool
+        std::uint32_t m_queuedRequests;
+        std::uint32_t m_activeRequests;
+        std::uint32_t m_peakQueuedRequests;
+        std::uint32_t m_peakActiveRequests;
+    };
+
+    class HttpMetricsRequest : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        virtual HttpMetricsSnapshot GetHttpMetrics() const = 0;
+
+        // clear the histograms and counters. Requests in flight are still counted
+        virtual void ResetHttpMetrics() = 0;
+    };
+
+    using HttpMetricsRequestBus = AZ::EBus<HttpMetricsRequest>;
+} // namespace Cesium
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <cstdint>
+
+namespace Cesium
+{
+    struct LoadSlotStatus final
+    {
+        AZ_RTTI(LoadSlotStatus, "{8E41C2A7-3B6D-4F95-A0C8-5D17E9B34F62}");
+        AZ_CLASS_ALLOCATOR(LoadSlotStatus, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        LoadSlotStatus();
+
+        std::uint32_t m_globalLoadSlots;
+
+        std::uint32_t m_minimumLoadSlots;
+
+        // loads the tilesets asked for in the last frame, bounded by their own simultaneous tile loads
+        std::uint32_t m_requestedLoadSlots;
+
+        // sum of the loads given to the tilesets. It exceeds the global load slots only when there are more tilesets than slots
+        std::uint32_t m_allocatedLoadSlots;
+
+        std::uint32_t m_consumerCount;
+
+        // tilesets given less loads than they asked for
+        std::uint32_t m_throttledConsumerCount;
+    };
+
+    class LoadSlotRequest : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        // the simultaneous tile loads shared by all the tilesets and their raster overlays. Zero lets each tileset use its own
+        virtual void SetGlobalLoadSlots(std::uint32_t loadSlots) = 0;
+
+        virtual std::uint32_t GetGlobalLoadSlots() const = 0;
+
+        // the loads every tileset keeps whatever its screen coverage, as long as the global load slots allow it
+        virtual void SetMinimumLoadSlots(std::uint32_t loadSlots) = 0;
+
+        virtual std::uint32_t GetMinimumLoadSlots() const = 0;
+
+        virtual LoadSlotStatus GetLoadSlotStatus() const = 0;
+    };
+
+    using LoadSlotRequestBus = AZ::EBus<LoadSlotRequest>;
+} // namespace Cesium
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <cstdint>
+
+namespace Cesium
+{
+    enum class MemoryPressure
+    {
+        // the tilesets use less than 75% of the budget
+        Normal,
+
+        // the tilesets use most of the budget, so their caches are trimmed to their share
+        High,
+
+        // the tilesets use more than the budget, which happens when the tiles rendered this frame do not fit in it
+        Critical
+    };
+
+    struct MemoryBudgetStatus final
+    {
+        AZ_RTTI(MemoryBudgetStatus, "{6B0E3D52-97A4-4C1F-8E25-B1D7F4A0C963}");
+        AZ_CLASS_ALLOCATOR(MemoryBudgetStatus, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        MemoryBudgetStatus();
+
+        std::uint64_t m_budgetBytes;
+
+        // cached bytes reported by the tilesets in the last frame, including their raster overlays
+        std::uint64_t m_usedBytes;
+
+        // sum of the cache sizes given to the tilesets
+        std::uint64_t m_allocatedBytes;
+
+        std::uint32_t m_consumerCount;
+
+        // tilesets that use more than their share and evict their least recently used tiles
+        std::uint32_t m_evictingConsumerCount;
+
+        MemoryPressure m_pressure;
+    };
+
+    class MemoryBudgetRequest : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        // the bytes shared by all the tilesets and raster overlays
+        virtual void SetMemoryBudget(std::uint64_t budgetBytes) = 0;
+
+        virtual std::uint64_t GetMemoryBudget() const = 0;
+
+        virtual MemoryBudgetStatus GetMemoryBudgetStatus() const = 0;
+    };
+
+    using MemoryBudgetRequestBus = AZ::EBus<MemoryBudgetRequest>;
+
+    class MemoryBudgetNotification : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        virtual void OnMemoryPressureChanged(const MemoryBudgetStatus& status) = 0;
+    };
+
+    using MemoryBudgetNotificationBus = AZ::EBus<MemoryBudgetNotification>;
+
+    class MemoryBudgetNotificationEBusHandler
+        : public MemoryBudgetNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        static void Reflect(AZ::ReflectContext* reflectContext);
+
+        AZ_EBUS_BEHAVIOR_BINDER(
+            MemoryBudgetNotificationEBusHandler, "{D84A1F67-2C5B-4E93-A0B8-7F3E6C1D59A2}", AZ::SystemAllocator, OnMemoryPressureChanged);
+
+        void OnMemoryPressureChanged(const MemoryBudgetStatus& status) override;
+    };
+} // namespace Cesium
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE(Cesium::MemoryPressure, "{3F9C6A18-5D2E-4B07-9A41-C8E0B7D2F615}");
+}
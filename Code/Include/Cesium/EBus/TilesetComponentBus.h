@@ -4,6 +4,8 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/utils.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -26,6 +28,24 @@ namespace Cesium
             , m_preloadAncestors{ true }
             , m_preloadSiblings{ true }
             , m_forbidHole{ false }
+            , m_maximumPreparedTiles{ 64 }
+            , m_maximumPreparedBytes{ 256 * 1024 * 1024 }
+            , m_adaptiveScreenSpaceError{ false }
+            , m_minimumAdaptiveScreenSpaceError{ 4.0 }
+            , m_maximumAdaptiveScreenSpaceError{ 64.0 }
+            , m_targetFrameTime{ 16.6f }
+            , m_mainThreadBudget{ 4.0f }
+            , m_cacheTrimGracePeriod{ 10.0f }
+            , m_cacheTrimDuration{ 5.0f }
+            , m_predictivePrefetch{ false }
+            , m_prefetchLookAhead{ 1.0f }
+            , m_maximumPrefetchBytes{ 64 * 1024 * 1024 }
+            , m_adaptiveTileLoads{ false }
+            , m_minimumAdaptiveTileLoads{ 4 }
+            , m_maximumAdaptiveTileLoads{ 100 }
+            , m_horizonCulling{ false }
+            , m_occlusionCulling{ false }
+            , m_shareOccluders{ false }
         {
         }
 
@@ -36,6 +56,43 @@ namespace Cesium
         bool m_preloadAncestors;
         bool m_preloadSiblings;
         bool m_forbidHole;
+        std::uint32_t m_maximumPreparedTiles;
+        std::uint64_t m_maximumPreparedBytes;
+
+        // adjust the screen space error between the adaptive bounds, starting from the maximum screen space error. The frame time
+        // target and the main thread budget spent on the tileset are in milliseconds
+        bool m_adaptiveScreenSpaceError;
+        double m_minimumAdaptiveScreenSpaceError;
+        double m_maximumAdaptiveScreenSpaceError;
+        float m_targetFrameTime;
+        float m_mainThreadBudget;
+
+        // in seconds. The cache of a tileset that is off screen is kept during the grace period, then emptied over the trim duration
+        float m_cacheTrimGracePeriod;
+        float m_cacheTrimDuration;
+
+        // also select the tiles where the moving cameras will be after the look ahead, in seconds. The tiles loaded only for the
+        // predicted views are capped by the maximum prefetch bytes
+        bool m_predictivePrefetch;
+        float m_prefetchLookAhead;
+        std::uint64_t m_maximumPrefetchBytes;
+
+        // adjust the simultaneous tile loads between the adaptive bounds to the latency and the throughput of the responses,
+        // starting from the maximum simultaneous tile loads. The raster overlays of the tileset follow in proportion
+        bool m_adaptiveTileLoads;
+        std::uint32_t m_minimumAdaptiveTileLoads;
+        std::uint32_t m_maximumAdaptiveTileLoads;
+
+        // hide the selected tiles that are behind the horizon or behind the ground of the loaded region tiles. Cesium native has no
+        // tile occlusion proxy in the pinned version, so the hidden tiles are still selected and refined. Instead the simultaneous
+        // tile loads of the tileset and its share of the load slots and of the memory budget shrink with its culled tiles. Both
+        // assume the tileset is in earth centered, earth fixed coordinates and that the ground is drawn, like by a terrain tileset
+        bool m_horizonCulling;
+        bool m_occlusionCulling;
+
+        // the ground below the loaded region tiles also hides the tiles of the tilesets with occlusion culling, like a terrain
+        // tileset hiding the buildings behind a hill
+        bool m_shareOccluders;
     };
 
     struct TilesetRenderConfiguration final
@@ -47,10 +104,243 @@ namespace Cesium
 
         TilesetRenderConfiguration()
             : m_generateMissingNormalAsSmooth{ true }
+            , m_startupSnapshot{ false }
+            , m_maximumSnapshotBytes{ 256 * 1024 * 1024 }
+            , m_rayTracingEnabled{ false }
         {
         }
 
+        // the normals are generated when the tile contents are decoded, so changing it loads the tileset again
         bool m_generateMissingNormalAsSmooth;
+
+        // restore the tileset json and the tiles that were visible when the tileset was last unloaded, before requesting them.
+        // Cesium ion tilesets are not restored, since their endpoint hands out short-lived tokens. Changing it loads the tileset again
+        bool m_startupSnapshot;
+
+        // the tile contents kept for the snapshot. The tileset json and the subtrees are always kept
+        std::uint64_t m_maximumSnapshotBytes;
+
+        // applied to the tiles already loaded, like the maximum snapshot bytes
+        bool m_rayTracingEnabled;
+    };
+
+    struct TilesetLoadPipelineMetrics final
+    {
+        AZ_RTTI(TilesetLoadPipelineMetrics, "{6B0C5E1D-5A43-4E0B-9B8F-0F8A9E3C2D71}");
+        AZ_CLASS_ALLOCATOR(TilesetLoadPipelineMetrics, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        TilesetLoadPipelineMetrics()
+            : m_pipelineDepth{ 0 }
+            , m_bytesInFlight{ 0 }
+            , m_peakPipelineDepth{ 0 }
+            , m_peakBytesInFlight{ 0 }
+            , m_throttledLoads{ 0 }
+            , m_strandedTiles{ 0 }
+        {
+        }
+
+        std::uint32_t m_pipelineDepth;
+        std::uint64_t m_bytesInFlight;
+        std::uint32_t m_peakPipelineDepth;
+        std::uint64_t m_peakBytesInFlight;
+
+        // times the tileset started fewer loads because the pipeline was full
+        std::uint64_t m_throttledLoads;
+
+        // prepared tiles the traversal stopped visiting. They wait for the cache to free them and don't hold back new loads
+        std::uint32_t m_strandedTiles;
+    };
+
+    struct TilesetMemoryUsage final
+    {
+        AZ_RTTI(TilesetMemoryUsage, "{2E7C4B19-8D3A-4F6E-B5C2-7A1D9E0F3B84}");
+        AZ_CLASS_ALLOCATOR(TilesetMemoryUsage, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        TilesetMemoryUsage()
+            : m_decodedTileBytes{ 0 }
+            , m_peakDecodedTileBytes{ 0 }
+            , m_builtAssetBytes{ 0 }
+            , m_peakBuiltAssetBytes{ 0 }
+            , m_rasterImageBytes{ 0 }
+            , m_peakRasterImageBytes{ 0 }
+            , m_totalBytes{ 0 }
+            , m_peakTotalBytes{ 0 }
+        {
+        }
+
+        std::uint64_t m_decodedTileBytes;
+        std::uint64_t m_peakDecodedTileBytes;
+        std::uint64_t m_builtAssetBytes;
+        std::uint64_t m_peakBuiltAssetBytes;
+        std::uint64_t m_rasterImageBytes;
+        std::uint64_t m_peakRasterImageBytes;
+        std::uint64_t m_totalBytes;
+        std::uint64_t m_peakTotalBytes;
+    };
+
+    struct TilesetStreamingStatistics final
+    {
+        AZ_RTTI(TilesetStreamingStatistics, "{5A8E1C74-0B39-4D2F-96E8-3C7B1F4A2D95}");
+        AZ_CLASS_ALLOCATOR(TilesetStreamingStatistics, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        TilesetStreamingStatistics()
+            : m_tilesRendered{ 0 }
+            , m_tilesVisited{ 0 }
+            , m_culledTilesVisited{ 0 }
+            , m_tilesCulled{ 0 }
+            , m_maxDepthVisited{ 0 }
+            , m_tilesLoadingLowPriority{ 0 }
+            , m_tilesLoadingMediumPriority{ 0 }
+            , m_tilesLoadingHighPriority{ 0 }
+            , m_mainThreadQueueLength{ 0 }
+            , m_visibilityToggles{ 0 }
+            , m_bytesCached{ 0 }
+            , m_tilesPrefetched{ 0 }
+            , m_bytesPrefetched{ 0 }
+            , m_tilesHorizonCulled{ 0 }
+            , m_tilesOcclusionCulled{ 0 }
+            , m_occlusionCullingTime{ 0.0f }
+            , m_updateViewTime{ 0.0f }
+            , m_updateViewSkipped{ false }
+        {
+        }
+
+        std::uint32_t m_tilesRendered;
+        std::uint32_t m_tilesVisited;
+        std::uint32_t m_culledTilesVisited;
+        std::uint32_t m_tilesCulled;
+        std::uint32_t m_maxDepthVisited;
+
+        // tiles waiting for the worker threads, per load priority
+        std::uint32_t m_tilesLoadingLowPriority;
+        std::uint32_t m_tilesLoadingMediumPriority;
+        std::uint32_t m_tilesLoadingHighPriority;
+
+        // tiles prepared in the load threads that wait for the main thread
+        std::uint32_t m_mainThreadQueueLength;
+
+        // tiles that are shown or hidden this frame
+        std::uint32_t m_visibilityToggles;
+
+        std::uint64_t m_bytesCached;
+
+        // tiles selected for the predicted camera positions only
+        std::uint32_t m_tilesPrefetched;
+        std::uint64_t m_bytesPrefetched;
+
+        // selected tiles hidden by the horizon and the occlusion culling. They are not counted as rendered
+        std::uint32_t m_tilesHorizonCulled;
+        std::uint32_t m_tilesOcclusionCulled;
+
+        // in milliseconds
+        float m_occlusionCullingTime;
+        float m_updateViewTime;
+
+        // the cameras did not move and no tile was loading, so the previous frame selection was kept
+        bool m_updateViewSkipped;
+    };
+
+    // Statistics averaged over the last frames. Visibility toggles are summed instead
+    struct TilesetRollingStreamingStatistics final
+    {
+        AZ_RTTI(TilesetRollingStreamingStatistics, "{C3F79B02-4E6D-4A81-B5D0-8E2A7C9F1B36}");
+        AZ_CLASS_ALLOCATOR(TilesetRollingStreamingStatistics, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        TilesetRollingStreamingStatistics()
+            : m_frameCount{ 0 }
+            , m_averageTilesRendered{ 0.0f }
+            , m_averageTilesVisited{ 0.0f }
+            , m_averageTilesCulled{ 0.0f }
+            , m_averageTilesOcclusionCulled{ 0.0f }
+            , m_averageTilesLoading{ 0.0f }
+            , m_averageMainThreadQueueLength{ 0.0f }
+            , m_averageBytesCached{ 0.0 }
+            , m_averageUpdateViewTime{ 0.0f }
+            , m_maxUpdateViewTime{ 0.0f }
+            , m_totalVisibilityToggles{ 0 }
+            , m_skippedUpdateViews{ 0 }
+        {
+        }
+
+        std::uint32_t m_frameCount;
+        float m_averageTilesRendered;
+        float m_averageTilesVisited;
+        float m_averageTilesCulled;
+
+        // the horizon and the occlusion culling together
+        float m_averageTilesOcclusionCulled;
+        float m_averageTilesLoading;
+        float m_averageMainThreadQueueLength;
+        double m_averageBytesCached;
+        float m_averageUpdateViewTime;
+        float m_maxUpdateViewTime;
+        std::uint64_t m_totalVisibilityToggles;
+        std::uint32_t m_skippedUpdateViews;
+    };
+
+    enum class TilesetDebugDrawMode
+    {
+        None,
+        LoadLatency,
+        Depth
+    };
+
+    struct TilesetDebugConfiguration final
+    {
+        AZ_RTTI(TilesetDebugConfiguration, "{8D4F2A61-3C7E-4B95-A0D8-6E1F5B9C7A23}");
+        AZ_CLASS_ALLOCATOR(TilesetDebugConfiguration, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        TilesetDebugConfiguration()
+            : m_collectTileInfo{ false }
+            , m_drawMode{ TilesetDebugDrawMode::None }
+            , m_maximumLoadLatency{ 2000.0f }
+        {
+        }
+
+        // collect the debug info of the rendered tiles every frame. Drawing collects them as well
+        bool m_collectTileInfo;
+        TilesetDebugDrawMode m_drawMode;
+
+        // in milliseconds. Tiles that took this long or longer to load are drawn in red
+        float m_maximumLoadLatency;
+    };
+
+    struct TilesetDebugTileInfo final
+    {
+        AZ_RTTI(TilesetDebugTileInfo, "{E29B7C05-41D6-4F8A-9C3B-D58A0F6E1B47}");
+        AZ_CLASS_ALLOCATOR(TilesetDebugTileInfo, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        TilesetDebugTileInfo()
+            : m_worldBounds{ AZ::Aabb::CreateNull() }
+            , m_geometricError{ 0.0 }
+            , m_screenSpaceError{ 0.0 }
+            , m_depth{ 0 }
+            , m_loadLatency{ -1.0f }
+        {
+        }
+
+        AZ::Aabb m_worldBounds;
+        double m_geometricError;
+
+        // the largest screen space error over all the cameras
+        double m_screenSpaceError;
+        std::uint32_t m_depth;
+
+        // in milliseconds, from the first frame the tile is seen loading until it is ready to render. It is negative when
+        // the load started before the debug info was collected
+        float m_loadLatency;
     };
 
     struct TilesetLocalFileSource final
@@ -165,6 +455,36 @@ namespace Cesium
         virtual void ApplyTransformToRoot(const glm::dmat4& transform) = 0;
 
         virtual void BindTilesetLoadedHandler(TilesetLoadedEvent::Handler& handler) = 0;
+
+        virtual TilesetLoadPipelineMetrics GetLoadPipelineMetrics() const = 0;
+
+        virtual TilesetMemoryUsage GetMemoryUsage() const = 0;
+
+        virtual TilesetStreamingStatistics GetStreamingStatistics() const = 0;
+
+        virtual TilesetRollingStreamingStatistics GetRollingStreamingStatistics() const = 0;
+
+        virtual void ResetStreamingStatistics() = 0;
+
+        // the screen space error used for the last frame. It differs from the configured one when it is adaptive
+        virtual double GetEffectiveScreenSpaceError() const = 0;
+
+        // write the startup snapshot now, instead of waiting for the tileset to be unloaded. The snapshot is written in the
+        // background, or right away in deterministic mode, so it returns false only when the tileset has no snapshot to write
+        virtual bool SaveStartupSnapshot() = 0;
+
+        // seconds from the start of the load to the first frame without pending loads, negative until then
+        virtual float GetTimeToFirstFullDetail() const = 0;
+
+        // the simultaneous tile loads used for the last frame. It differs from the configured one when it is adaptive, or when the
+        // global load slots give the tileset less
+        virtual std::uint32_t GetEffectiveSimultaneousTileLoads() const = 0;
+
+        virtual void SetDebugConfiguration(const TilesetDebugConfiguration& debugConfiguration) = 0;
+
+        virtual const TilesetDebugConfiguration& GetDebugConfiguration() const = 0;
+
+        virtual AZStd::vector<TilesetDebugTileInfo> GetDebugTileInfos() const = 0;
     };
 
     using TilesetRequestBus = AZ::EBus<TilesetRequest>;
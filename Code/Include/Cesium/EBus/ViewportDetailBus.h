@@ -0,0 +1,72 @@
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzFramework/Viewport/ViewportId.h>
+#include <glm/glm.hpp>
+
+namespace Cesium
+{
+    // Level of detail of the tilesets in one viewport. The screen space error of the tilesets is multiplied for the viewport, so
+    // a small preview or a secondary viewport loads coarser tiles than the main one
+    struct ViewportDetailConfiguration final
+    {
+        AZ_RTTI(ViewportDetailConfiguration, "{6F3D8A25-C194-4E7B-B0D2-8A51E7C36F49}");
+        AZ_CLASS_ALLOCATOR(ViewportDetailConfiguration, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        ViewportDetailConfiguration();
+
+        // the viewport loads and refines the tilesets. A disabled viewport still renders them, with the tiles of the others
+        bool m_enabled;
+
+        // multiplies the maximum screen space error of the tilesets in the viewport. Values above 1 load less detail
+        double m_screenSpaceErrorMultiplier;
+
+        // weight of the viewport coverage when the memory budget and the load slots are shared between the tilesets. Zero treats
+        // the tilesets as if they were not on screen
+        double m_priority;
+
+        // relax the screen space error away from the gaze point
+        bool m_foveated;
+
+        // in normalized device coordinates in [-1, 1]. The center of the viewport by default
+        glm::dvec2 m_gazePoint;
+
+        // radius of the area around the gaze point kept at full detail, as a fraction of the half viewport
+        double m_fovealRadius;
+
+        // multiplies the screen space error at the edges of a foveated viewport. It's reached in steps, so the detail does not
+        // drop abruptly out of the foveal area
+        double m_peripheralScreenSpaceErrorMultiplier;
+    };
+
+    class ViewportDetailRequest : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        virtual void SetViewportDetail(AzFramework::ViewportId viewportId, const ViewportDetailConfiguration& configuration) = 0;
+
+        // the default configuration when none was set for the viewport
+        virtual ViewportDetailConfiguration GetViewportDetail(AzFramework::ViewportId viewportId) const = 0;
+
+        virtual void ClearViewportDetail(AzFramework::ViewportId viewportId) = 0;
+
+        // move the gaze point of a foveated viewport, like from an eye tracker every frame
+        virtual void SetViewportGazePoint(AzFramework::ViewportId viewportId, const glm::dvec2& gazePoint) = 0;
+
+        // keep the viewport from driving the level of detail and the loads of the tilesets, like a preview that only shows what
+        // the main viewport loaded
+        virtual void SetViewportEnabled(AzFramework::ViewportId viewportId, bool enabled) = 0;
+    };
+
+    using ViewportDetailRequestBus = AZ::EBus<ViewportDetailRequest>;
+} // namespace Cesium
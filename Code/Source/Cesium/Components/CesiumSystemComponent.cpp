@@ -1,4 +1,5 @@
 #include "Cesium/Components/CesiumSystemComponent.h"
+#include "Cesium/Math/MathHelper.h"
 #include <Cesium/EBus/TilesetComponentBus.h>
 #include <Cesium/EBus/GeoReferenceCameraFlyControllerBus.h>
 #include <Cesium/EBus/OriginShiftComponentBus.h>
@@ -10,15 +11,331 @@
 #include <Cesium/Math/Cartographic.h>
 #include <Cesium/Math/GeospatialHelper.h>
 #include <Cesium/Math/MathReflect.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <Cesium3DTilesSelection/registerAllTileContentTypes.h>
+#include <glm/gtc/quaternion.hpp>
+#include <cinttypes>
 
 namespace Cesium
 {
+    AZ_CVAR(
+        bool,
+        cesium_deterministic_execution,
+        false,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Run Cesium tasks and IO requests in submission order on the main thread. Takes effect when the Cesium system is created");
+
+    AZ_CVAR(
+        float,
+        cesium_virtual_clock_step,
+        VirtualClock::DEFAULT_FIXED_DELTA_TIME,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Fixed time step in seconds used by camera fly paths in deterministic execution mode");
+
+    AZ_CVAR(
+        AZ::u32,
+        cesium_reserved_cores,
+        0,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Number of leading cores that Cesium threads do not run on, left to the engine main and render threads");
+
+    AZ_CVAR(
+        AZ::u32,
+        cesium_efficiency_cores,
+        0,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Number of trailing cores treated as efficiency cores. Cesium IO threads are pinned to them");
+
+    AZ_CVAR(
+        int,
+        cesium_worker_thread_priority,
+        ThreadAffinityPolicy::DEFAULT_PRIORITY,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Priority of Cesium task worker threads. The default value keeps the engine default priority");
+
+    AZ_CVAR(
+        int,
+        cesium_io_thread_priority,
+        ThreadAffinityPolicy::DEFAULT_PRIORITY,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Priority of Cesium HTTP and file threads. The default value keeps the engine default priority");
+
+    AZ_CVAR(
+        bool,
+        cesium_pin_threads,
+        true,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Pin Cesium threads to cores. Changes to the thread settings take effect when the Cesium system is created");
+
+    AZ_CVAR(
+        AZ::u32,
+        cesium_memory_budget_mb,
+        static_cast<AZ::u32>(MemoryBudget::DEFAULT_BUDGET_BYTES / (1024 * 1024)),
+        [](const AZ::u32& budgetMegabytes)
+        {
+            if (CesiumInterface::Get())
+            {
+                CesiumInterface::Get()->GetMemoryBudget().SetBudgetBytes(std::uint64_t{ budgetMegabytes } * 1024 * 1024);
+            }
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Cache size in megabytes shared by all the tilesets. Zero lets each tileset use its own maximum cache size");
+
+    AZ_CVAR(
+        AZ::u32,
+        cesium_memory_budget_minimum_mb,
+        static_cast<AZ::u32>(MemoryBudget::DEFAULT_MINIMUM_BYTES / (1024 * 1024)),
+        [](const AZ::u32& minimumMegabytes)
+        {
+            if (CesiumInterface::Get())
+            {
+                CesiumInterface::Get()->GetMemoryBudget().SetMinimumBytes(std::uint64_t{ minimumMegabytes } * 1024 * 1024);
+            }
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Cache size in megabytes every tileset keeps whatever its screen coverage, as long as the memory budget allows it");
+
+    AZ_CVAR(
+        AZ::u32,
+        cesium_global_load_slots,
+        LoadSlotArbiter::DEFAULT_GLOBAL_LOAD_SLOTS,
+        [](const AZ::u32& loadSlots)
+        {
+            if (CesiumInterface::Get())
+            {
+                CesiumInterface::Get()->GetLoadSlotArbiter().SetGlobalLoadSlots(loadSlots);
+            }
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Simultaneous tile loads shared by all the tilesets and their raster overlays. Zero lets each tileset use its own");
+
+    AZ_CVAR(
+        AZ::u32,
+        cesium_minimum_load_slots,
+        LoadSlotArbiter::DEFAULT_MINIMUM_LOAD_SLOTS,
+        [](const AZ::u32& loadSlots)
+        {
+            if (CesiumInterface::Get())
+            {
+                CesiumInterface::Get()->GetLoadSlotArbiter().SetMinimumLoadSlots(loadSlots);
+            }
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Simultaneous tile loads every tileset keeps whatever its screen coverage, as long as the global load slots allow it");
+
+    AZ_CVAR(
+        float,
+        cesium_inactive_viewport_sse_multiplier,
+        static_cast<float>(ViewStateProvider::DEFAULT_INACTIVE_SCREEN_SPACE_ERROR_MULTIPLIER),
+        [](const float& multiplier)
+        {
+            if (CesiumInterface::Get())
+            {
+                CesiumInterface::Get()->GetViewStateProvider().SetInactiveScreenSpaceErrorMultiplier(multiplier);
+            }
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Multiplies the screen space error of the viewports in the background, like the secondary viewports of the Editor");
+
+    AZ_CVAR(
+        float,
+        cesium_inactive_viewport_priority,
+        static_cast<float>(ViewStateProvider::DEFAULT_INACTIVE_PRIORITY),
+        [](const float& priority)
+        {
+            if (CesiumInterface::Get())
+            {
+                CesiumInterface::Get()->GetViewStateProvider().SetInactivePriority(priority);
+            }
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Multiplies the priority of the viewports in the background in the memory budget and the load slots");
+
+    AZ_CVAR(
+        bool,
+        cesium_drop_inactive_viewports,
+        false,
+        [](const bool& dropInactiveViewports)
+        {
+            if (CesiumInterface::Get())
+            {
+                CesiumInterface::Get()->GetViewStateProvider().SetDropInactiveViewports(dropInactiveViewports);
+            }
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Only load the tiles of the default viewport. The viewports in the background render the tiles it loaded");
+
+    static void cesium_trace_start(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (TraceRecorderInterface::Get() == nullptr)
+        {
+            return;
+        }
+
+        std::size_t capacity = TraceRecorder::DEFAULT_CAPACITY;
+        if (!arguments.empty())
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(capacity, arguments.front());
+        }
+
+        TraceRecorderInterface::Get()->Start(capacity);
+    }
+
+    static void cesium_trace_stop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (TraceRecorderInterface::Get())
+        {
+            TraceRecorderInterface::Get()->Stop();
+        }
+    }
+
+    static void cesium_trace_export(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (TraceRecorderInterface::Get() == nullptr)
+        {
+            return;
+        }
+
+        AZStd::string path = arguments.empty() ? AZStd::string("@user@/cesium_trace.json") : AZStd::string(arguments.front());
+        if (!TraceRecorderInterface::Get()->ExportChromeTrace(path))
+        {
+            AZ_Warning("Cesium", false, "Cannot export trace to %s", path.c_str());
+        }
+    }
+
+    static void cesium_memory_report([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (MemoryTracker* memoryTracker = MemoryTrackerInterface::Get())
+        {
+            for (std::size_t i = 0; i < MemoryTracker::CATEGORY_COUNT; ++i)
+            {
+                MemoryCategory category = static_cast<MemoryCategory>(i);
+                AZ_TracePrintf(
+                    "Cesium", "%s: %" PRIu64 " bytes (peak %" PRIu64 " bytes)\n", MemoryTracker::GetCategoryName(category),
+                    memoryTracker->GetLiveBytes(category), memoryTracker->GetPeakBytes(category));
+            }
+
+            AZ_TracePrintf(
+                "Cesium", "Total: %" PRIu64 " bytes (peak %" PRIu64 " bytes)\n", memoryTracker->GetTotalLiveBytes(),
+                memoryTracker->GetTotalPeakBytes());
+        }
+
+        if (CesiumInterface::Get())
+        {
+            static const char* pressureNames[] = { "normal", "high", "critical" };
+            const MemoryBudgetStatus& status = CesiumInterface::Get()->GetMemoryBudget().GetStatus();
+            AZ_TracePrintf(
+                "Cesium",
+                "Budget: %" PRIu64 " bytes, used %" PRIu64 " bytes, allocated %" PRIu64 " bytes to %u tilesets, %u evicting, %s pressure\n",
+                status.m_budgetBytes, status.m_usedBytes, status.m_allocatedBytes, status.m_consumerCount,
+                status.m_evictingConsumerCount, pressureNames[static_cast<int>(status.m_pressure)]);
+        }
+
+        TilesetRequestBus::EnumerateHandlers(
+            [](TilesetRequest* tileset)
+            {
+                TilesetMemoryUsage usage = tileset->GetMemoryUsage();
+                AZ_TracePrintf(
+                    "Cesium",
+                    "Tileset %s: %" PRIu64 " bytes (peak %" PRIu64 " bytes). Decoded tiles %" PRIu64 ", built assets %" PRIu64
+                    ", raster images %" PRIu64 "\n",
+                    TilesetRequestBus::GetCurrentBusId()->ToString().c_str(), usage.m_totalBytes, usage.m_peakTotalBytes,
+                    usage.m_decodedTileBytes, usage.m_builtAssetBytes, usage.m_rasterImageBytes);
+                return true;
+            });
+    }
+
+    static void cesium_tileset_stats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        TilesetRequestBus::EnumerateHandlers(
+            [](TilesetRequest* tileset)
+            {
+                TilesetStreamingStatistics frame = tileset->GetStreamingStatistics();
+                TilesetRollingStreamingStatistics rolling = tileset->GetRollingStreamingStatistics();
+                AZ_TracePrintf(
+                    "Cesium",
+                    "Tileset %s last frame: rendered %u, visited %u, culled %u, culled visited %u, max depth %u, loading %u/%u/%u "
+                    "(low/medium/high), main thread queue %u, visibility toggles %u, cached %" PRIu64 " bytes, prefetched %u tiles "
+                    "(%" PRIu64 " bytes), horizon culled %u, occlusion culled %u (%.3f ms), updateView %.3f ms\n",
+                    TilesetRequestBus::GetCurrentBusId()->ToString().c_str(), frame.m_tilesRendered, frame.m_tilesVisited,
+                    frame.m_tilesCulled, frame.m_culledTilesVisited, frame.m_maxDepthVisited, frame.m_tilesLoadingLowPriority,
+                    frame.m_tilesLoadingMediumPriority, frame.m_tilesLoadingHighPriority, frame.m_mainThreadQueueLength,
+                    frame.m_visibilityToggles, frame.m_bytesCached, frame.m_tilesPrefetched, frame.m_bytesPrefetched,
+                    frame.m_tilesHorizonCulled, frame.m_tilesOcclusionCulled, frame.m_occlusionCullingTime, frame.m_updateViewTime);
+                AZ_TracePrintf(
+                    "Cesium",
+                    "Tileset %s last %u frames: rendered %.1f, visited %.1f, culled %.1f, occlusion culled %.1f, loading %.1f, "
+                    "main thread queue %.1f, visibility toggles %" PRIu64 ", cached %.0f bytes, updateView %.3f ms (max %.3f ms, "
+                    "skipped %u)\n",
+                    TilesetRequestBus::GetCurrentBusId()->ToString().c_str(), rolling.m_frameCount, rolling.m_averageTilesRendered,
+                    rolling.m_averageTilesVisited, rolling.m_averageTilesCulled, rolling.m_averageTilesOcclusionCulled,
+                    rolling.m_averageTilesLoading, rolling.m_averageMainThreadQueueLength, rolling.m_totalVisibilityToggles,
+                    rolling.m_averageBytesCached, rolling.m_averageUpdateViewTime, rolling.m_maxUpdateViewTime,
+                    rolling.m_skippedUpdateViews);
+                return true;
+            });
+    }
+
+    static void cesium_tileset_stats_reset([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        TilesetRequestBus::Broadcast(&TilesetRequestBus::Events::ResetStreamingStatistics);
+    }
+
+    static void cesium_tileset_debug_draw(const AZ::ConsoleCommandContainer& arguments)
+    {
+        TilesetDebugDrawMode drawMode = TilesetDebugDrawMode::None;
+        if (!arguments.empty())
+        {
+            if (arguments.front() == "latency")
+            {
+                drawMode = TilesetDebugDrawMode::LoadLatency;
+            }
+            else if (arguments.front() == "depth")
+            {
+                drawMode = TilesetDebugDrawMode::Depth;
+            }
+        }
+
+        TilesetRequestBus::EnumerateHandlers(
+            [drawMode](TilesetRequest* tileset)
+            {
+                TilesetDebugConfiguration debugConfiguration = tileset->GetDebugConfiguration();
+                debugConfiguration.m_drawMode = drawMode;
+                tileset->SetDebugConfiguration(debugConfiguration);
+                return true;
+            });
+    }
+
+    AZ_CONSOLEFREEFUNC(
+        cesium_trace_start, AZ::ConsoleFunctorFlags::Null, "Starts recording Cesium tile lifecycle events. Optional: ring buffer capacity");
+    AZ_CONSOLEFREEFUNC(cesium_trace_stop, AZ::ConsoleFunctorFlags::Null, "Stops recording Cesium tile lifecycle events");
+    AZ_CONSOLEFREEFUNC(
+        cesium_trace_export, AZ::ConsoleFunctorFlags::Null, "Exports recorded Cesium events as Chrome trace JSON. Optional: file path");
+    AZ_CONSOLEFREEFUNC(
+        cesium_memory_report, AZ::ConsoleFunctorFlags::Null, "Prints the live and peak bytes of each Cesium memory category and tileset");
+    AZ_CONSOLEFREEFUNC(
+        cesium_tileset_stats, AZ::ConsoleFunctorFlags::Null, "Prints the last frame and rolling streaming statistics of each tileset");
+    AZ_CONSOLEFREEFUNC(
+        cesium_tileset_stats_reset, AZ::ConsoleFunctorFlags::Null, "Clears the rolling streaming statistics of each tileset");
+    AZ_CONSOLEFREEFUNC(
+        cesium_tileset_debug_draw,
+        AZ::ConsoleFunctorFlags::Null,
+        "Draws the bounds of the rendered tiles of each tileset. Argument: none, latency or depth");
+
     void CesiumSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         MathSerialization::Reflect(context);
@@ -31,6 +348,12 @@ namespace Cesium
 
         TilesetConfiguration::Reflect(context);
         TilesetRenderConfiguration::Reflect(context);
+        TilesetLoadPipelineMetrics::Reflect(context);
+        TilesetMemoryUsage::Reflect(context);
+        TilesetStreamingStatistics::Reflect(context);
+        TilesetRollingStreamingStatistics::Reflect(context);
+        TilesetDebugConfiguration::Reflect(context);
+        TilesetDebugTileInfo::Reflect(context);
         TilesetSource::Reflect(context);
         TilesetRequest::Reflect(context);
 
@@ -42,6 +365,25 @@ namespace Cesium
 
         OriginShiftAnchorRequest::Reflect(context);
 
+        HttpHistogram::Reflect(context);
+        HttpHostMetrics::Reflect(context);
+        HttpMetricsSnapshot::Reflect(context);
+        HttpMetricsRequest::Reflect(context);
+
+        MemoryBudgetStatus::Reflect(context);
+        MemoryBudgetRequest::Reflect(context);
+        MemoryBudgetNotificationEBusHandler::Reflect(context);
+
+        LoadSlotStatus::Reflect(context);
+        LoadSlotRequest::Reflect(context);
+
+        CameraBookmarkStatus::Reflect(context);
+        CameraBookmarkRequest::Reflect(context);
+        CameraBookmarkNotificationEBusHandler::Reflect(context);
+
+        ViewportDetailConfiguration::Reflect(context);
+        ViewportDetailRequest::Reflect(context);
+
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serialize->Class<CesiumSystemComponent, AZ::Component>()->Version(0);
@@ -79,17 +421,218 @@ namespace Cesium
         // initialize Cesium Native
         Cesium3DTilesSelection::registerAllTileContentTypes();
 
-        m_cesiumSystem = AZStd::make_unique<CesiumSystem>();
+        ExecutionMode executionMode = cesium_deterministic_execution ? ExecutionMode::Deterministic : ExecutionMode::Concurrent;
+        ThreadAffinityPolicy affinityPolicy;
+        affinityPolicy.m_reservedCores = cesium_reserved_cores;
+        affinityPolicy.m_efficiencyCores = cesium_efficiency_cores;
+        affinityPolicy.m_workerPriority = cesium_worker_thread_priority;
+        affinityPolicy.m_ioPriority = cesium_io_thread_priority;
+        affinityPolicy.m_pinThreads = cesium_pin_threads;
+        m_cesiumSystem = AZStd::make_unique<CesiumSystem>(executionMode, affinityPolicy);
+        if (executionMode == ExecutionMode::Deterministic)
+        {
+            m_cesiumSystem->GetVirtualClock().Enable(cesium_virtual_clock_step);
+        }
+        m_cesiumSystem->GetMemoryBudget().SetBudgetBytes(std::uint64_t{ cesium_memory_budget_mb } * 1024 * 1024);
+        m_cesiumSystem->GetMemoryBudget().SetMinimumBytes(std::uint64_t{ cesium_memory_budget_minimum_mb } * 1024 * 1024);
+        m_cesiumSystem->GetLoadSlotArbiter().SetGlobalLoadSlots(cesium_global_load_slots);
+        m_cesiumSystem->GetLoadSlotArbiter().SetMinimumLoadSlots(cesium_minimum_load_slots);
+        m_cesiumSystem->GetViewStateProvider().SetInactiveScreenSpaceErrorMultiplier(cesium_inactive_viewport_sse_multiplier);
+        m_cesiumSystem->GetViewStateProvider().SetInactivePriority(cesium_inactive_viewport_priority);
+        m_cesiumSystem->GetViewStateProvider().SetDropInactiveViewports(cesium_drop_inactive_viewports);
         if (CesiumInterface::Get() == nullptr)
         {
             CesiumInterface::Register(m_cesiumSystem.get());
         }
+
+        if (TraceRecorderInterface::Get() == nullptr)
+        {
+            TraceRecorderInterface::Register(&m_cesiumSystem->GetTraceRecorder());
+        }
+
+        if (MemoryTrackerInterface::Get() == nullptr)
+        {
+            MemoryTrackerInterface::Register(&m_cesiumSystem->GetMemoryTracker());
+        }
     }
 
     CesiumSystemComponent::~CesiumSystemComponent()
     {
     }
 
+    HttpMetricsSnapshot CesiumSystemComponent::GetHttpMetrics() const
+    {
+        return m_cesiumSystem->GetHttpMetrics().GetSnapshot();
+    }
+
+    void CesiumSystemComponent::ResetHttpMetrics()
+    {
+        m_cesiumSystem->GetHttpMetrics().Reset();
+    }
+
+    void CesiumSystemComponent::SetMemoryBudget(std::uint64_t budgetBytes)
+    {
+        m_cesiumSystem->GetMemoryBudget().SetBudgetBytes(budgetBytes);
+    }
+
+    std::uint64_t CesiumSystemComponent::GetMemoryBudget() const
+    {
+        return m_cesiumSystem->GetMemoryBudget().GetBudgetBytes();
+    }
+
+    MemoryBudgetStatus CesiumSystemComponent::GetMemoryBudgetStatus() const
+    {
+        return m_cesiumSystem->GetMemoryBudget().GetStatus();
+    }
+
+    void CesiumSystemComponent::SetGlobalLoadSlots(std::uint32_t loadSlots)
+    {
+        m_cesiumSystem->GetLoadSlotArbiter().SetGlobalLoadSlots(loadSlots);
+    }
+
+    std::uint32_t CesiumSystemComponent::GetGlobalLoadSlots() const
+    {
+        return m_cesiumSystem->GetLoadSlotArbiter().GetGlobalLoadSlots();
+    }
+
+    void CesiumSystemComponent::SetMinimumLoadSlots(std::uint32_t loadSlots)
+    {
+        m_cesiumSystem->GetLoadSlotArbiter().SetMinimumLoadSlots(loadSlots);
+    }
+
+    std::uint32_t CesiumSystemComponent::GetMinimumLoadSlots() const
+    {
+        return m_cesiumSystem->GetLoadSlotArbiter().GetMinimumLoadSlots();
+    }
+
+    LoadSlotStatus CesiumSystemComponent::GetLoadSlotStatus() const
+    {
+        return m_cesiumSystem->GetLoadSlotArbiter().GetStatus();
+    }
+
+    void CesiumSystemComponent::AddCameraBookmark(
+        const AZStd::string& name,
+        const glm::dvec3& ecefPosition,
+        const glm::dvec3& ecefDirection,
+        const glm::dvec3& ecefUp,
+        std::uint64_t memoryBudgetBytes,
+        bool keepWarm)
+    {
+        m_cesiumSystem->GetCameraBookmarks().Add(name, ecefPosition, ecefDirection, ecefUp, memoryBudgetBytes, keepWarm);
+    }
+
+    bool CesiumSystemComponent::AddCameraBookmarkFromCamera(
+        const AZStd::string& name, AZ::EntityId cameraEntityId, std::uint64_t memoryBudgetBytes, bool keepWarm)
+    {
+        if (!AZ::TransformBus::HasHandlers(cameraEntityId))
+        {
+            return false;
+        }
+
+        AZ::Transform relativeCameraTransform = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(relativeCameraTransform, cameraEntityId, &AZ::TransformBus::Events::GetWorldTM);
+        glm::dmat4 relToAbsWorld{ 1.0 };
+        OriginShiftRequestBus::BroadcastResult(relToAbsWorld, &OriginShiftRequestBus::Events::GetRelToAbsWorld);
+        glm::dmat4 absCameraTransform =
+            relToAbsWorld * MathHelper::ConvertTransformAndScaleToDMat4(relativeCameraTransform, AZ::Vector3::CreateOne());
+        m_cesiumSystem->GetCameraBookmarks().Add(
+            name, absCameraTransform[3], absCameraTransform[1], absCameraTransform[2], memoryBudgetBytes, keepWarm);
+        return true;
+    }
+
+    bool CesiumSystemComponent::RemoveCameraBookmark(const AZStd::string& name)
+    {
+        return m_cesiumSystem->GetCameraBookmarks().Remove(name);
+    }
+
+    AZStd::vector<AZStd::string> CesiumSystemComponent::GetCameraBookmarkNames() const
+    {
+        return m_cesiumSystem->GetCameraBookmarks().GetNames();
+    }
+
+    bool CesiumSystemComponent::PreloadCameraBookmark(const AZStd::string& name)
+    {
+        return m_cesiumSystem->GetCameraBookmarks().Preload(name);
+    }
+
+    bool CesiumSystemComponent::ReleaseCameraBookmark(const AZStd::string& name)
+    {
+        return m_cesiumSystem->GetCameraBookmarks().Release(name);
+    }
+
+    bool CesiumSystemComponent::IsCameraBookmarkReady(const AZStd::string& name) const
+    {
+        return m_cesiumSystem->GetCameraBookmarks().IsReady(name);
+    }
+
+    CameraBookmarkStatus CesiumSystemComponent::GetCameraBookmarkStatus(const AZStd::string& name) const
+    {
+        return m_cesiumSystem->GetCameraBookmarks().GetStatus(name);
+    }
+
+    bool CesiumSystemComponent::JumpToCameraBookmark(const AZStd::string& name, AZ::EntityId cameraEntityId)
+    {
+        glm::dvec3 ecefPosition{ 0.0 };
+        glm::dvec3 ecefDirection{ 0.0 };
+        glm::dvec3 ecefUp{ 0.0 };
+        if (!AZ::TransformBus::HasHandlers(cameraEntityId) ||
+            !m_cesiumSystem->GetCameraBookmarks().GetPose(name, ecefPosition, ecefDirection, ecefUp))
+        {
+            return false;
+        }
+
+        // move the origin to the bookmark when it's far, so the camera keeps its precision
+        glm::dmat4 absToRelWorld{ 1.0 };
+        OriginShiftRequestBus::BroadcastResult(absToRelWorld, &OriginShiftRequestBus::Events::GetAbsToRelWorld);
+        glm::dvec3 relativePosition = absToRelWorld * glm::dvec4(ecefPosition, 1.0);
+        if (glm::abs(relativePosition.x) >= ORIGIN_SHIFT_DISTANCE || glm::abs(relativePosition.y) >= ORIGIN_SHIFT_DISTANCE ||
+            glm::abs(relativePosition.z) >= ORIGIN_SHIFT_DISTANCE)
+        {
+            OriginShiftRequestBus::Broadcast(&OriginShiftRequestBus::Events::SetOrigin, ecefPosition);
+            OriginShiftRequestBus::BroadcastResult(absToRelWorld, &OriginShiftRequestBus::Events::GetAbsToRelWorld);
+            relativePosition = absToRelWorld * glm::dvec4(ecefPosition, 1.0);
+        }
+
+        // the camera looks along its Y axis with Z up
+        glm::dmat3 ecefRotation{ glm::cross(ecefDirection, ecefUp), ecefDirection, ecefUp };
+        glm::dquat relativeOrientation = glm::dquat(absToRelWorld) * glm::dquat(ecefRotation);
+        AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+        cameraTransform.SetRotation(AZ::Quaternion(
+            static_cast<float>(relativeOrientation.x), static_cast<float>(relativeOrientation.y), static_cast<float>(relativeOrientation.z),
+            static_cast<float>(relativeOrientation.w)));
+        cameraTransform.SetTranslation(AZ::Vector3(
+            static_cast<float>(relativePosition.x), static_cast<float>(relativePosition.y), static_cast<float>(relativePosition.z)));
+        AZ::TransformBus::Event(cameraEntityId, &AZ::TransformBus::Events::SetWorldTM, cameraTransform);
+
+        m_cesiumSystem->GetCameraBookmarks().Release(name);
+        return true;
+    }
+
+    void CesiumSystemComponent::SetViewportDetail(AzFramework::ViewportId viewportId, const ViewportDetailConfiguration& configuration)
+    {
+        m_cesiumSystem->GetViewStateProvider().SetViewportDetail(viewportId, configuration);
+    }
+
+    ViewportDetailConfiguration CesiumSystemComponent::GetViewportDetail(AzFramework::ViewportId viewportId) const
+    {
+        return m_cesiumSystem->GetViewStateProvider().GetViewportDetail(viewportId);
+    }
+
+    void CesiumSystemComponent::ClearViewportDetail(AzFramework::ViewportId viewportId)
+    {
+        m_cesiumSystem->GetViewStateProvider().ClearViewportDetail(viewportId);
+    }
+
+    void CesiumSystemComponent::SetViewportGazePoint(AzFramework::ViewportId viewportId, const glm::dvec2& gazePoint)
+    {
+        m_cesiumSystem->GetViewStateProvider().SetViewportGazePoint(viewportId, gazePoint);
+    }
+
+    void CesiumSystemComponent::SetViewportEnabled(AzFramework::ViewportId viewportId, bool enabled)
+    {
+        m_cesiumSystem->GetViewStateProvider().SetViewportEnabled(viewportId, enabled);
+    }
+
     void CesiumSystemComponent::Init()
     {
     }
@@ -97,22 +640,72 @@ namespace Cesium
     void CesiumSystemComponent::Activate()
     {
         CesiumSystemRequestBus::Handler::BusConnect();
+        HttpMetricsRequestBus::Handler::BusConnect();
+        MemoryBudgetRequestBus::Handler::BusConnect();
+        LoadSlotRequestBus::Handler::BusConnect();
+        CameraBookmarkRequestBus::Handler::BusConnect();
+        ViewportDetailRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
     }
 
     void CesiumSystemComponent::Deactivate()
     {
         CesiumSystemRequestBus::Handler::BusDisconnect();
+        HttpMetricsRequestBus::Handler::BusDisconnect();
+        MemoryBudgetRequestBus::Handler::BusDisconnect();
+        LoadSlotRequestBus::Handler::BusDisconnect();
+        CameraBookmarkRequestBus::Handler::BusDisconnect();
+        ViewportDetailRequestBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
 
         if (CesiumInterface::Get() == m_cesiumSystem.get())
         {
             CesiumInterface::Unregister(m_cesiumSystem.get());
         }
+
+        if (TraceRecorderInterface::Get() == &m_cesiumSystem->GetTraceRecorder())
+        {
+            TraceRecorderInterface::Unregister(&m_cesiumSystem->GetTraceRecorder());
+        }
+
+        if (MemoryTrackerInterface::Get() == &m_cesiumSystem->GetMemoryTracker())
+        {
+            MemoryTrackerInterface::Unregister(&m_cesiumSystem->GetMemoryTracker());
+        }
     }
 
-    void CesiumSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    void CesiumSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_cesiumSystem->GetVirtualClock().Advance(deltaTime);
+
+        // drain all the work submitted since the last tick, so tile loads complete in the same order every run
+        if (DeterministicTaskQueue* deterministicQueue = m_cesiumSystem->GetDeterministicTaskQueue())
+        {
+            deterministicQueue->RunPending();
+        }
+
+        // the cameras are read when the first tileset asks for its view states, after the camera controllers moved them
+        m_cesiumSystem->GetViewStateProvider().Update();
+
+        // the readiness of the bookmarks was reported by the tilesets last frame
+        m_readyBookmarks.clear();
+        m_cesiumSystem->GetCameraBookmarks().Update(m_readyBookmarks);
+        for (const AZStd::string& name : m_readyBookmarks)
+        {
+            CameraBookmarkNotificationBus::Broadcast(&CameraBookmarkNotificationBus::Events::OnCameraBookmarkReady, name);
+        }
+
+        // the tilesets reported their usage last frame, and apply their new share in their tick
+        MemoryBudget& memoryBudget = m_cesiumSystem->GetMemoryBudget();
+        MemoryPressure previousPressure = memoryBudget.GetStatus().m_pressure;
+        memoryBudget.Rebalance();
+        if (memoryBudget.GetStatus().m_pressure != previousPressure)
+        {
+            MemoryBudgetNotificationBus::Broadcast(&MemoryBudgetNotificationBus::Events::OnMemoryPressureChanged, memoryBudget.GetStatus());
+        }
+
+        // the load slots are shared the same way, using the demand the tilesets reported last frame
+        m_cesiumSystem->GetLoadSlotArbiter().Rebalance();
     }
 
 } // namespace Cesium
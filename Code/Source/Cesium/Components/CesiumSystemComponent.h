@@ -2,6 +2,11 @@
 
 #include "Cesium/EBus/CesiumSystemComponentBus.h"
 #include "Cesium/Systems/CesiumSystem.h"
+#include <Cesium/EBus/HttpMetricsBus.h>
+#include <Cesium/EBus/MemoryBudgetBus.h>
+#include <Cesium/EBus/LoadSlotBus.h>
+#include <Cesium/EBus/CameraBookmarkBus.h>
+#include <Cesium/EBus/ViewportDetailBus.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Component/Component.h>
@@ -13,6 +18,11 @@ namespace Cesium
     class CesiumSystemComponent
         : public AZ::Component
         , public CesiumSystemRequestBus::Handler
+        , public HttpMetricsRequestBus::Handler
+        , public MemoryBudgetRequestBus::Handler
+        , public LoadSlotRequestBus::Handler
+        , public CameraBookmarkRequestBus::Handler
+        , public ViewportDetailRequestBus::Handler
         , public AZ::TickBus::Handler
     {
     public:
@@ -32,6 +42,61 @@ namespace Cesium
 
         ~CesiumSystemComponent();
 
+        HttpMetricsSnapshot GetHttpMetrics() const override;
+
+        void ResetHttpMetrics() override;
+
+        void SetMemoryBudget(std::uint64_t budgetBytes) override;
+
+        std::uint64_t GetMemoryBudget() const override;
+
+        MemoryBudgetStatus GetMemoryBudgetStatus() const override;
+
+        void SetGlobalLoadSlots(std::uint32_t loadSlots) override;
+
+        std::uint32_t GetGlobalLoadSlots() const override;
+
+        void SetMinimumLoadSlots(std::uint32_t loadSlots) override;
+
+        std::uint32_t GetMinimumLoadSlots() const override;
+
+        LoadSlotStatus GetLoadSlotStatus() const override;
+
+        void AddCameraBookmark(
+            const AZStd::string& name,
+            const glm::dvec3& ecefPosition,
+            const glm::dvec3& ecefDirection,
+            const glm::dvec3& ecefUp,
+            std::uint64_t memoryBudgetBytes,
+            bool keepWarm) override;
+
+        bool AddCameraBookmarkFromCamera(
+            const AZStd::string& name, AZ::EntityId cameraEntityId, std::uint64_t memoryBudgetBytes, bool keepWarm) override;
+
+        bool RemoveCameraBookmark(const AZStd::string& name) override;
+
+        AZStd::vector<AZStd::string> GetCameraBookmarkNames() const override;
+
+        bool PreloadCameraBookmark(const AZStd::string& name) override;
+
+        bool ReleaseCameraBookmark(const AZStd::string& name) override;
+
+        bool IsCameraBookmarkReady(const AZStd::string& name) const override;
+
+        CameraBookmarkStatus GetCameraBookmarkStatus(const AZStd::string& name) const override;
+
+        bool JumpToCameraBookmark(const AZStd::string& name, AZ::EntityId cameraEntityId) override;
+
+        void SetViewportDetail(AzFramework::ViewportId viewportId, const ViewportDetailConfiguration& configuration) override;
+
+        ViewportDetailConfiguration GetViewportDetail(AzFramework::ViewportId viewportId) const override;
+
+        void ClearViewportDetail(AzFramework::ViewportId viewportId) override;
+
+        void SetViewportGazePoint(AzFramework::ViewportId viewportId, const glm::dvec2& gazePoint) override;
+
+        void SetViewportEnabled(AzFramework::ViewportId viewportId, bool enabled) override;
+
     protected:
         void Init() override;
 
@@ -42,7 +107,11 @@ namespace Cesium
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
     private:
+        // the camera is moved with the origin when it's this far from it, like at the end of a camera fly
+        static constexpr double ORIGIN_SHIFT_DISTANCE = 10000.0;
+
         AZStd::unique_ptr<CesiumSystem> m_cesiumSystem;
+        AZStd::vector<AZStd::string> m_readyBookmarks;
     };
 
 } // namespace Cesium
@@ -26,6 +26,31 @@
 
 namespace Cesium
 {
+    struct DynamicUiImageComponent::LoadImageHandler
+    {
+        void operator()(IOContent&& content)
+        {
+            if (content.empty())
+            {
+                return;
+            }
+
+            CesiumGltfReader::GltfReader gltfReader;
+            auto imageResult = gltfReader.readImage(content);
+            if (imageResult.image)
+            {
+                auto pool = AZ::RPI::ImageSystemInterface::Get()->GetStreamingPool();
+                auto size = AZ::RHI::Size(imageResult.image->width, imageResult.image->height, 1);
+                auto image = AZ::RPI::StreamingImage::CreateFromCpuData(
+                    *pool, AZ::RHI::ImageDimension::Image2D, size, AZ::RHI::Format::R8G8B8A8_UNORM, imageResult.image->pixelData.data(),
+                    imageResult.image->pixelData.size());
+                DynamicUiImageRequestBus::Event(m_entityId, &DynamicUiImageRequestBus::Events::SetImage, image, size);
+            }
+        }
+
+        AZ::EntityId m_entityId;
+    };
+
     void DynamicUiImageComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -85,31 +110,9 @@ namespace Cesium
             return;
         }
 
-        AZ::EntityId selfEntityId = GetEntityId();
         auto& httpManager = CesiumInterface::Get()->GetIOManager(Cesium::IOKind::Http);
         Cesium::IORequestParameter requestParameter{ url, "" };
-        auto future =
-            httpManager.GetFileContentAsync(m_asyncSystem, requestParameter)
-                .thenInMainThread(
-                    [selfEntityId](IOContent&& content)
-                    {
-                        if (content.empty())
-                        {
-                            return;
-                        }
-
-                        CesiumGltfReader::GltfReader gltfReader;
-                        auto imageResult = gltfReader.readImage(content);
-                        if (imageResult.image)
-                        {
-                            auto pool = AZ::RPI::ImageSystemInterface::Get()->GetStreamingPool();
-                            auto size = AZ::RHI::Size(imageResult.image->width, imageResult.image->height, 1);
-                            auto image = AZ::RPI::StreamingImage::CreateFromCpuData(
-                                *pool, AZ::RHI::ImageDimension::Image2D, size, AZ::RHI::Format::R8G8B8A8_UNORM,
-                                imageResult.image->pixelData.data(), imageResult.image->pixelData.size());
-                            DynamicUiImageRequestBus::Event(selfEntityId, &DynamicUiImageRequestBus::Events::SetImage, image, size);
-                        }
-                    });
+        httpManager.GetFileContentAsync(m_asyncSystem, requestParameter).thenInMainThread(LoadImageHandler{ GetEntityId() });
     }
 
     void DynamicUiImageComponent::SetImage(AZ::Data::Instance<AZ::RPI::StreamingImage> image, AZ::RHI::Size size)
@@ -18,6 +18,8 @@ namespace Cesium
         , public UiElementNotificationBus::Handler
         , public UiCanvasEnabledStateNotificationBus::Handler
     {
+        struct LoadImageHandler;
+
     public:
         AZ_COMPONENT(DynamicUiImageComponent, "{002FCB42-3714-4159-9444-73FA60CC1C25}");
 
@@ -4,6 +4,8 @@
 #include "Cesium/Math/GeoReferenceInterpolator.h"
 #include "Cesium/Math/LinearInterpolator.h"
 #include "Cesium/Math/MathReflect.h"
+#include "Cesium/Systems/CesiumSystem.h"
+#include "Cesium/Systems/DestinationPrefetch.h"
 #include <AzFramework/Input/Devices/Mouse/InputDeviceMouse.h>
 #include <AzFramework/Input/Devices/Keyboard/InputDeviceKeyboard.h>
 #include <AzFramework/Components/CameraBus.h>
@@ -24,7 +26,9 @@ namespace Cesium
                 ->Version(0)
                 ->Field("MouseSensitivity", &GeoReferenceCameraFlyController::m_mouseSensitivity)
                 ->Field("MovementSpeed", &GeoReferenceCameraFlyController::m_movementSpeed)
-                ->Field("PanningSpeed", &GeoReferenceCameraFlyController::m_panningSpeed);
+                ->Field("PanningSpeed", &GeoReferenceCameraFlyController::m_panningSpeed)
+                ->Field("PrefetchDestination", &GeoReferenceCameraFlyController::m_prefetchDestination)
+                ->Field("PrefetchWaypointCount", &GeoReferenceCameraFlyController::m_prefetchWaypointCount);
         }
     }
 
@@ -53,6 +57,9 @@ namespace Cesium
         , m_mouseSensitivity{ 1.0 }
         , m_movementSpeed{ 1.0 }
         , m_panningSpeed{ 1.0 }
+        , m_prefetchDestination{ true }
+        , m_prefetchWaypointCount{ 0 }
+        , m_destinationPrefetch{ AZStd::make_unique<DestinationPrefetch>() }
         , m_cameraPitch{}
         , m_cameraHead{}
         , m_cameraMovement{}
@@ -85,6 +92,7 @@ namespace Cesium
         AzFramework::InputChannelEventListener::Disconnect();
 
         StopFly();
+        StopDestinationPrefetch();
         ResetCameraMovement();
     }
 
@@ -155,8 +163,44 @@ namespace Cesium
         handler.Connect(m_stopFlyEvent);
     }
 
+    void GeoReferenceCameraFlyController::SetPrefetchDestination(bool prefetchDestination)
+    {
+        m_prefetchDestination = prefetchDestination;
+    }
+
+    bool GeoReferenceCameraFlyController::GetPrefetchDestination() const
+    {
+        return m_prefetchDestination;
+    }
+
+    void GeoReferenceCameraFlyController::SetPrefetchWaypointCount(std::uint32_t waypointCount)
+    {
+        m_prefetchWaypointCount = waypointCount;
+    }
+
+    std::uint32_t GeoReferenceCameraFlyController::GetPrefetchWaypointCount() const
+    {
+        return m_prefetchWaypointCount;
+    }
+
+    bool GeoReferenceCameraFlyController::IsDestinationReady() const
+    {
+        return m_destinationPrefetch->IsReady();
+    }
+
+    void GeoReferenceCameraFlyController::BindCameraDestinationReadyEventHandler(CameraDestinationReadyEvent::Handler& handler)
+    {
+        m_destinationPrefetch->BindReadyEventHandler(handler);
+    }
+
     void GeoReferenceCameraFlyController::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        // fly paths advance by the fixed step of the virtual clock in deterministic mode
+        if (CesiumInterface::Get())
+        {
+            deltaTime = CesiumInterface::Get()->GetVirtualClock().GetDeltaTime(deltaTime);
+        }
+
         switch (m_cameraFlyState)
         {
         case CameraFlyState::MidFly:
@@ -168,6 +212,8 @@ namespace Cesium
         default:
             break;
         }
+
+        UpdateDestinationPrefetch();
     }
 
     void GeoReferenceCameraFlyController::ProcessMidFlyState([[maybe_unused]] float deltaTime)
@@ -407,10 +453,71 @@ namespace Cesium
         glm::dmat4 absCameraTransform =
             relToAbsWorld * MathHelper::ConvertTransformAndScaleToDMat4(relCameraTransform, AZ::Vector3::CreateOne());
         glm::dvec3 absCameraPosition = absCameraTransform[3];
-        m_ecefPositionInterpolator = AZStd::make_unique<GeoReferenceInterpolator>(
+        auto interpolator = AZStd::make_unique<GeoReferenceInterpolator>(
             absCameraPosition, absCameraTransform[1], location, direction, duration, flyHeight);
+        StartDestinationPrefetch(location, *interpolator);
+        m_ecefPositionInterpolator = AZStd::move(interpolator);
 
         // transition to the new state
         m_cameraFlyState = CameraFlyState::MidFly;
     }
+
+    void GeoReferenceCameraFlyController::StartDestinationPrefetch(
+        const glm::dvec3& destination, const GeoReferenceInterpolator& interpolator)
+    {
+        CesiumSystem* cesiumSystem = CesiumInterface::Get();
+        if (!cesiumSystem)
+        {
+            return;
+        }
+
+        if (!m_prefetchDestination || interpolator.IsStop())
+        {
+            m_destinationPrefetch->Stop(cesiumSystem->GetViewStateProvider());
+            return;
+        }
+
+        // the viewports replace these defaults when the tilesets build the views
+        float verticalFov = glm::radians(60.0f);
+        Camera::CameraRequestBus::EventResult(verticalFov, GetEntityId(), &Camera::CameraRequestBus::Events::GetFovRadians);
+        glm::dvec2 viewportSize{ 1920.0, 1080.0 };
+        double horizontalFov = 2.0 * glm::atan(glm::tan(static_cast<double>(verticalFov) * 0.5) * viewportSize.x / viewportSize.y);
+
+        // the poses are sampled from copies of the interpolator, so they follow the exact path of the fly
+        AZStd::vector<ViewportCamera> ecefCameras;
+        std::uint32_t poseCount = m_prefetchWaypointCount + 1;
+        for (std::uint32_t i = 1; i <= poseCount; ++i)
+        {
+            GeoReferenceInterpolator pose = interpolator;
+            pose.Update(static_cast<float>(pose.GetTotalDuration() * static_cast<double>(i) / static_cast<double>(poseCount)));
+            glm::dquat orientation = pose.GetCurrentOrientation();
+
+            ViewportCamera camera;
+            camera.m_position = pose.GetCurrentPosition();
+            camera.m_direction = glm::normalize(orientation * glm::dvec3{ 0.0, 1.0, 0.0 });
+            camera.m_up = glm::normalize(orientation * glm::dvec3{ 0.0, 0.0, 1.0 });
+            camera.m_viewportSize = viewportSize;
+            camera.m_horizontalFieldOfView = horizontalFov;
+            camera.m_verticalFieldOfView = static_cast<double>(verticalFov);
+            ecefCameras.emplace_back(camera);
+        }
+
+        m_destinationPrefetch->Start(cesiumSystem->GetViewStateProvider(), destination, AZStd::move(ecefCameras));
+    }
+
+    void GeoReferenceCameraFlyController::UpdateDestinationPrefetch()
+    {
+        if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+        {
+            m_destinationPrefetch->Update(cesiumSystem->GetViewStateProvider());
+        }
+    }
+
+    void GeoReferenceCameraFlyController::StopDestinationPrefetch()
+    {
+        if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+        {
+            m_destinationPrefetch->Stop(cesiumSystem->GetViewStateProvider());
+        }
+    }
 } // namespace Cesium
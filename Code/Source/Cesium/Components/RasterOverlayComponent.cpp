@@ -3,6 +3,8 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/algorithm.h>
+#include <cmath>
 
 namespace Cesium
 {
@@ -35,6 +37,8 @@ namespace Cesium
     {
         Impl()
             : m_rasterOverlayObserverPtr{ nullptr }
+            , m_cacheScale{ 1.0 }
+            , m_loadScale{ 1.0 }
         {
         }
 
@@ -43,14 +47,20 @@ namespace Cesium
             if (m_rasterOverlayObserverPtr)
             {
                 Cesium3DTilesSelection::RasterOverlayOptions& options = m_rasterOverlayObserverPtr->getOptions();
-                options.maximumSimultaneousTileLoads = static_cast<std::int32_t>(configuration.m_maximumSimultaneousTileLoads);
-                options.subTileCacheBytes = static_cast<std::int64_t>(configuration.m_maximumCacheBytes);
+                double loads = std::round(static_cast<double>(configuration.m_maximumSimultaneousTileLoads) * m_loadScale);
+                options.maximumSimultaneousTileLoads = AZStd::max(static_cast<std::int32_t>(loads), 1);
+                double cacheBytes = static_cast<double>(configuration.m_maximumCacheBytes) * m_cacheScale;
+                options.subTileCacheBytes = static_cast<std::int64_t>(cacheBytes);
             }
         }
 
         RasterOverlayContainerLoadedEvent::Handler m_rasterOverlayContainerLoadedHandler;
         RasterOverlayContainerUnloadedEvent::Handler m_rasterOverlayContainerUnloadedHandler;
+        RasterOverlayContainerCacheScaleChangedEvent::Handler m_cacheScaleChangedHandler;
+        RasterOverlayContainerLoadScaleChangedEvent::Handler m_loadScaleChangedHandler;
         Cesium3DTilesSelection::RasterOverlay* m_rasterOverlayObserverPtr;
+        double m_cacheScale;
+        double m_loadScale;
     };
 
     void RasterOverlayComponent::Reflect(AZ::ReflectContext* context)
@@ -98,6 +108,26 @@ namespace Cesium
             GetEntityId(), &RasterOverlayContainerRequestBus::Events::BindContainerUnloadedEvent,
             m_impl->m_rasterOverlayContainerUnloadedHandler);
 
+        m_impl->m_cacheScaleChangedHandler = RasterOverlayContainerCacheScaleChangedEvent::Handler(
+            [this](double cacheScale)
+            {
+                m_impl->m_cacheScale = cacheScale;
+                m_impl->SetupConfiguration(m_configuration);
+            });
+
+        RasterOverlayContainerRequestBus::Event(
+            GetEntityId(), &RasterOverlayContainerRequestBus::Events::BindCacheScaleChangedEvent, m_impl->m_cacheScaleChangedHandler);
+
+        m_impl->m_loadScaleChangedHandler = RasterOverlayContainerLoadScaleChangedEvent::Handler(
+            [this](double loadScale)
+            {
+                m_impl->m_loadScale = loadScale;
+                m_impl->SetupConfiguration(m_configuration);
+            });
+
+        RasterOverlayContainerRequestBus::Event(
+            GetEntityId(), &RasterOverlayContainerRequestBus::Events::BindLoadScaleChangedEvent, m_impl->m_loadScaleChangedHandler);
+
         LoadRasterOverlay();
     }
 
@@ -140,6 +170,10 @@ namespace Cesium
         }
         else
         {
+            RasterOverlayContainerRequestBus::EventResult(
+                m_impl->m_cacheScale, GetEntityId(), &RasterOverlayContainerRequestBus::Events::GetCacheScale);
+            RasterOverlayContainerRequestBus::EventResult(
+                m_impl->m_loadScale, GetEntityId(), &RasterOverlayContainerRequestBus::Events::GetLoadScale);
             m_impl->SetupConfiguration(m_configuration);
         }
     }
@@ -2,16 +2,36 @@
 #include "Cesium/EBus/RasterOverlayContainerBus.h"
 #include "Cesium/TilesetUtility/RenderResourcesPreparer.h"
 #include "Cesium/TilesetUtility/TilesetCameraConfigurations.h"
+#include "Cesium/TilesetUtility/StreamingStatisticsWindow.h"
+#include "Cesium/TilesetUtility/TilesetDebugVisualizer.h"
+#include "Cesium/TilesetUtility/ScreenSpaceErrorController.h"
+#include "Cesium/TilesetUtility/ViewUpdateCache.h"
+#include "Cesium/TilesetUtility/CacheTrimPolicy.h"
+#include "Cesium/TilesetUtility/TilePrefetcher.h"
+#include "Cesium/TilesetUtility/PrefetchViewScheduler.h"
+#include "Cesium/TilesetUtility/LoadConcurrencyController.h"
+#include "Cesium/TilesetUtility/TileOcclusionCuller.h"
 #include "Cesium/Systems/CesiumSystem.h"
+#include "Cesium/Systems/SnapshotAssetAccessor.h"
+#include "Cesium/Systems/ResponseSamplingAssetAccessor.h"
 #include "Cesium/Math/BoundingVolumeConverters.h"
 #include <Cesium/Math/MathHelper.h>
 #include <Cesium/Math/MathReflect.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/JSON/rapidjson.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <variant>
 #include <vector>
 
 // Window 10 wingdi.h header defines OPAQUE macro which mess up with CesiumGltf::Material::AlphaMode::OPAQUE.
@@ -23,6 +43,7 @@
 #endif
 
 #include <Cesium3DTilesSelection/Tileset.h>
+#include <Cesium3DTilesSelection/TileIdUtilities.h>
 #include <Cesium3DTilesSelection/TilesetExternals.h>
 #include <Cesium3DTilesSelection/RasterOverlay.h>
 
@@ -40,15 +61,39 @@ namespace Cesium
             TilesetConfigChange = 1 << 1,
             SourceChange = 1 << 2,
             TransformChange = 1 << 3,
-            AllChange = TilesetConfigChange | SourceChange | TransformChange
+            RenderConfigChange = 1 << 4,
+            ScreenSpaceErrorChange = 1 << 5,
+            TileLoadsChange = 1 << 6,
+            AllChange =
+                TilesetConfigChange | SourceChange | TransformChange | RenderConfigChange | ScreenSpaceErrorChange | TileLoadsChange
         };
 
         Impl(const AZ::EntityId& selfEntity, const TilesetSource& tilesetSource, const TilesetRenderConfiguration& renderConfiguration)
             : m_selfEntity{ selfEntity }
+            , m_loadBegin{}
             , m_absToRelWorld{ 1.0 }
             , m_configFlags{ ConfigurationDirtyFlags::None }
             , m_tilesetLoaded{ false }
+            , m_visibilityOutdated{ false }
+            , m_memoryBudgetConsumer{ 0 }
+            , m_prefetchBudgetConsumer{ 0 }
+            , m_loadSlotConsumer{ 0 }
+            , m_occluderSource{ 0 }
+            , m_viewportDetailVersion{ 0 }
+            , m_screenContribution{ 0.0 }
+            , m_culledTileFraction{ 0.0 }
+            , m_cacheScale{ 1.0 }
+            , m_loadScale{ 1.0 }
+            , m_timeToFirstFullDetail{ -1.0f }
         {
+            if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+            {
+                m_memoryBudgetConsumer = cesiumSystem->GetMemoryBudget().AddConsumer();
+                m_prefetchBudgetConsumer = cesiumSystem->GetMemoryBudget().AddConsumer();
+                m_loadSlotConsumer = cesiumSystem->GetLoadSlotArbiter().AddConsumer();
+                m_occluderSource = cesiumSystem->GetTileOccluderRegistry().AddSource();
+            }
+
             // mark all configs to be dirty so that tileset will be updated with the current config accordingly
             m_configFlags = Impl::ConfigurationDirtyFlags::AllChange;
 
@@ -62,8 +107,16 @@ namespace Cesium
         {
             RasterOverlayContainerRequestBus::Handler::BusDisconnect();
             m_rasterOverlayContainerUnloadedEvent.Signal();
+            SaveStartupSnapshot();
             m_tileset.reset();
             m_renderResourcesPreparer.reset();
+            if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+            {
+                cesiumSystem->GetMemoryBudget().RemoveConsumer(m_memoryBudgetConsumer);
+                cesiumSystem->GetMemoryBudget().RemoveConsumer(m_prefetchBudgetConsumer);
+                cesiumSystem->GetLoadSlotArbiter().RemoveConsumer(m_loadSlotConsumer);
+                cesiumSystem->GetTileOccluderRegistry().RemoveSource(m_occluderSource);
+            }
         }
 
         void LoadTileset(const TilesetSource& tilesetSource, const TilesetRenderConfiguration& renderConfiguration)
@@ -71,9 +124,28 @@ namespace Cesium
             TilesetSourceType type = tilesetSource.GetType();
             if (type != TilesetSourceType::None)
             {
+                m_viewUpdateCache.Invalidate();
+                m_frameCredits.clear();
                 m_tilesetLoaded = false;
+                m_visibilityOutdated = false;
                 m_rasterOverlayContainerUnloadedEvent.Signal();
+                SaveStartupSnapshot();
                 m_tileset.reset();
+                m_responseSampler.reset();
+                m_snapshotAccessor.reset();
+                m_snapshotPath.clear();
+                m_lastRenderedTiles.clear();
+                m_timeToFirstFullDetail = -1.0f;
+                m_memoryTracker.SetLiveBytes(MemoryCategory::DecodedTiles, 0);
+                m_debugVisualizer.Reset();
+                m_cacheTrimPolicy.Reset();
+                m_tilePrefetcher.Reset();
+                m_prefetchViewScheduler.Reset();
+                m_screenContribution = 0.0;
+                m_culledTileFraction = 0.0;
+
+                // the time to first full detail starts with the load, after the previous tileset is released
+                m_loadBegin = std::chrono::steady_clock::now();
             }
 
             switch (type)
@@ -97,18 +169,34 @@ namespace Cesium
             }
         }
 
-        Cesium3DTilesSelection::TilesetExternals CreateTilesetExternal(IOKind kind)
+        Cesium3DTilesSelection::TilesetExternals CreateTilesetExternal(
+            IOKind kind, const TilesetRenderConfiguration& renderConfiguration, const AZStd::string& snapshotSource)
         {
             // create render resources preparer if not exist
             AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor =
                 AZ::RPI::Scene::GetFeatureProcessorForEntity<AZ::Render::MeshFeatureProcessorInterface>(m_selfEntity);
-            m_renderResourcesPreparer = std::make_shared<RenderResourcesPreparer>(meshFeatureProcessor);
+            m_renderResourcesPreparer = std::make_shared<RenderResourcesPreparer>(meshFeatureProcessor, &m_memoryTracker);
+            m_asyncSystem.emplace(CesiumInterface::Get()->GetTaskProcessor());
+            m_creditSystem = CesiumInterface::Get()->GetCreditSystem();
+
+            // the responses restored from the snapshot are not sampled, since they say nothing about the link
+            m_responseSampler = std::make_shared<ResponseSamplingAssetAccessor>(CesiumInterface::Get()->GetAssetAccessor(kind));
+            std::shared_ptr<CesiumAsync::IAssetAccessor> assetAccessor = m_responseSampler;
+            if (renderConfiguration.m_startupSnapshot && !snapshotSource.empty())
+            {
+                // the snapshot of a tileset is named after its source, so the next session finds it again
+                unsigned long long sourceHash = static_cast<unsigned long long>(AZStd::hash<AZStd::string>{}(snapshotSource));
+                m_snapshotPath = AZStd::string::format("@user@/Cesium/Snapshots/%016llx.snapshot", sourceHash);
+                m_snapshotAccessor = std::make_shared<SnapshotAssetAccessor>(assetAccessor, renderConfiguration.m_maximumSnapshotBytes);
+                RestoreStartupSnapshot();
+                assetAccessor = m_snapshotAccessor;
+            }
 
             return Cesium3DTilesSelection::TilesetExternals{
-                CesiumInterface::Get()->GetAssetAccessor(kind),
+                assetAccessor,
                 m_renderResourcesPreparer,
-                CesiumAsync::AsyncSystem(CesiumInterface::Get()->GetTaskProcessor()),
-                CesiumInterface::Get()->GetCreditSystem(),
+                *m_asyncSystem,
+                m_creditSystem,
                 CesiumInterface::Get()->GetLogger(),
             };
         }
@@ -120,7 +208,8 @@ namespace Cesium
                 return;
             }
 
-            Cesium3DTilesSelection::TilesetExternals externals = CreateTilesetExternal(IOKind::LocalFile);
+            Cesium3DTilesSelection::TilesetExternals externals =
+                CreateTilesetExternal(IOKind::LocalFile, renderConfiguration, source.m_filePath);
             Cesium3DTilesSelection::TilesetOptions options;
             options.contentOptions.generateMissingNormalsSmooth = renderConfiguration.m_generateMissingNormalAsSmooth;
             m_tileset = AZStd::make_unique<Cesium3DTilesSelection::Tileset>(externals, source.m_filePath.c_str(), options);
@@ -133,7 +222,7 @@ namespace Cesium
                 return;
             }
 
-            Cesium3DTilesSelection::TilesetExternals externals = CreateTilesetExternal(IOKind::Http);
+            Cesium3DTilesSelection::TilesetExternals externals = CreateTilesetExternal(IOKind::Http, renderConfiguration, source.m_url);
             Cesium3DTilesSelection::TilesetOptions options;
             options.contentOptions.generateMissingNormalsSmooth = renderConfiguration.m_generateMissingNormalAsSmooth;
             m_tileset = AZStd::make_unique<Cesium3DTilesSelection::Tileset>(externals, source.m_url.c_str(), options);
@@ -146,7 +235,8 @@ namespace Cesium
                 return;
             }
 
-            Cesium3DTilesSelection::TilesetExternals externals = CreateTilesetExternal(IOKind::Http);
+            // the ion endpoint hands out a new token for every session, so it is never restored from a snapshot
+            Cesium3DTilesSelection::TilesetExternals externals = CreateTilesetExternal(IOKind::Http, renderConfiguration, "");
             Cesium3DTilesSelection::TilesetOptions options;
             options.contentOptions.generateMissingNormalsSmooth = renderConfiguration.m_generateMissingNormalAsSmooth;
             m_tileset = AZStd::make_unique<Cesium3DTilesSelection::Tileset>(
@@ -159,6 +249,7 @@ namespace Cesium
             {
                 if (m_renderResourcesPreparer->AddRasterLayer(rasterOverlay.get()))
                 {
+                    m_viewUpdateCache.Invalidate();
                     m_tileset->getOverlays().add(std::move(rasterOverlay));
                     return true;
                 }
@@ -171,6 +262,7 @@ namespace Cesium
         {
             if (m_tileset)
             {
+                m_viewUpdateCache.Invalidate();
                 m_tileset->getOverlays().remove(rasterOverlay);
                 m_renderResourcesPreparer->RemoveRasterLayer(rasterOverlay);
             }
@@ -186,6 +278,26 @@ namespace Cesium
             handler.Connect(m_rasterOverlayContainerUnloadedEvent);
         }
 
+        double GetCacheScale() const override
+        {
+            return m_cacheScale;
+        }
+
+        void BindCacheScaleChangedEvent(RasterOverlayContainerCacheScaleChangedEvent::Handler& handler) override
+        {
+            handler.Connect(m_cacheScaleChangedEvent);
+        }
+
+        double GetLoadScale() const override
+        {
+            return m_loadScale;
+        }
+
+        void BindLoadScaleChangedEvent(RasterOverlayContainerLoadScaleChangedEvent::Handler& handler) override
+        {
+            handler.Connect(m_loadScaleChangedEvent);
+        }
+
         void FlushTilesetSourceChange(const TilesetSource& source, const TilesetRenderConfiguration& renderConfiguration)
         {
             if ((m_configFlags & ConfigurationDirtyFlags::SourceChange) != ConfigurationDirtyFlags::SourceChange)
@@ -215,12 +327,34 @@ namespace Cesium
                 return;
             }
 
+            m_viewUpdateCache.Invalidate();
             glm::dmat4 relTransform = m_absToRelWorld * rootTransform;
             m_renderResourcesPreparer->SetTransform(relTransform);
             m_cameraConfigurations.SetTransform(glm::affineInverse(relTransform));
             m_configFlags = m_configFlags & ~ConfigurationDirtyFlags::TransformChange;
         }
 
+        void FlushRenderConfigurationChange(const TilesetRenderConfiguration& renderConfiguration)
+        {
+            if ((m_configFlags & ConfigurationDirtyFlags::RenderConfigChange) != ConfigurationDirtyFlags::RenderConfigChange)
+            {
+                return;
+            }
+
+            // the prepared models and the recorded responses are updated in place, so no tile is loaded again
+            if (m_renderResourcesPreparer)
+            {
+                m_renderResourcesPreparer->SetRayTracingEnabled(renderConfiguration.m_rayTracingEnabled);
+            }
+
+            if (m_snapshotAccessor)
+            {
+                m_snapshotAccessor->SetMaximumRecordedBytes(renderConfiguration.m_maximumSnapshotBytes);
+            }
+
+            m_configFlags = m_configFlags & ~ConfigurationDirtyFlags::RenderConfigChange;
+        }
+
         void FlushTilesetConfigurationChange(const TilesetConfiguration& tilesetConfiguration)
         {
             if ((m_configFlags & ConfigurationDirtyFlags::TilesetConfigChange) != ConfigurationDirtyFlags::TilesetConfigChange)
@@ -233,15 +367,140 @@ namespace Cesium
                 return;
             }
 
+            m_viewUpdateCache.Invalidate();
+            m_screenSpaceErrorController.Configure(
+                tilesetConfiguration.m_minimumAdaptiveScreenSpaceError, tilesetConfiguration.m_maximumAdaptiveScreenSpaceError,
+                tilesetConfiguration.m_targetFrameTime, tilesetConfiguration.m_mainThreadBudget);
+            // the adaptive screen space error only starts over when the screen space error was changed
+            if ((m_configFlags & ConfigurationDirtyFlags::ScreenSpaceErrorChange) == ConfigurationDirtyFlags::ScreenSpaceErrorChange)
+            {
+                m_screenSpaceErrorController.Reset(tilesetConfiguration.m_maximumScreenSpaceError);
+            }
+
+            m_cacheTrimPolicy.Configure(tilesetConfiguration.m_cacheTrimGracePeriod, tilesetConfiguration.m_cacheTrimDuration);
+            m_tilePrefetcher.Configure(tilesetConfiguration.m_prefetchLookAhead, tilesetConfiguration.m_maximumPrefetchBytes);
+            m_loadConcurrencyController.Configure(
+                tilesetConfiguration.m_minimumAdaptiveTileLoads, tilesetConfiguration.m_maximumAdaptiveTileLoads);
+            m_occlusionCuller.Configure(
+                tilesetConfiguration.m_horizonCulling, tilesetConfiguration.m_occlusionCulling, tilesetConfiguration.m_shareOccluders);
+            if (!tilesetConfiguration.m_shareOccluders)
+            {
+                if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+                {
+                    cesiumSystem->GetTileOccluderRegistry().ClearOccluders(m_occluderSource);
+                }
+            }
+            if ((m_configFlags & ConfigurationDirtyFlags::TileLoadsChange) == ConfigurationDirtyFlags::TileLoadsChange)
+            {
+                m_loadConcurrencyController.Reset(tilesetConfiguration.m_maximumSimultaneousTileLoads);
+            }
+
             Cesium3DTilesSelection::TilesetOptions& options = m_tileset->getOptions();
-            options.maximumScreenSpaceError = tilesetConfiguration.m_maximumScreenSpaceError;
-            options.maximumCachedBytes = tilesetConfiguration.m_maximumCacheBytes;
-            options.maximumSimultaneousTileLoads = tilesetConfiguration.m_maximumSimultaneousTileLoads;
+            options.maximumScreenSpaceError = tilesetConfiguration.m_adaptiveScreenSpaceError
+                ? m_screenSpaceErrorController.GetScreenSpaceError()
+                : tilesetConfiguration.m_maximumScreenSpaceError;
+            options.maximumCachedBytes = static_cast<std::int64_t>(UpdateBudgetedCacheBytes(tilesetConfiguration));
             options.loadingDescendantLimit = tilesetConfiguration.m_loadingDescendantLimit;
             options.preloadAncestors = tilesetConfiguration.m_preloadAncestors;
             options.preloadSiblings = tilesetConfiguration.m_preloadSiblings;
             options.forbidHoles = tilesetConfiguration.m_forbidHole;
+            if (m_renderResourcesPreparer)
+            {
+                m_renderResourcesPreparer->GetLoadPipelineThrottle().SetLimits(
+                    tilesetConfiguration.m_maximumPreparedTiles, tilesetConfiguration.m_maximumPreparedBytes);
+            }
+
             m_configFlags = m_configFlags & ~ConfigurationDirtyFlags::TilesetConfigChange;
+            m_configFlags = m_configFlags & ~ConfigurationDirtyFlags::ScreenSpaceErrorChange;
+            m_configFlags = m_configFlags & ~ConfigurationDirtyFlags::TileLoadsChange;
+            ApplySimultaneousTileLoads(tilesetConfiguration);
+        }
+
+        void UpdateSimultaneousTileLoads(const TilesetConfiguration& tilesetConfiguration, float deltaTime)
+        {
+            if (m_renderResourcesPreparer)
+            {
+                m_renderResourcesPreparer->GetLoadPipelineThrottle().Update();
+            }
+
+            // the samples are taken even when the loads are fixed, so turning it on doesn't judge the link on stale responses
+            std::uint32_t peakLoadsInFlight = m_responseSampler ? m_responseSampler->TakeSamples(m_responseSamples) : 0;
+            if (tilesetConfiguration.m_adaptiveTileLoads)
+            {
+                for (const ResponseSample& sample : m_responseSamples)
+                {
+                    m_loadConcurrencyController.RecordResponse(sample.m_latency, sample.m_bytes, sample.m_failed);
+                }
+
+                m_loadConcurrencyController.Update(deltaTime, peakLoadsInFlight);
+            }
+
+            ApplySimultaneousTileLoads(tilesetConfiguration);
+        }
+
+        std::uint32_t GetRequestedTileLoads(const TilesetConfiguration& tilesetConfiguration) const
+        {
+            if (tilesetConfiguration.m_adaptiveTileLoads)
+            {
+                return m_loadConcurrencyController.GetLimit();
+            }
+
+            return tilesetConfiguration.m_maximumSimultaneousTileLoads;
+        }
+
+        void ApplySimultaneousTileLoads(const TilesetConfiguration& tilesetConfiguration)
+        {
+            // the global load slots were shared by the Cesium system at the start of the frame
+            std::uint32_t loads = GetRequestedTileLoads(tilesetConfiguration);
+            if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+            {
+                loads = AZStd::min(loads, cesiumSystem->GetLoadSlotArbiter().GetAllocation(m_loadSlotConsumer));
+            }
+
+            // the tiles prepared in the load threads and not consumed yet take the room of new loads
+            std::uint32_t tileLoads =
+                m_renderResourcesPreparer ? m_renderResourcesPreparer->GetLoadPipelineThrottle().LimitLoads(loads) : loads;
+            if (m_tileset->getOptions().maximumSimultaneousTileLoads != tileLoads)
+            {
+                m_tileset->getOptions().maximumSimultaneousTileLoads = tileLoads;
+                m_viewUpdateCache.Invalidate();
+            }
+
+            // the raster overlays share the link and the load slots of the tileset, so their loads follow in proportion
+            double loadScale = tilesetConfiguration.m_maximumSimultaneousTileLoads > 0
+                ? static_cast<double>(loads) / static_cast<double>(tilesetConfiguration.m_maximumSimultaneousTileLoads)
+                : 1.0;
+            if (loadScale != m_loadScale)
+            {
+                m_loadScale = loadScale;
+                m_loadScaleChangedEvent.Signal(m_loadScale);
+            }
+        }
+
+        void ReportLoadDemand(const TilesetConfiguration& tilesetConfiguration)
+        {
+            if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+            {
+                // the loads in flight and the tiles queued by the last traversal. A skipped traversal repeats the statistics of
+                // the last one, which had no tiles queued
+                TilesetStreamingStatistics statistics = m_streamingStatistics.GetLatest();
+                std::uint32_t pendingLoads = statistics.m_tilesLoadingLowPriority + statistics.m_tilesLoadingMediumPriority +
+                    statistics.m_tilesLoadingHighPriority;
+                pendingLoads += m_responseSampler ? m_responseSampler->GetRequestsInFlight() : 0;
+                std::uint32_t maximumLoads = m_tileset ? GetRequestedTileLoads(tilesetConfiguration) : 0;
+
+                // cesium native still refines and loads the culled tiles, so the loads of the tileset shrink with the share of its
+                // tiles that are culled, and the slots go to the tilesets that can be seen. One load is kept to follow the camera
+                if (m_culledTileFraction > 0.0)
+                {
+                    double visibleFraction = 1.0 - m_culledTileFraction;
+                    std::uint32_t visibleLoads = static_cast<std::uint32_t>(std::ceil(maximumLoads * visibleFraction));
+                    maximumLoads = AZStd::min(maximumLoads, AZStd::max(visibleLoads, 1u));
+                    pendingLoads = static_cast<std::uint32_t>(std::ceil(pendingLoads * visibleFraction));
+                }
+
+                cesiumSystem->GetLoadSlotArbiter().ReportDemand(m_loadSlotConsumer, maximumLoads, pendingLoads, m_screenContribution);
+            }
         }
 
         void NotifyTilesetLoaded()
@@ -262,16 +521,395 @@ namespace Cesium
             }
         }
 
+        bool HasPendingLoads(const Cesium3DTilesSelection::ViewUpdateResult& viewUpdate)
+        {
+            if (viewUpdate.tilesLoadingLowPriority > 0 || viewUpdate.tilesLoadingMediumPriority > 0 ||
+                viewUpdate.tilesLoadingHighPriority > 0)
+            {
+                return true;
+            }
+
+            // tiles prepared in the load threads only finish loading during the traversal
+            TilesetLoadPipelineMetrics pipelineMetrics = m_renderResourcesPreparer->GetLoadPipelineThrottle().GetMetrics();
+            if (pipelineMetrics.m_pipelineDepth > pipelineMetrics.m_strandedTiles)
+            {
+                return true;
+            }
+
+            if (m_tileset->computeLoadProgress() < 100.0f)
+            {
+                return true;
+            }
+
+            // raster overlay tiles are attached during the traversal as well
+            for (const Cesium3DTilesSelection::Tile* tile : viewUpdate.tilesToRenderThisFrame)
+            {
+                for (const auto& mappedRasterTile : tile->getMappedRasterTiles())
+                {
+                    if (mappedRasterTile.getLoadingTile())
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        void RecordFrameCredits(std::size_t previousCreditCount)
+        {
+            // updateView appends the credits of the tileset to the frame, so the new ones are at the end
+            m_frameCredits.clear();
+            if (!m_creditSystem)
+            {
+                return;
+            }
+
+            const auto& credits = m_creditSystem->getCreditsToShowThisFrame();
+            for (std::size_t i = previousCreditCount; i < credits.size(); ++i)
+            {
+                m_frameCredits.emplace_back(credits[i]);
+            }
+        }
+
+        const std::vector<Cesium3DTilesSelection::ViewState>& CombineViewStates(
+            const std::vector<Cesium3DTilesSelection::ViewState>& currentViewStates,
+            const std::vector<Cesium3DTilesSelection::ViewState>& fovealViewStates,
+            const std::vector<Cesium3DTilesSelection::ViewState>& predictedViewStates,
+            const std::vector<Cesium3DTilesSelection::ViewState>& prefetchViewStates)
+        {
+            if (fovealViewStates.empty() && predictedViewStates.empty() && prefetchViewStates.empty())
+            {
+                return currentViewStates;
+            }
+
+            m_selectionViewStates.clear();
+            m_selectionViewStates.insert(m_selectionViewStates.end(), currentViewStates.begin(), currentViewStates.end());
+            m_selectionViewStates.insert(m_selectionViewStates.end(), fovealViewStates.begin(), fovealViewStates.end());
+            m_selectionViewStates.insert(m_selectionViewStates.end(), predictedViewStates.begin(), predictedViewStates.end());
+            m_selectionViewStates.insert(m_selectionViewStates.end(), prefetchViewStates.begin(), prefetchViewStates.end());
+            return m_selectionViewStates;
+        }
+
+        void SkipViewUpdate()
+        {
+            // updateView also runs the main thread continuations, like the raster overlay requests, and adds the credits
+            if (m_asyncSystem)
+            {
+                m_asyncSystem->dispatchMainThreadTasks();
+            }
+
+            if (m_creditSystem)
+            {
+                for (const auto& credit : m_frameCredits)
+                {
+                    m_creditSystem->addCreditToFrame(credit);
+                }
+            }
+
+            TilesetStreamingStatistics frameStatistics = m_streamingStatistics.GetLatest();
+            frameStatistics.m_visibilityToggles = 0;
+            frameStatistics.m_updateViewTime = 0.0f;
+            frameStatistics.m_updateViewSkipped = true;
+            m_streamingStatistics.Push(frameStatistics);
+        }
+
+        void RestoreStartupSnapshot()
+        {
+            // the snapshot of the same source may still be written by the previous tileset
+            AZStd::lock_guard<AZStd::mutex> lock(GetSnapshotFileMutex());
+            AZ::IO::FileIOStream stream(m_snapshotPath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+            if (!stream.IsOpen())
+            {
+                return;
+            }
+
+            std::size_t fileSize = stream.GetLength();
+            IOContent snapshot(fileSize);
+            if (stream.Read(fileSize, snapshot.data()) != fileSize || !m_snapshotAccessor->Restore(snapshot))
+            {
+                AZ_Warning("Cesium", false, "Ignoring the invalid tileset snapshot %s", m_snapshotPath.c_str());
+            }
+        }
+
+        bool SaveStartupSnapshot()
+        {
+            if (!m_snapshotAccessor || !m_tileset || !m_asyncSystem)
+            {
+                return false;
+            }
+
+            std::vector<std::string> visibleTileIds;
+            visibleTileIds.reserve(m_lastRenderedTiles.size());
+            for (const Cesium3DTilesSelection::Tile* tile : m_lastRenderedTiles)
+            {
+                visibleTileIds.emplace_back(Cesium3DTilesSelection::TileIdUtilities::createTileIdString(tile->getTileID()));
+            }
+
+            // in deterministic mode the worker tasks only run when the queue is drained on the next tick, which never comes for the
+            // snapshot saved at shutdown, so it is written right away
+            CesiumSystem* cesiumSystem = CesiumInterface::Get();
+            if (!cesiumSystem || cesiumSystem->GetDeterministicTaskQueue())
+            {
+                WriteStartupSnapshot(*m_snapshotAccessor, m_snapshotPath, visibleTileIds);
+                return true;
+            }
+
+            // the snapshot holds up to the maximum snapshot bytes, so it is created and written by a worker. The accessor is kept
+            // alive by the task, since the tileset may be destroyed before the write is done
+            m_asyncSystem->runInWorkerThread(
+                [snapshotAccessor = m_snapshotAccessor, snapshotPath = m_snapshotPath, visibleTileIds = std::move(visibleTileIds)]()
+                {
+                    WriteStartupSnapshot(*snapshotAccessor, snapshotPath, visibleTileIds);
+                });
+            return true;
+        }
+
+        static void WriteStartupSnapshot(
+            SnapshotAssetAccessor& snapshotAccessor, const AZStd::string& snapshotPath, const std::vector<std::string>& visibleTileIds)
+        {
+            IOContent snapshot = snapshotAccessor.CreateSnapshot(visibleTileIds);
+            AZStd::lock_guard<AZStd::mutex> lock(GetSnapshotFileMutex());
+            AZ::IO::FileIOStream stream(
+                snapshotPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath);
+            if (!stream.IsOpen() || stream.Write(snapshot.size(), snapshot.data()) != snapshot.size())
+            {
+                AZ_Warning("Cesium", false, "Failed to write the tileset snapshot %s", snapshotPath.c_str());
+            }
+        }
+
+        static AZStd::mutex& GetSnapshotFileMutex()
+        {
+            static AZStd::mutex snapshotFileMutex;
+            return snapshotFileMutex;
+        }
+
+        void RecordFullDetail(const Cesium3DTilesSelection::ViewUpdateResult& viewUpdate, bool hasPendingLoads)
+        {
+            if (m_snapshotAccessor)
+            {
+                // the tiles rendered last are the visible tiles of the snapshot, since the tileset may be destroyed before the next frame
+                m_lastRenderedTiles = viewUpdate.tilesToRenderThisFrame;
+            }
+
+            if (m_timeToFirstFullDetail >= 0.0f || hasPendingLoads || viewUpdate.tilesToRenderThisFrame.empty())
+            {
+                return;
+            }
+
+            m_timeToFirstFullDetail = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_loadBegin).count();
+            if (m_snapshotAccessor)
+            {
+                // the restored responses are not revalidated, so the tiles loaded from now on come from the network
+                m_snapshotAccessor->ReleaseRestoredResponses();
+            }
+        }
+
+        std::uint64_t UpdateBudgetedCacheBytes(const TilesetConfiguration& tilesetConfiguration)
+        {
+            // the cache of the tileset and of its raster overlays shrink together when the memory budget gives it less
+            std::uint64_t cacheBytes = tilesetConfiguration.m_maximumCacheBytes;
+            if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+            {
+                cacheBytes = AZStd::min(cacheBytes, cesiumSystem->GetMemoryBudget().GetAllocation(m_memoryBudgetConsumer));
+            }
+
+            double cacheScale = tilesetConfiguration.m_maximumCacheBytes > 0
+                ? static_cast<double>(cacheBytes) / static_cast<double>(tilesetConfiguration.m_maximumCacheBytes)
+                : 1.0;
+            if (cacheScale != m_cacheScale)
+            {
+                m_cacheScale = cacheScale;
+                m_cacheScaleChangedEvent.Signal(m_cacheScale);
+            }
+
+            return cacheBytes;
+        }
+
+        static bool IsTileCullingEnabled(const TilesetConfiguration& tilesetConfiguration)
+        {
+            return tilesetConfiguration.m_horizonCulling || tilesetConfiguration.m_occlusionCulling;
+        }
+
+        void CullRenderedTiles(
+            const TilesetConfiguration& tilesetConfiguration,
+            const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+            const glm::dmat4& transform,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles)
+        {
+            // the occluders of the other tilesets are the ones they built on their last update
+            CesiumSystem* cesiumSystem = CesiumInterface::Get();
+            m_sharedOccluders.clear();
+            if (cesiumSystem && tilesetConfiguration.m_occlusionCulling)
+            {
+                cesiumSystem->GetTileOccluderRegistry().CollectOccluders(m_occluderSource, m_sharedOccluders);
+            }
+
+            m_occlusionCuller.Update(viewStates, transform, renderedTiles, m_sharedOccluders);
+            if (cesiumSystem && tilesetConfiguration.m_shareOccluders)
+            {
+                cesiumSystem->GetTileOccluderRegistry().SubmitOccluders(m_occluderSource, m_occlusionCuller.GetOwnOccluders());
+            }
+
+            m_visibleTiles.clear();
+            for (std::size_t i = 0; i < renderedTiles.size(); ++i)
+            {
+                if (!m_occlusionCuller.IsCulled(i))
+                {
+                    m_visibleTiles.emplace_back(renderedTiles[i]);
+                }
+            }
+
+            m_culledTileFraction = renderedTiles.empty()
+                ? 0.0
+                : 1.0 - static_cast<double>(m_visibleTiles.size()) / static_cast<double>(renderedTiles.size());
+        }
+
+        void UpdateScreenContribution(
+            const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles)
+        {
+            // the fraction of each viewport covered by the bounding spheres of the rendered tiles
+            m_viewportCoverages.assign(viewStates.size(), 0.0);
+            for (const Cesium3DTilesSelection::Tile* tile : renderedTiles)
+            {
+                AZ::Aabb bounds = std::visit(BoundingVolumeToAABB{ glm::dmat4{ 1.0 } }, tile->getBoundingVolume());
+                double radius = 0.5 * static_cast<double>(bounds.GetExtents().GetLength());
+                if (radius <= 0.0)
+                {
+                    continue;
+                }
+
+                for (std::size_t i = 0; i < viewStates.size(); ++i)
+                {
+                    const glm::dvec2& viewportSize = viewStates[i].getViewportSize();
+                    double distance = std::sqrt(viewStates[i].computeDistanceSquaredToBoundingVolume(tile->getBoundingVolume()));
+                    double projectedRadius = viewStates[i].computeScreenSpaceError(radius, AZStd::max(distance, radius));
+                    double coverage = glm::pi<double>() * projectedRadius * projectedRadius / (viewportSize.x * viewportSize.y);
+                    m_viewportCoverages[i] += AZStd::min(coverage, 1.0);
+                }
+            }
+
+            // the coverage is weighted by the priority of the viewport, so the tilesets of a low priority viewport get less of the
+            // memory budget and of the load slots
+            m_screenContribution = 0.0;
+            for (std::size_t i = 0; i < m_viewportCoverages.size(); ++i)
+            {
+                double coverage = m_viewportCoverages[i] * m_cameraConfigurations.GetViewPriority(i);
+                m_screenContribution = AZStd::max(m_screenContribution, AZStd::min(coverage, 1.0));
+            }
+        }
+
+        std::uint64_t UpdateBudgetedPrefetchBytes(const TilesetConfiguration& tilesetConfiguration)
+        {
+            // the tiles kept only for the prefetch views, like the warm camera bookmarks, have their own share of the memory budget
+            std::uint64_t prefetchBytes =
+                AZStd::min(m_prefetchViewScheduler.GetExclusiveBytes(), tilesetConfiguration.m_maximumCacheBytes);
+            if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+            {
+                prefetchBytes = AZStd::min(prefetchBytes, cesiumSystem->GetMemoryBudget().GetAllocation(m_prefetchBudgetConsumer));
+            }
+
+            return prefetchBytes;
+        }
+
+        void ReportMemoryUsage(const TilesetConfiguration& tilesetConfiguration)
+        {
+            if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+            {
+                // the prefetch views don't cover the screen, so their tiles give way to the tiles of the current views
+                std::uint64_t totalBytes = m_tileset ? static_cast<std::uint64_t>(m_tileset->getTotalDataBytes()) : 0;
+                std::uint64_t prefetchBytes = AZStd::min(m_prefetchViewScheduler.GetExclusiveBytes(), totalBytes);
+                cesiumSystem->GetMemoryBudget().ReportUsage(
+                    m_memoryBudgetConsumer, totalBytes - prefetchBytes, tilesetConfiguration.m_maximumCacheBytes, m_screenContribution);
+                cesiumSystem->GetMemoryBudget().ReportUsage(
+                    m_prefetchBudgetConsumer, prefetchBytes,
+                    AZStd::min(m_prefetchViewScheduler.GetExclusiveBytes(), tilesetConfiguration.m_maximumCacheBytes), 0.0);
+            }
+        }
+
+        bool IsDebugVisualizerEnabled() const
+        {
+            return m_debugConfiguration.m_collectTileInfo || m_debugConfiguration.m_drawMode != TilesetDebugDrawMode::None;
+        }
+
+        void UpdateDebugVisualizer(
+            const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+            const glm::dmat4& transform)
+        {
+            const auto rootTile = m_tileset->getRootTile();
+            if (!rootTile)
+            {
+                return;
+            }
+
+            m_debugVisualizer.Update(*rootTile, renderedTiles, viewStates, m_absToRelWorld * transform, std::chrono::steady_clock::now());
+            if (m_debugConfiguration.m_drawMode == TilesetDebugDrawMode::None)
+            {
+                return;
+            }
+
+            AZ::RPI::Scene* scene = AZ::RPI::Scene::GetSceneForEntityId(m_selfEntity);
+            if (!scene)
+            {
+                return;
+            }
+
+            AZ::RPI::AuxGeomDrawPtr auxGeom = AZ::RPI::AuxGeomFeatureProcessorInterface::GetDrawQueueForScene(scene);
+            if (auxGeom)
+            {
+                m_debugVisualizer.Draw(*auxGeom, m_debugConfiguration);
+            }
+        }
+
         AZ::EntityId m_selfEntity;
         TilesetCameraConfigurations m_cameraConfigurations;
+        MemoryTracker m_memoryTracker{ MemoryTrackerInterface::Get() };
         std::shared_ptr<RenderResourcesPreparer> m_renderResourcesPreparer;
         AZStd::unique_ptr<Cesium3DTilesSelection::Tileset> m_tileset;
+        StreamingStatisticsWindow m_streamingStatistics;
+        ScreenSpaceErrorController m_screenSpaceErrorController;
+        CacheTrimPolicy m_cacheTrimPolicy;
+        TilePrefetcher m_tilePrefetcher;
+        PrefetchViewScheduler m_prefetchViewScheduler;
+        LoadConcurrencyController m_loadConcurrencyController;
+        ViewUpdateCache m_viewUpdateCache;
+        TileOcclusionCuller m_occlusionCuller;
+        std::optional<CesiumAsync::AsyncSystem> m_asyncSystem;
+        std::shared_ptr<ResponseSamplingAssetAccessor> m_responseSampler;
+        std::vector<ResponseSample> m_responseSamples;
+        std::shared_ptr<SnapshotAssetAccessor> m_snapshotAccessor;
+        AZStd::string m_snapshotPath;
+        std::vector<Cesium3DTilesSelection::Tile*> m_lastRenderedTiles;
+        std::vector<Cesium3DTilesSelection::Tile*> m_visibleTiles;
+        AZStd::vector<TileOccluder> m_sharedOccluders;
+        std::chrono::steady_clock::time_point m_loadBegin;
+        std::shared_ptr<Cesium3DTilesSelection::CreditSystem> m_creditSystem;
+        std::vector<Cesium3DTilesSelection::Credit> m_frameCredits;
+        TilesetDebugConfiguration m_debugConfiguration;
+        TilesetDebugVisualizer m_debugVisualizer;
         TilesetLoadedEvent m_tilesetLoadedEvent;
         RasterOverlayContainerLoadedEvent m_rasterOverlayContainerLoadedEvent;
         RasterOverlayContainerUnloadedEvent m_rasterOverlayContainerUnloadedEvent;
+        RasterOverlayContainerCacheScaleChangedEvent m_cacheScaleChangedEvent;
+        RasterOverlayContainerLoadScaleChangedEvent m_loadScaleChangedEvent;
+        std::vector<double> m_viewportCoverages;
+        std::vector<Cesium3DTilesSelection::ViewState> m_selectionViewStates;
         glm::dmat4 m_absToRelWorld;
         int m_configFlags;
         bool m_tilesetLoaded;
+        bool m_visibilityOutdated;
+        MemoryBudget::ConsumerId m_memoryBudgetConsumer;
+        MemoryBudget::ConsumerId m_prefetchBudgetConsumer;
+        LoadSlotArbiter::ConsumerId m_loadSlotConsumer;
+        TileOccluderRegistry::SourceId m_occluderSource;
+        std::uint32_t m_viewportDetailVersion;
+        double m_screenContribution;
+        double m_culledTileFraction;
+        double m_cacheScale;
+        double m_loadScale;
+        float m_timeToFirstFullDetail;
     };
 
     void TilesetComponent::Reflect(AZ::ReflectContext* context)
@@ -335,15 +973,34 @@ namespace Cesium
 
     void TilesetComponent::SetConfiguration(const TilesetConfiguration& configration)
     {
+        // the options of the tileset are updated in place, so the tileset is never loaded again
+        if (configration.m_maximumScreenSpaceError != m_tilesetConfiguration.m_maximumScreenSpaceError ||
+            configration.m_adaptiveScreenSpaceError != m_tilesetConfiguration.m_adaptiveScreenSpaceError)
+        {
+            m_impl->m_configFlags |= Impl::ConfigurationDirtyFlags::ScreenSpaceErrorChange;
+        }
+
+        if (configration.m_maximumSimultaneousTileLoads != m_tilesetConfiguration.m_maximumSimultaneousTileLoads ||
+            configration.m_adaptiveTileLoads != m_tilesetConfiguration.m_adaptiveTileLoads)
+        {
+            m_impl->m_configFlags |= Impl::ConfigurationDirtyFlags::TileLoadsChange;
+        }
+
         m_tilesetConfiguration = configration;
         m_impl->m_configFlags |= Impl::ConfigurationDirtyFlags::TilesetConfigChange;
     }
 
     void TilesetComponent::SetRenderConfiguration(const TilesetRenderConfiguration& configration)
     {
-        // render config is special, we need to reload tileset, so that all the caches are clear
+        // only the options used when the tileset is loaded need a reload, so that all the caches are clear
+        if (configration.m_generateMissingNormalAsSmooth != m_renderConfiguration.m_generateMissingNormalAsSmooth ||
+            configration.m_startupSnapshot != m_renderConfiguration.m_startupSnapshot)
+        {
+            m_impl->m_configFlags |= Impl::ConfigurationDirtyFlags::AllChange;
+        }
+
         m_renderConfiguration = configration;
-        m_impl->m_configFlags |= Impl::ConfigurationDirtyFlags::AllChange;
+        m_impl->m_configFlags |= Impl::ConfigurationDirtyFlags::RenderConfigChange;
     }
 
     const TilesetRenderConfiguration& TilesetComponent::GetRenderConfiguration() const
@@ -455,6 +1112,96 @@ namespace Cesium
         handler.Connect(m_impl->m_tilesetLoadedEvent);
     }
 
+    TilesetLoadPipelineMetrics TilesetComponent::GetLoadPipelineMetrics() const
+    {
+        if (!m_impl->m_renderResourcesPreparer)
+        {
+            return TilesetLoadPipelineMetrics{};
+        }
+
+        return m_impl->m_renderResourcesPreparer->GetLoadPipelineThrottle().GetMetrics();
+    }
+
+    TilesetMemoryUsage TilesetComponent::GetMemoryUsage() const
+    {
+        const MemoryTracker& memoryTracker = m_impl->m_memoryTracker;
+        TilesetMemoryUsage usage;
+        usage.m_decodedTileBytes = memoryTracker.GetLiveBytes(MemoryCategory::DecodedTiles);
+        usage.m_peakDecodedTileBytes = memoryTracker.GetPeakBytes(MemoryCategory::DecodedTiles);
+        usage.m_builtAssetBytes = memoryTracker.GetLiveBytes(MemoryCategory::BuiltAssets);
+        usage.m_peakBuiltAssetBytes = memoryTracker.GetPeakBytes(MemoryCategory::BuiltAssets);
+        usage.m_rasterImageBytes = memoryTracker.GetLiveBytes(MemoryCategory::RasterImages);
+        usage.m_peakRasterImageBytes = memoryTracker.GetPeakBytes(MemoryCategory::RasterImages);
+        usage.m_totalBytes = memoryTracker.GetTotalLiveBytes();
+        usage.m_peakTotalBytes = memoryTracker.GetTotalPeakBytes();
+        return usage;
+    }
+
+    TilesetStreamingStatistics TilesetComponent::GetStreamingStatistics() const
+    {
+        return m_impl->m_streamingStatistics.GetLatest();
+    }
+
+    TilesetRollingStreamingStatistics TilesetComponent::GetRollingStreamingStatistics() const
+    {
+        return m_impl->m_streamingStatistics.GetRolling();
+    }
+
+    void TilesetComponent::ResetStreamingStatistics()
+    {
+        m_impl->m_streamingStatistics.Reset();
+    }
+
+    double TilesetComponent::GetEffectiveScreenSpaceError() const
+    {
+        if (!m_impl->m_tileset)
+        {
+            return m_tilesetConfiguration.m_maximumScreenSpaceError;
+        }
+
+        return m_impl->m_tileset->getOptions().maximumScreenSpaceError;
+    }
+
+    bool TilesetComponent::SaveStartupSnapshot()
+    {
+        return m_impl->SaveStartupSnapshot();
+    }
+
+    float TilesetComponent::GetTimeToFirstFullDetail() const
+    {
+        return m_impl->m_timeToFirstFullDetail;
+    }
+
+    std::uint32_t TilesetComponent::GetEffectiveSimultaneousTileLoads() const
+    {
+        if (!m_impl->m_tileset)
+        {
+            return m_tilesetConfiguration.m_maximumSimultaneousTileLoads;
+        }
+
+        return m_impl->m_tileset->getOptions().maximumSimultaneousTileLoads;
+    }
+
+    void TilesetComponent::SetDebugConfiguration(const TilesetDebugConfiguration& debugConfiguration)
+    {
+        m_impl->m_debugConfiguration = debugConfiguration;
+        m_impl->m_viewUpdateCache.Invalidate();
+        if (!m_impl->IsDebugVisualizerEnabled())
+        {
+            m_impl->m_debugVisualizer.Reset();
+        }
+    }
+
+    const TilesetDebugConfiguration& TilesetComponent::GetDebugConfiguration() const
+    {
+        return m_impl->m_debugConfiguration;
+    }
+
+    AZStd::vector<TilesetDebugTileInfo> TilesetComponent::GetDebugTileInfos() const
+    {
+        return m_impl->m_debugVisualizer.GetTileInfos();
+    }
+
     void TilesetComponent::ApplyTransformToRoot(const glm::dmat4& transform)
     {
         m_transform = transform;
@@ -464,11 +1211,14 @@ namespace Cesium
 
     void TilesetComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        auto tickBegin = std::chrono::steady_clock::now();
         m_impl->FlushTilesetSourceChange(m_tilesetSource, m_renderConfiguration);
+        m_impl->FlushRenderConfigurationChange(m_renderConfiguration);
         m_impl->FlushTilesetConfigurationChange(m_tilesetConfiguration);
         m_impl->FlushTransformChange(m_transform);
         m_impl->NotifyTilesetLoaded();
 
+        const std::vector<Cesium3DTilesSelection::ViewState>& prefetchViewStates = m_impl->m_cameraConfigurations.GetPrefetchViewStates();
         if (m_impl->m_tileset)
         {
             // update view tileset
@@ -476,7 +1226,7 @@ namespace Cesium
 
             if (!viewStates.empty())
             {
-                // check if the root is visible. If it's not, then we should remove all the cache
+                // check if the root is visible. If it's not for a while, the cache is trimmed
                 const auto rootTile = m_impl->m_tileset->getRootTile();
                 if (rootTile)
                 {
@@ -490,38 +1240,209 @@ namespace Cesium
                         }
                     }
 
-                    if (!isTilesetVisible)
+                    MemoryPressure pressure =
+                        CesiumInterface::Get() ? CesiumInterface::Get()->GetMemoryBudget().GetStatus().m_pressure : MemoryPressure::Normal;
+                    std::uint64_t budgetedCacheBytes = m_impl->UpdateBudgetedCacheBytes(m_tilesetConfiguration);
+                    // the tiles kept for the prefetch views are not trimmed with the rest, within their own share of the budget
+                    std::int64_t maximumCachedBytes = static_cast<std::int64_t>(
+                        m_impl->m_cacheTrimPolicy.Update(isTilesetVisible, deltaTime, pressure, budgetedCacheBytes) +
+                        m_impl->UpdateBudgetedPrefetchBytes(m_tilesetConfiguration));
+                    if (m_impl->m_tileset->getOptions().maximumCachedBytes != maximumCachedBytes)
                     {
-                        m_impl->m_tileset->getOptions().maximumCachedBytes = 0;
+                        m_impl->m_tileset->getOptions().maximumCachedBytes = maximumCachedBytes;
+                        m_impl->m_viewUpdateCache.Invalidate();
+                    }
+                }
+            }
+
+            m_impl->m_prefetchViewScheduler.SyncViews(
+                m_impl->m_cameraConfigurations.GetPrefetchViewsVersion(), prefetchViewStates.size());
+
+            // the view update cache only compares the current views, so the foveal views moving with the gaze point invalidate it
+            const std::vector<Cesium3DTilesSelection::ViewState>& fovealViewStates = m_impl->m_cameraConfigurations.GetFovealViewStates();
+            std::uint32_t viewportDetailVersion = m_impl->m_cameraConfigurations.GetViewportDetailVersion();
+            if (m_impl->m_viewportDetailVersion != viewportDetailVersion)
+            {
+                m_impl->m_viewportDetailVersion = viewportDetailVersion;
+                m_impl->m_viewUpdateCache.Invalidate();
+            }
+
+            // the prefetch views only need the traversal while their tiles are loading
+            bool selectPrefetchViews = !prefetchViewStates.empty() && m_impl->m_prefetchViewScheduler.ShouldSelectPrefetchViews();
+            if (m_impl->m_viewUpdateCache.CanSkipUpdate(viewStates) &&
+                (!selectPrefetchViews || m_impl->m_prefetchViewScheduler.AreViewsReady()))
+            {
+                // the cameras are parked and every tile is loaded, so the traversal would select the same tiles
+                m_impl->SkipViewUpdate();
+            }
+            else if (!viewStates.empty())
+            {
+                // the tiles of the predicted views are selected as well, so they start loading before the cameras get there
+                static const std::vector<Cesium3DTilesSelection::ViewState> noViewStates;
+                const std::vector<Cesium3DTilesSelection::ViewState>* predictedViewStates = &noViewStates;
+                if (m_tilesetConfiguration.m_predictivePrefetch && m_impl->m_tilePrefetcher.GetLookAhead() > 0.0f)
+                {
+                    predictedViewStates = &m_impl->m_cameraConfigurations.GetPredictedViewStates(m_impl->m_tilePrefetcher.GetLookAhead());
+                }
+
+                const std::vector<Cesium3DTilesSelection::ViewState>& selectionViewStates =
+                    m_impl->CombineViewStates(
+                        viewStates, fovealViewStates, *predictedViewStates, selectPrefetchViews ? prefetchViewStates : noViewStates);
+
+                // retrieve tiles are visible in the current frame
+                std::size_t previousCreditCount =
+                    m_impl->m_creditSystem ? m_impl->m_creditSystem->getCreditsToShowThisFrame().size() : 0;
+                auto updateViewBegin = std::chrono::steady_clock::now();
+                const Cesium3DTilesSelection::ViewUpdateResult& viewUpdate = m_impl->m_tileset->updateView(selectionViewStates);
+                auto updateViewEnd = std::chrono::steady_clock::now();
+                m_impl->RecordFrameCredits(previousCreditCount);
+
+                bool hasPendingLoads = m_impl->HasPendingLoads(viewUpdate);
+                TilesetStreamingStatistics frameStatistics = m_impl->m_streamingStatistics.GetLatest();
+                if (selectPrefetchViews)
+                {
+                    // the selection with the prefetch views only drives their loads. The rendered tiles are left as the current
+                    // views selected them, so the level of detail doesn't alternate between the frames with and without them
+                    m_impl->m_visibilityOutdated = true;
+                    m_impl->m_prefetchViewScheduler.UpdateReadiness(
+                        prefetchViewStates, viewStates, viewUpdate.tilesToRenderThisFrame, m_impl->m_tileset->getRootTile(),
+                        m_impl->m_tileset->getOptions().maximumScreenSpaceError);
+                    frameStatistics.m_visibilityToggles = 0;
+                }
+                else
+                {
+                    // after a selection with the prefetch views, the tiles to no longer render are relative to it instead of the
+                    // tiles that are visible
+                    std::uint32_t visibilityToggles = 0;
+                    if (m_impl->m_visibilityOutdated)
+                    {
+                        m_impl->m_visibilityOutdated = false;
+                        visibilityToggles += m_impl->m_renderResourcesPreparer->HideUnselectedModels(viewUpdate.tilesToRenderThisFrame);
                     }
                     else
                     {
-                        m_impl->m_tileset->getOptions().maximumCachedBytes = m_tilesetConfiguration.m_maximumCacheBytes;
+                        for (Cesium3DTilesSelection::Tile* tile : viewUpdate.tilesToNoLongerRenderThisFrame)
+                        {
+                            if (tile->getState() == Cesium3DTilesSelection::Tile::LoadState::Done)
+                            {
+                                void* renderResources = tile->getRendererResources();
+                                visibilityToggles += m_impl->m_renderResourcesPreparer->SetVisible(renderResources, false) ? 1 : 0;
+                            }
+                        }
                     }
-                }
 
-                // retrieve tiles are visible in the current frame
-                const Cesium3DTilesSelection::ViewUpdateResult& viewUpdate = m_impl->m_tileset->updateView(viewStates);
+                    // the culled tiles stay selected by cesium native, so they lower the load slots and the memory budget of the
+                    // tileset instead. Sharing the occluders alone only builds them, without the culling tests
+                    bool cullTiles = Impl::IsTileCullingEnabled(m_tilesetConfiguration);
+                    m_impl->m_culledTileFraction = 0.0;
+                    if (cullTiles || m_tilesetConfiguration.m_shareOccluders)
+                    {
+                        m_impl->CullRenderedTiles(m_tilesetConfiguration, viewStates, m_transform, viewUpdate.tilesToRenderThisFrame);
+                    }
 
-                for (Cesium3DTilesSelection::Tile* tile : viewUpdate.tilesToNoLongerRenderThisFrame)
-                {
-                    if (tile->getState() == Cesium3DTilesSelection::Tile::LoadState::Done)
+                    const std::vector<Cesium3DTilesSelection::Tile*>& visibleTiles =
+                        cullTiles ? m_impl->m_visibleTiles : viewUpdate.tilesToRenderThisFrame;
+                    for (std::size_t i = 0; i < viewUpdate.tilesToRenderThisFrame.size(); ++i)
                     {
-                        void* renderResources = tile->getRendererResources();
-                        m_impl->m_renderResourcesPreparer->SetVisible(renderResources, false);
+                        Cesium3DTilesSelection::Tile* tile = viewUpdate.tilesToRenderThisFrame[i];
+                        if (tile->getState() == Cesium3DTilesSelection::Tile::LoadState::Done)
+                        {
+                            bool isVisible = !cullTiles || !m_impl->m_occlusionCuller.IsCulled(i);
+                            void* renderResources = tile->getRendererResources();
+                            visibilityToggles += m_impl->m_renderResourcesPreparer->SetVisible(renderResources, isVisible) ? 1 : 0;
+                        }
                     }
-                }
 
-                for (Cesium3DTilesSelection::Tile* tile : viewUpdate.tilesToRenderThisFrame)
-                {
-                    if (tile->getState() == Cesium3DTilesSelection::Tile::LoadState::Done)
+                    if (m_impl->IsDebugVisualizerEnabled())
+                    {
+                        m_impl->UpdateDebugVisualizer(viewStates, viewUpdate.tilesToRenderThisFrame, m_transform);
+                    }
+
+                    m_impl->UpdateScreenContribution(viewStates, visibleTiles);
+
+                    if (m_tilesetConfiguration.m_predictivePrefetch)
+                    {
+                        m_impl->m_tilePrefetcher.Update(viewStates, *predictedViewStates, viewUpdate.tilesToRenderThisFrame);
+                    }
+
+                    m_impl->RecordFullDetail(viewUpdate, hasPendingLoads);
+
+                    frameStatistics.m_tilesRendered = static_cast<std::uint32_t>(visibleTiles.size());
+                    frameStatistics.m_visibilityToggles = visibilityToggles;
+                    frameStatistics.m_tilesPrefetched = 0;
+                    frameStatistics.m_bytesPrefetched = 0;
+                    if (m_tilesetConfiguration.m_predictivePrefetch)
+                    {
+                        frameStatistics.m_tilesPrefetched = m_impl->m_tilePrefetcher.GetPrefetchedTileCount();
+                        frameStatistics.m_bytesPrefetched = m_impl->m_tilePrefetcher.GetPrefetchedBytes();
+                    }
+
+                    frameStatistics.m_tilesHorizonCulled = 0;
+                    frameStatistics.m_tilesOcclusionCulled = 0;
+                    frameStatistics.m_occlusionCullingTime = 0.0f;
+                    if (cullTiles)
                     {
-                        void* renderResources = tile->getRendererResources();
-                        m_impl->m_renderResourcesPreparer->SetVisible(renderResources, true);
+                        frameStatistics.m_tilesHorizonCulled = m_impl->m_occlusionCuller.GetHorizonCulledTileCount();
+                        frameStatistics.m_tilesOcclusionCulled = m_impl->m_occlusionCuller.GetOcclusionCulledTileCount();
+                        frameStatistics.m_occlusionCullingTime = m_impl->m_occlusionCuller.GetCullingTime();
                     }
+
+                    // the selection also holds the tiles of the predicted views, so it can't be kept when they are gone. The foveal
+                    // views stay with the cameras
+                    m_impl->m_viewUpdateCache.RecordUpdate(
+                        viewStates, hasPendingLoads || selectionViewStates.size() != viewStates.size() + fovealViewStates.size());
+                }
+
+                m_impl->m_prefetchViewScheduler.RecordFrame(selectPrefetchViews, hasPendingLoads);
+
+                frameStatistics.m_tilesVisited = viewUpdate.tilesVisited;
+                frameStatistics.m_culledTilesVisited = viewUpdate.culledTilesVisited;
+                frameStatistics.m_tilesCulled = viewUpdate.tilesCulled;
+                frameStatistics.m_maxDepthVisited = viewUpdate.maxDepthVisited;
+                frameStatistics.m_tilesLoadingLowPriority = viewUpdate.tilesLoadingLowPriority;
+                frameStatistics.m_tilesLoadingMediumPriority = viewUpdate.tilesLoadingMediumPriority;
+                frameStatistics.m_tilesLoadingHighPriority = viewUpdate.tilesLoadingHighPriority;
+                frameStatistics.m_mainThreadQueueLength =
+                    m_impl->m_renderResourcesPreparer->GetLoadPipelineThrottle().GetMetrics().m_pipelineDepth;
+                frameStatistics.m_bytesCached = static_cast<std::uint64_t>(m_impl->m_tileset->getTotalDataBytes());
+                frameStatistics.m_updateViewTime = std::chrono::duration<float, std::milli>(updateViewEnd - updateViewBegin).count();
+                frameStatistics.m_updateViewSkipped = false;
+                m_impl->m_streamingStatistics.Push(frameStatistics);
+            }
+
+            // cesium native owns the decoded tile content, so its size is sampled once per frame
+            m_impl->m_memoryTracker.SetLiveBytes(
+                MemoryCategory::DecodedTiles, static_cast<std::uint64_t>(m_impl->m_tileset->getTotalDataBytes()));
+
+            if (m_tilesetConfiguration.m_adaptiveScreenSpaceError)
+            {
+                // the main thread preparation of the loaded tiles happens in updateView, so the whole tick is counted
+                float mainThreadTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - tickBegin).count();
+                double screenSpaceError = m_impl->m_screenSpaceErrorController.Update(deltaTime * 1000.0f, mainThreadTime);
+                if (m_impl->m_tileset->getOptions().maximumScreenSpaceError != screenSpaceError)
+                {
+                    m_impl->m_tileset->getOptions().maximumScreenSpaceError = screenSpaceError;
+                    m_impl->m_viewUpdateCache.Invalidate();
                 }
             }
+
+            m_impl->UpdateSimultaneousTileLoads(m_tilesetConfiguration, deltaTime);
         }
+
+        // a tileset still loading its root doesn't know the tiles of the views yet, so they can't be ready before it
+        bool tilesetLoading = m_tilesetSource.GetType() != TilesetSourceType::None && !m_impl->m_tilesetLoaded;
+        for (std::size_t i = 0; i < prefetchViewStates.size(); ++i)
+        {
+            if (tilesetLoading || !m_impl->m_prefetchViewScheduler.IsViewReady(i))
+            {
+                m_impl->m_cameraConfigurations.ReportPrefetchPending(i);
+            }
+
+            m_impl->m_cameraConfigurations.ReportPrefetchBytes(i, m_impl->m_prefetchViewScheduler.GetViewBytes(i));
+        }
+
+        m_impl->ReportMemoryUsage(m_tilesetConfiguration);
+        m_impl->ReportLoadDemand(m_tilesetConfiguration);
     }
 
     void TilesetComponent::OnOriginShifting(const glm::dmat4& absToRelWorld)
@@ -0,0 +1,90 @@
+#include <Cesium/EBus/CameraBookmarkBus.h>
+#include <Cesium/Math/MathReflect.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace Cesium
+{
+    CameraBookmarkStatus::CameraBookmarkStatus()
+        : m_state{ CameraBookmarkState::Cold }
+        , m_loadedBytes{ 0 }
+        , m_memoryBudgetBytes{ 0 }
+        , m_keepWarm{ false }
+    {
+    }
+
+    void CameraBookmarkStatus::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<CameraBookmarkStatus>()
+                ->Version(0)
+                ->Field("State", &CameraBookmarkStatus::m_state)
+                ->Field("LoadedBytes", &CameraBookmarkStatus::m_loadedBytes)
+                ->Field("MemoryBudgetBytes", &CameraBookmarkStatus::m_memoryBudgetBytes)
+                ->Field("KeepWarm", &CameraBookmarkStatus::m_keepWarm);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Enum<static_cast<int>(CameraBookmarkState::Cold)>("CameraBookmarkState_Cold")
+                ->Enum<static_cast<int>(CameraBookmarkState::Preloading)>("CameraBookmarkState_Preloading")
+                ->Enum<static_cast<int>(CameraBookmarkState::Ready)>("CameraBookmarkState_Ready")
+                ->Enum<static_cast<int>(CameraBookmarkState::OverBudget)>("CameraBookmarkState_OverBudget");
+
+            auto getState = [](CameraBookmarkStatus* status) -> int
+            {
+                return static_cast<int>(status->m_state);
+            };
+
+            behaviorContext->Class<CameraBookmarkStatus>("CameraBookmarkStatus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Camera")
+                ->Property("State", getState, nullptr)
+                ->Property("LoadedBytes", BehaviorValueGetter(&CameraBookmarkStatus::m_loadedBytes), nullptr)
+                ->Property("MemoryBudgetBytes", BehaviorValueGetter(&CameraBookmarkStatus::m_memoryBudgetBytes), nullptr)
+                ->Property("KeepWarm", BehaviorValueGetter(&CameraBookmarkStatus::m_keepWarm), nullptr);
+        }
+    }
+
+    void CameraBookmarkRequest::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->EBus<CameraBookmarkRequestBus>("CameraBookmarkRequestBus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Camera")
+                ->Event(
+                    "AddCameraBookmark", &CameraBookmarkRequestBus::Events::AddCameraBookmark,
+                    { AZ::BehaviorParameterOverrides("Name"), AZ::BehaviorParameterOverrides("ECEFPosition"),
+                      AZ::BehaviorParameterOverrides("ECEFDirection"), AZ::BehaviorParameterOverrides("ECEFUp"),
+                      AZ::BehaviorParameterOverrides("MemoryBudgetBytes"), AZ::BehaviorParameterOverrides("KeepWarm") })
+                ->Event(
+                    "AddCameraBookmarkFromCamera", &CameraBookmarkRequestBus::Events::AddCameraBookmarkFromCamera,
+                    { AZ::BehaviorParameterOverrides("Name"), AZ::BehaviorParameterOverrides("CameraEntityId"),
+                      AZ::BehaviorParameterOverrides("MemoryBudgetBytes"), AZ::BehaviorParameterOverrides("KeepWarm") })
+                ->Event("RemoveCameraBookmark", &CameraBookmarkRequestBus::Events::RemoveCameraBookmark)
+                ->Event("GetCameraBookmarkNames", &CameraBookmarkRequestBus::Events::GetCameraBookmarkNames)
+                ->Event("PreloadCameraBookmark", &CameraBookmarkRequestBus::Events::PreloadCameraBookmark)
+                ->Event("ReleaseCameraBookmark", &CameraBookmarkRequestBus::Events::ReleaseCameraBookmark)
+                ->Event("IsCameraBookmarkReady", &CameraBookmarkRequestBus::Events::IsCameraBookmarkReady)
+                ->Event("GetCameraBookmarkStatus", &CameraBookmarkRequestBus::Events::GetCameraBookmarkStatus)
+                ->Event(
+                    "JumpToCameraBookmark", &CameraBookmarkRequestBus::Events::JumpToCameraBookmark,
+                    { AZ::BehaviorParameterOverrides("Name"), AZ::BehaviorParameterOverrides("CameraEntityId") });
+        }
+    }
+
+    void CameraBookmarkNotificationEBusHandler::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->EBus<CameraBookmarkNotificationBus>("CameraBookmarkNotificationBus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Camera")
+                ->Handler<CameraBookmarkNotificationEBusHandler>()
+                ->Event("OnCameraBookmarkReady", &CameraBookmarkNotificationBus::Events::OnCameraBookmarkReady);
+        }
+    }
+
+    void CameraBookmarkNotificationEBusHandler::OnCameraBookmarkReady(const AZStd::string& name)
+    {
+        Call(FN_OnCameraBookmarkReady, name);
+    }
+} // namespace Cesium
@@ -76,7 +76,12 @@ namespace Cesium
                     "FlyToECEFLocationWithConfiguration",
                     &GeoReferenceCameraFlyControllerRequestBus::Events::FlyToECEFLocationWithConfiguration,
                     { AZ::BehaviorParameterOverrides("ECEFLocation"), AZ::BehaviorParameterOverrides("ECEFDirection"),
-                      AZ::BehaviorParameterOverrides("FlyConfiguration") });
+                      AZ::BehaviorParameterOverrides("FlyConfiguration") })
+                ->Event("SetPrefetchDestination", &GeoReferenceCameraFlyControllerRequestBus::Events::SetPrefetchDestination)
+                ->Event("GetPrefetchDestination", &GeoReferenceCameraFlyControllerRequestBus::Events::GetPrefetchDestination)
+                ->Event("SetPrefetchWaypointCount", &GeoReferenceCameraFlyControllerRequestBus::Events::SetPrefetchWaypointCount)
+                ->Event("GetPrefetchWaypointCount", &GeoReferenceCameraFlyControllerRequestBus::Events::GetPrefetchWaypointCount)
+                ->Event("IsDestinationReady", &GeoReferenceCameraFlyControllerRequestBus::Events::IsDestinationReady);
         }
     }
 } // namespace Cesium
@@ -0,0 +1,195 @@
+#include <Cesium/EBus/HttpMetricsBus.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+
+namespace Cesium
+{
+    HttpHistogram::HttpHistogram()
+        : m_buckets(BUCKET_COUNT, 0)
+        , m_count{ 0 }
+        , m_sum{ 0 }
+        , m_max{ 0 }
+    {
+    }
+
+    void HttpHistogram::Add(std::uint64_t value)
+    {
+        std::size_t bucket = 0;
+        while (bucket < BUCKET_COUNT - 1 && (value >> bucket) != 0)
+        {
+            ++bucket;
+        }
+
+        ++m_buckets[bucket];
+        ++m_count;
+        m_sum += value;
+        m_max = AZStd::max(m_max, value);
+    }
+
+    double HttpHistogram::GetMean() const
+    {
+        if (m_count == 0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(m_sum) / static_cast<double>(m_count);
+    }
+
+    std::uint64_t HttpHistogram::GetPercentile(double percentile) const
+    {
+        if (m_count == 0)
+        {
+            return 0;
+        }
+
+        double clampedPercentile = AZStd::clamp(percentile, 0.0, 1.0);
+        std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(clampedPercentile * static_cast<double>(m_count)));
+        rank = AZStd::max(rank, std::uint64_t{ 1 });
+        std::uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < m_buckets.size(); ++bucket)
+        {
+            seen += m_buckets[bucket];
+            if (seen >= rank)
+            {
+                std::uint64_t upperBound = bucket == 0 ? 0 : (std::uint64_t{ 1 } << bucket) - 1;
+                return AZStd::min(upperBound, m_max);
+            }
+        }
+
+        return m_max;
+    }
+
+    void HttpHistogram::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<HttpHistogram>()
+                ->Version(0)
+                ->Field("Buckets", &HttpHistogram::m_buckets)
+                ->Field("Count", &HttpHistogram::m_count)
+                ->Field("Sum", &HttpHistogram::m_sum)
+                ->Field("Max", &HttpHistogram::m_max);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<HttpHistogram>("HttpHistogram")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Http")
+                ->Property("Buckets", BehaviorValueGetter(&HttpHistogram::m_buckets), nullptr)
+                ->Property("Count", BehaviorValueGetter(&HttpHistogram::m_count), nullptr)
+                ->Property("Sum", BehaviorValueGetter(&HttpHistogram::m_sum), nullptr)
+                ->Property("Max", BehaviorValueGetter(&HttpHistogram::m_max), nullptr)
+                ->Method("GetMean", &HttpHistogram::GetMean)
+                ->Method("GetPercentile", &HttpHistogram::GetPercentile);
+        }
+    }
+
+    HttpHostMetrics::HttpHostMetrics()
+        : m_requestCount{ 0 }
+        , m_informationalResponses{ 0 }
+        , m_successfulResponses{ 0 }
+        , m_redirectResponses{ 0 }
+        , m_clientErrorResponses{ 0 }
+        , m_serverErrorResponses{ 0 }
+        , m_failedRequests{ 0 }
+        , m_compressedBytes{ 0 }
+        , m_decompressedBytes{ 0 }
+        , m_activeRequests{ 0 }
+        , m_peakActiveRequests{ 0 }
+    {
+    }
+
+    void HttpHostMetrics::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<HttpHostMetrics>()
+                ->Version(0)
+                ->Field("Host", &HttpHostMetrics::m_host)
+                ->Field("QueueWait", &HttpHostMetrics::m_queueWait)
+                ->Field("TimeToFirstByte", &HttpHostMetrics::m_timeToFirstByte)
+                ->Field("Latency", &HttpHostMetrics::m_latency)
+                ->Field("Bytes", &HttpHostMetrics::m_bytes)
+                ->Field("RequestCount", &HttpHostMetrics::m_requestCount)
+                ->Field("InformationalResponses", &HttpHostMetrics::m_informationalResponses)
+                ->Field("SuccessfulResponses", &HttpHostMetrics::m_successfulResponses)
+                ->Field("RedirectResponses", &HttpHostMetrics::m_redirectResponses)
+                ->Field("ClientErrorResponses", &HttpHostMetrics::m_clientErrorResponses)
+                ->Field("ServerErrorResponses", &HttpHostMetrics::m_serverErrorResponses)
+                ->Field("FailedRequests", &HttpHostMetrics::m_failedRequests)
+                ->Field("CompressedBytes", &HttpHostMetrics::m_compressedBytes)
+                ->Field("DecompressedBytes", &HttpHostMetrics::m_decompressedBytes)
+                ->Field("ActiveRequests", &HttpHostMetrics::m_activeRequests)
+                ->Field("PeakActiveRequests", &HttpHostMetrics::m_peakActiveRequests);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<HttpHostMetrics>("HttpHostMetrics")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Http")
+                ->Property("Host", BehaviorValueGetter(&HttpHostMetrics::m_host), nullptr)
+                ->Property("QueueWait", BehaviorValueGetter(&HttpHostMetrics::m_queueWait), nullptr)
+                ->Property("TimeToFirstByte", BehaviorValueGetter(&HttpHostMetrics::m_timeToFirstByte), nullptr)
+                ->Property("Latency", BehaviorValueGetter(&HttpHostMetrics::m_latency), nullptr)
+                ->Property("Bytes", BehaviorValueGetter(&HttpHostMetrics::m_bytes), nullptr)
+                ->Property("RequestCount", BehaviorValueGetter(&HttpHostMetrics::m_requestCount), nullptr)
+                ->Property("InformationalResponses", BehaviorValueGetter(&HttpHostMetrics::m_informationalResponses), nullptr)
+                ->Property("SuccessfulResponses", BehaviorValueGetter(&HttpHostMetrics::m_successfulResponses), nullptr)
+                ->Property("RedirectResponses", BehaviorValueGetter(&HttpHostMetrics::m_redirectResponses), nullptr)
+                ->Property("ClientErrorResponses", BehaviorValueGetter(&HttpHostMetrics::m_clientErrorResponses), nullptr)
+                ->Property("ServerErrorResponses", BehaviorValueGetter(&HttpHostMetrics::m_serverErrorResponses), nullptr)
+                ->Property("FailedRequests", BehaviorValueGetter(&HttpHostMetrics::m_failedRequests), nullptr)
+                ->Property("CompressedBytes", BehaviorValueGetter(&HttpHostMetrics::m_compressedBytes), nullptr)
+                ->Property("DecompressedBytes", BehaviorValueGetter(&HttpHostMetrics::m_decompressedBytes), nullptr)
+                ->Property("ActiveRequests", BehaviorValueGetter(&HttpHostMetrics::m_activeRequests), nullptr)
+                ->Property("PeakActiveRequests", BehaviorValueGetter(&HttpHostMetrics::m_peakActiveRequests), nullptr);
+        }
+    }
+
+    HttpMetricsSnapshot::HttpMetricsSnapshot()
+        : m_queuedRequests{ 0 }
+        , m_activeRequests{ 0 }
+        , m_peakQueuedRequests{ 0 }
+        , m_peakActiveRequests{ 0 }
+    {
+    }
+
+    void HttpMetricsSnapshot::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<HttpMetricsSnapshot>()
+                ->Version(0)
+                ->Field("Hosts", &HttpMetricsSnapshot::m_hosts)
+                ->Field("QueuedRequests", &HttpMetricsSnapshot::m_queuedRequests)
+                ->Field("ActiveRequests", &HttpMetricsSnapshot::m_activeRequests)
+                ->Field("PeakQueuedRequests", &HttpMetricsSnapshot::m_peakQueuedRequests)
+                ->Field("PeakActiveRequests", &HttpMetricsSnapshot::m_peakActiveRequests);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<HttpMetricsSnapshot>("HttpMetricsSnapshot")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Http")
+                ->Property("Hosts", BehaviorValueGetter(&HttpMetricsSnapshot::m_hosts), nullptr)
+                ->Property("QueuedRequests", BehaviorValueGetter(&HttpMetricsSnapshot::m_queuedRequests), nullptr)
+                ->Property("ActiveRequests", BehaviorValueGetter(&HttpMetricsSnapshot::m_activeRequests), nullptr)
+                ->Property("PeakQueuedRequests", BehaviorValueGetter(&HttpMetricsSnapshot::m_peakQueuedRequests), nullptr)
+                ->Property("PeakActiveRequests", BehaviorValueGetter(&HttpMetricsSnapshot::m_peakActiveRequests), nullptr);
+        }
+    }
+
+    void HttpMetricsRequest::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->EBus<HttpMetricsRequestBus>("HttpMetricsRequestBus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Http")
+                ->Event("GetHttpMetrics", &HttpMetricsRequestBus::Events::GetHttpMetrics)
+                ->Event("ResetHttpMetrics", &HttpMetricsRequestBus::Events::ResetHttpMetrics);
+        }
+    }
+} // namespace Cesium
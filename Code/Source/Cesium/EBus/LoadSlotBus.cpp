@@ -0,0 +1,56 @@
+#include <Cesium/EBus/LoadSlotBus.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace Cesium
+{
+    LoadSlotStatus::LoadSlotStatus()
+        : m_globalLoadSlots{ 0 }
+        , m_minimumLoadSlots{ 0 }
+        , m_requestedLoadSlots{ 0 }
+        , m_allocatedLoadSlots{ 0 }
+        , m_consumerCount{ 0 }
+        , m_throttledConsumerCount{ 0 }
+    {
+    }
+
+    void LoadSlotStatus::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<LoadSlotStatus>()
+                ->Version(0)
+                ->Field("GlobalLoadSlots", &LoadSlotStatus::m_globalLoadSlots)
+                ->Field("MinimumLoadSlots", &LoadSlotStatus::m_minimumLoadSlots)
+                ->Field("RequestedLoadSlots", &LoadSlotStatus::m_requestedLoadSlots)
+                ->Field("AllocatedLoadSlots", &LoadSlotStatus::m_allocatedLoadSlots)
+                ->Field("ConsumerCount", &LoadSlotStatus::m_consumerCount)
+                ->Field("ThrottledConsumerCount", &LoadSlotStatus::m_throttledConsumerCount);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<LoadSlotStatus>("LoadSlotStatus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Loading")
+                ->Property("GlobalLoadSlots", BehaviorValueGetter(&LoadSlotStatus::m_globalLoadSlots), nullptr)
+                ->Property("MinimumLoadSlots", BehaviorValueGetter(&LoadSlotStatus::m_minimumLoadSlots), nullptr)
+                ->Property("RequestedLoadSlots", BehaviorValueGetter(&LoadSlotStatus::m_requestedLoadSlots), nullptr)
+                ->Property("AllocatedLoadSlots", BehaviorValueGetter(&LoadSlotStatus::m_allocatedLoadSlots), nullptr)
+                ->Property("ConsumerCount", BehaviorValueGetter(&LoadSlotStatus::m_consumerCount), nullptr)
+                ->Property("ThrottledConsumerCount", BehaviorValueGetter(&LoadSlotStatus::m_throttledConsumerCount), nullptr);
+        }
+    }
+
+    void LoadSlotRequest::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->EBus<LoadSlotRequestBus>("LoadSlotRequestBus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Loading")
+                ->Event("SetGlobalLoadSlots", &LoadSlotRequestBus::Events::SetGlobalLoadSlots)
+                ->Event("GetGlobalLoadSlots", &LoadSlotRequestBus::Events::GetGlobalLoadSlots)
+                ->Event("SetMinimumLoadSlots", &LoadSlotRequestBus::Events::SetMinimumLoadSlots)
+                ->Event("GetMinimumLoadSlots", &LoadSlotRequestBus::Events::GetMinimumLoadSlots)
+                ->Event("GetLoadSlotStatus", &LoadSlotRequestBus::Events::GetLoadSlotStatus);
+        }
+    }
+} // namespace Cesium
@@ -0,0 +1,79 @@
+#include <Cesium/EBus/MemoryBudgetBus.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace Cesium
+{
+    MemoryBudgetStatus::MemoryBudgetStatus()
+        : m_budgetBytes{ 0 }
+        , m_usedBytes{ 0 }
+        , m_allocatedBytes{ 0 }
+        , m_consumerCount{ 0 }
+        , m_evictingConsumerCount{ 0 }
+        , m_pressure{ MemoryPressure::Normal }
+    {
+    }
+
+    void MemoryBudgetStatus::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<MemoryBudgetStatus>()
+                ->Version(0)
+                ->Field("BudgetBytes", &MemoryBudgetStatus::m_budgetBytes)
+                ->Field("UsedBytes", &MemoryBudgetStatus::m_usedBytes)
+                ->Field("AllocatedBytes", &MemoryBudgetStatus::m_allocatedBytes)
+                ->Field("ConsumerCount", &MemoryBudgetStatus::m_consumerCount)
+                ->Field("EvictingConsumerCount", &MemoryBudgetStatus::m_evictingConsumerCount)
+                ->Field("Pressure", &MemoryBudgetStatus::m_pressure);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Enum<static_cast<int>(MemoryPressure::Normal)>("MemoryPressure_Normal")
+                ->Enum<static_cast<int>(MemoryPressure::High)>("MemoryPressure_High")
+                ->Enum<static_cast<int>(MemoryPressure::Critical)>("MemoryPressure_Critical");
+
+            auto getPressure = [](MemoryBudgetStatus* status) -> int
+            {
+                return static_cast<int>(status->m_pressure);
+            };
+
+            behaviorContext->Class<MemoryBudgetStatus>("MemoryBudgetStatus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Memory")
+                ->Property("BudgetBytes", BehaviorValueGetter(&MemoryBudgetStatus::m_budgetBytes), nullptr)
+                ->Property("UsedBytes", BehaviorValueGetter(&MemoryBudgetStatus::m_usedBytes), nullptr)
+                ->Property("AllocatedBytes", BehaviorValueGetter(&MemoryBudgetStatus::m_allocatedBytes), nullptr)
+                ->Property("ConsumerCount", BehaviorValueGetter(&MemoryBudgetStatus::m_consumerCount), nullptr)
+                ->Property("EvictingConsumerCount", BehaviorValueGetter(&MemoryBudgetStatus::m_evictingConsumerCount), nullptr)
+                ->Property("Pressure", getPressure, nullptr);
+        }
+    }
+
+    void MemoryBudgetRequest::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->EBus<MemoryBudgetRequestBus>("MemoryBudgetRequestBus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Memory")
+                ->Event("SetMemoryBudget", &MemoryBudgetRequestBus::Events::SetMemoryBudget)
+                ->Event("GetMemoryBudget", &MemoryBudgetRequestBus::Events::GetMemoryBudget)
+                ->Event("GetMemoryBudgetStatus", &MemoryBudgetRequestBus::Events::GetMemoryBudgetStatus);
+        }
+    }
+
+    void MemoryBudgetNotificationEBusHandler::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->EBus<MemoryBudgetNotificationBus>("MemoryBudgetNotificationBus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Memory")
+                ->Handler<MemoryBudgetNotificationEBusHandler>()
+                ->Event("OnMemoryPressureChanged", &MemoryBudgetNotificationBus::Events::OnMemoryPressureChanged);
+        }
+    }
+
+    void MemoryBudgetNotificationEBusHandler::OnMemoryPressureChanged(const MemoryBudgetStatus& status)
+    {
+        Call(FN_OnMemoryPressureChanged, status);
+    }
+} // namespace Cesium
@@ -9,6 +9,8 @@ namespace Cesium
 {
     using RasterOverlayContainerLoadedEvent = AZ::Event<>;
     using RasterOverlayContainerUnloadedEvent = AZ::Event<>;
+    using RasterOverlayContainerCacheScaleChangedEvent = AZ::Event<double>;
+    using RasterOverlayContainerLoadScaleChangedEvent = AZ::Event<double>;
 
     class RasterOverlayContainerRequest : public AZ::ComponentBus
     {
@@ -20,6 +22,16 @@ namespace Cesium
         virtual void BindContainerLoadedEvent(RasterOverlayContainerLoadedEvent::Handler& handler) = 0;
 
         virtual void BindContainerUnloadedEvent(RasterOverlayContainerUnloadedEvent::Handler& handler) = 0;
+
+        // the fraction of their configured cache the raster overlays may use. It is lowered by the Cesium memory budget
+        virtual double GetCacheScale() const = 0;
+
+        virtual void BindCacheScaleChangedEvent(RasterOverlayContainerCacheScaleChangedEvent::Handler& handler) = 0;
+
+        // the fraction of their configured simultaneous loads the raster overlays may use. It follows the adaptive tile loads
+        virtual double GetLoadScale() const = 0;
+
+        virtual void BindLoadScaleChangedEvent(RasterOverlayContainerLoadScaleChangedEvent::Handler& handler) = 0;
     };
 
     using RasterOverlayContainerRequestBus = AZ::EBus<RasterOverlayContainerRequest>;
@@ -17,7 +17,25 @@ namespace Cesium
                 ->Field("LoadingDescendantLimit", &TilesetConfiguration::m_loadingDescendantLimit)
                 ->Field("PreloadAncestors", &TilesetConfiguration::m_preloadAncestors)
                 ->Field("PreloadSiblings", &TilesetConfiguration::m_preloadSiblings)
-                ->Field("ForbidHole", &TilesetConfiguration::m_forbidHole);
+                ->Field("ForbidHole", &TilesetConfiguration::m_forbidHole)
+                ->Field("MaximumPreparedTiles", &TilesetConfiguration::m_maximumPreparedTiles)
+                ->Field("MaximumPreparedBytes", &TilesetConfiguration::m_maximumPreparedBytes)
+                ->Field("AdaptiveScreenSpaceError", &TilesetConfiguration::m_adaptiveScreenSpaceError)
+                ->Field("MinimumAdaptiveScreenSpaceError", &TilesetConfiguration::m_minimumAdaptiveScreenSpaceError)
+                ->Field("MaximumAdaptiveScreenSpaceError", &TilesetConfiguration::m_maximumAdaptiveScreenSpaceError)
+                ->Field("TargetFrameTime", &TilesetConfiguration::m_targetFrameTime)
+                ->Field("MainThreadBudget", &TilesetConfiguration::m_mainThreadBudget)
+                ->Field("CacheTrimGracePeriod", &TilesetConfiguration::m_cacheTrimGracePeriod)
+                ->Field("CacheTrimDuration", &TilesetConfiguration::m_cacheTrimDuration)
+                ->Field("PredictivePrefetch", &TilesetConfiguration::m_predictivePrefetch)
+                ->Field("PrefetchLookAhead", &TilesetConfiguration::m_prefetchLookAhead)
+                ->Field("MaximumPrefetchBytes", &TilesetConfiguration::m_maximumPrefetchBytes)
+                ->Field("AdaptiveTileLoads", &TilesetConfiguration::m_adaptiveTileLoads)
+                ->Field("MinimumAdaptiveTileLoads", &TilesetConfiguration::m_minimumAdaptiveTileLoads)
+                ->Field("MaximumAdaptiveTileLoads", &TilesetConfiguration::m_maximumAdaptiveTileLoads)
+                ->Field("HorizonCulling", &TilesetConfiguration::m_horizonCulling)
+                ->Field("OcclusionCulling", &TilesetConfiguration::m_occlusionCulling)
+                ->Field("ShareOccluders", &TilesetConfiguration::m_shareOccluders);
         }
 
         if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
@@ -30,7 +48,27 @@ namespace Cesium
                 ->Property("LoadingDescendantLimit", BehaviorValueProperty(&TilesetConfiguration::m_loadingDescendantLimit))
                 ->Property("PreloadAncestors", BehaviorValueProperty(&TilesetConfiguration::m_preloadAncestors))
                 ->Property("PreloadSiblings", BehaviorValueProperty(&TilesetConfiguration::m_preloadSiblings))
-                ->Property("ForbidHole", BehaviorValueProperty(&TilesetConfiguration::m_forbidHole));
+                ->Property("ForbidHole", BehaviorValueProperty(&TilesetConfiguration::m_forbidHole))
+                ->Property("MaximumPreparedTiles", BehaviorValueProperty(&TilesetConfiguration::m_maximumPreparedTiles))
+                ->Property("MaximumPreparedBytes", BehaviorValueProperty(&TilesetConfiguration::m_maximumPreparedBytes))
+                ->Property("AdaptiveScreenSpaceError", BehaviorValueProperty(&TilesetConfiguration::m_adaptiveScreenSpaceError))
+                ->Property(
+                    "MinimumAdaptiveScreenSpaceError", BehaviorValueProperty(&TilesetConfiguration::m_minimumAdaptiveScreenSpaceError))
+                ->Property(
+                    "MaximumAdaptiveScreenSpaceError", BehaviorValueProperty(&TilesetConfiguration::m_maximumAdaptiveScreenSpaceError))
+                ->Property("TargetFrameTime", BehaviorValueProperty(&TilesetConfiguration::m_targetFrameTime))
+                ->Property("MainThreadBudget", BehaviorValueProperty(&TilesetConfiguration::m_mainThreadBudget))
+                ->Property("CacheTrimGracePeriod", BehaviorValueProperty(&TilesetConfiguration::m_cacheTrimGracePeriod))
+                ->Property("CacheTrimDuration", BehaviorValueProperty(&TilesetConfiguration::m_cacheTrimDuration))
+                ->Property("PredictivePrefetch", BehaviorValueProperty(&TilesetConfiguration::m_predictivePrefetch))
+                ->Property("PrefetchLookAhead", BehaviorValueProperty(&TilesetConfiguration::m_prefetchLookAhead))
+                ->Property("MaximumPrefetchBytes", BehaviorValueProperty(&TilesetConfiguration::m_maximumPrefetchBytes))
+                ->Property("AdaptiveTileLoads", BehaviorValueProperty(&TilesetConfiguration::m_adaptiveTileLoads))
+                ->Property("MinimumAdaptiveTileLoads", BehaviorValueProperty(&TilesetConfiguration::m_minimumAdaptiveTileLoads))
+                ->Property("MaximumAdaptiveTileLoads", BehaviorValueProperty(&TilesetConfiguration::m_maximumAdaptiveTileLoads))
+                ->Property("HorizonCulling", BehaviorValueProperty(&TilesetConfiguration::m_horizonCulling))
+                ->Property("OcclusionCulling", BehaviorValueProperty(&TilesetConfiguration::m_occlusionCulling))
+                ->Property("ShareOccluders", BehaviorValueProperty(&TilesetConfiguration::m_shareOccluders));
         }
     }
 
@@ -38,8 +76,12 @@ namespace Cesium
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
-            serializeContext->Class<TilesetRenderConfiguration>()->Version(0)->Field(
-                "GenerateMissingNormalAsSmooth", &TilesetRenderConfiguration::m_generateMissingNormalAsSmooth);
+            serializeContext->Class<TilesetRenderConfiguration>()
+                ->Version(0)
+                ->Field("GenerateMissingNormalAsSmooth", &TilesetRenderConfiguration::m_generateMissingNormalAsSmooth)
+                ->Field("StartupSnapshot", &TilesetRenderConfiguration::m_startupSnapshot)
+                ->Field("MaximumSnapshotBytes", &TilesetRenderConfiguration::m_maximumSnapshotBytes)
+                ->Field("RayTracingEnabled", &TilesetRenderConfiguration::m_rayTracingEnabled);
         }
 
         if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
@@ -47,7 +89,218 @@ namespace Cesium
             behaviorContext->Class<TilesetRenderConfiguration>("TilesetRenderConfiguration")
                 ->Attribute(AZ::Script::Attributes::Category, "Cesium/3DTiles")
                 ->Property(
-                    "GenerateMissingNormalAsSmooth", BehaviorValueProperty(&TilesetRenderConfiguration::m_generateMissingNormalAsSmooth));
+                    "GenerateMissingNormalAsSmooth", BehaviorValueProperty(&TilesetRenderConfiguration::m_generateMissingNormalAsSmooth))
+                ->Property("StartupSnapshot", BehaviorValueProperty(&TilesetRenderConfiguration::m_startupSnapshot))
+                ->Property("MaximumSnapshotBytes", BehaviorValueProperty(&TilesetRenderConfiguration::m_maximumSnapshotBytes))
+                ->Property("RayTracingEnabled", BehaviorValueProperty(&TilesetRenderConfiguration::m_rayTracingEnabled));
+        }
+    }
+
+    void TilesetLoadPipelineMetrics::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TilesetLoadPipelineMetrics>()
+                ->Version(0)
+                ->Field("PipelineDepth", &TilesetLoadPipelineMetrics::m_pipelineDepth)
+                ->Field("BytesInFlight", &TilesetLoadPipelineMetrics::m_bytesInFlight)
+                ->Field("PeakPipelineDepth", &TilesetLoadPipelineMetrics::m_peakPipelineDepth)
+                ->Field("PeakBytesInFlight", &TilesetLoadPipelineMetrics::m_peakBytesInFlight)
+                ->Field("ThrottledLoads", &TilesetLoadPipelineMetrics::m_throttledLoads)
+                ->Field("StrandedTiles", &TilesetLoadPipelineMetrics::m_strandedTiles);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<TilesetLoadPipelineMetrics>("TilesetLoadPipelineMetrics")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/3DTiles")
+                ->Property("PipelineDepth", BehaviorValueGetter(&TilesetLoadPipelineMetrics::m_pipelineDepth), nullptr)
+                ->Property("BytesInFlight", BehaviorValueGetter(&TilesetLoadPipelineMetrics::m_bytesInFlight), nullptr)
+                ->Property("PeakPipelineDepth", BehaviorValueGetter(&TilesetLoadPipelineMetrics::m_peakPipelineDepth), nullptr)
+                ->Property("PeakBytesInFlight", BehaviorValueGetter(&TilesetLoadPipelineMetrics::m_peakBytesInFlight), nullptr)
+                ->Property("ThrottledLoads", BehaviorValueGetter(&TilesetLoadPipelineMetrics::m_throttledLoads), nullptr)
+                ->Property("StrandedTiles", BehaviorValueGetter(&TilesetLoadPipelineMetrics::m_strandedTiles), nullptr);
+        }
+    }
+
+    void TilesetMemoryUsage::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TilesetMemoryUsage>()
+                ->Version(0)
+                ->Field("DecodedTileBytes", &TilesetMemoryUsage::m_decodedTileBytes)
+                ->Field("PeakDecodedTileBytes", &TilesetMemoryUsage::m_peakDecodedTileBytes)
+                ->Field("BuiltAssetBytes", &TilesetMemoryUsage::m_builtAssetBytes)
+                ->Field("PeakBuiltAssetBytes", &TilesetMemoryUsage::m_peakBuiltAssetBytes)
+                ->Field("RasterImageBytes", &TilesetMemoryUsage::m_rasterImageBytes)
+                ->Field("PeakRasterImageBytes", &TilesetMemoryUsage::m_peakRasterImageBytes)
+                ->Field("TotalBytes", &TilesetMemoryUsage::m_totalBytes)
+                ->Field("PeakTotalBytes", &TilesetMemoryUsage::m_peakTotalBytes);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<TilesetMemoryUsage>("TilesetMemoryUsage")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/3DTiles")
+                ->Property("DecodedTileBytes", BehaviorValueGetter(&TilesetMemoryUsage::m_decodedTileBytes), nullptr)
+                ->Property("PeakDecodedTileBytes", BehaviorValueGetter(&TilesetMemoryUsage::m_peakDecodedTileBytes), nullptr)
+                ->Property("BuiltAssetBytes", BehaviorValueGetter(&TilesetMemoryUsage::m_builtAssetBytes), nullptr)
+                ->Property("PeakBuiltAssetBytes", BehaviorValueGetter(&TilesetMemoryUsage::m_peakBuiltAssetBytes), nullptr)
+                ->Property("RasterImageBytes", BehaviorValueGetter(&TilesetMemoryUsage::m_rasterImageBytes), nullptr)
+                ->Property("PeakRasterImageBytes", BehaviorValueGetter(&TilesetMemoryUsage::m_peakRasterImageBytes), nullptr)
+                ->Property("TotalBytes", BehaviorValueGetter(&TilesetMemoryUsage::m_totalBytes), nullptr)
+                ->Property("PeakTotalBytes", BehaviorValueGetter(&TilesetMemoryUsage::m_peakTotalBytes), nullptr);
+        }
+    }
+
+    void TilesetStreamingStatistics::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TilesetStreamingStatistics>()
+                ->Version(0)
+                ->Field("TilesRendered", &TilesetStreamingStatistics::m_tilesRendered)
+                ->Field("TilesVisited", &TilesetStreamingStatistics::m_tilesVisited)
+                ->Field("CulledTilesVisited", &TilesetStreamingStatistics::m_culledTilesVisited)
+                ->Field("TilesCulled", &TilesetStreamingStatistics::m_tilesCulled)
+                ->Field("MaxDepthVisited", &TilesetStreamingStatistics::m_maxDepthVisited)
+                ->Field("TilesLoadingLowPriority", &TilesetStreamingStatistics::m_tilesLoadingLowPriority)
+                ->Field("TilesLoadingMediumPriority", &TilesetStreamingStatistics::m_tilesLoadingMediumPriority)
+                ->Field("TilesLoadingHighPriority", &TilesetStreamingStatistics::m_tilesLoadingHighPriority)
+                ->Field("MainThreadQueueLength", &TilesetStreamingStatistics::m_mainThreadQueueLength)
+                ->Field("VisibilityToggles", &TilesetStreamingStatistics::m_visibilityToggles)
+                ->Field("BytesCached", &TilesetStreamingStatistics::m_bytesCached)
+                ->Field("TilesPrefetched", &TilesetStreamingStatistics::m_tilesPrefetched)
+                ->Field("BytesPrefetched", &TilesetStreamingStatistics::m_bytesPrefetched)
+                ->Field("TilesHorizonCulled", &TilesetStreamingStatistics::m_tilesHorizonCulled)
+                ->Field("TilesOcclusionCulled", &TilesetStreamingStatistics::m_tilesOcclusionCulled)
+                ->Field("OcclusionCullingTime", &TilesetStreamingStatistics::m_occlusionCullingTime)
+                ->Field("UpdateViewTime", &TilesetStreamingStatistics::m_updateViewTime)
+                ->Field("UpdateViewSkipped", &TilesetStreamingStatistics::m_updateViewSkipped);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<TilesetStreamingStatistics>("TilesetStreamingStatistics")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/3DTiles")
+                ->Property("TilesRendered", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesRendered), nullptr)
+                ->Property("TilesVisited", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesVisited), nullptr)
+                ->Property("CulledTilesVisited", BehaviorValueGetter(&TilesetStreamingStatistics::m_culledTilesVisited), nullptr)
+                ->Property("TilesCulled", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesCulled), nullptr)
+                ->Property("MaxDepthVisited", BehaviorValueGetter(&TilesetStreamingStatistics::m_maxDepthVisited), nullptr)
+                ->Property("TilesLoadingLowPriority", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesLoadingLowPriority), nullptr)
+                ->Property("TilesLoadingMediumPriority", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesLoadingMediumPriority), nullptr)
+                ->Property("TilesLoadingHighPriority", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesLoadingHighPriority), nullptr)
+                ->Property("MainThreadQueueLength", BehaviorValueGetter(&TilesetStreamingStatistics::m_mainThreadQueueLength), nullptr)
+                ->Property("VisibilityToggles", BehaviorValueGetter(&TilesetStreamingStatistics::m_visibilityToggles), nullptr)
+                ->Property("BytesCached", BehaviorValueGetter(&TilesetStreamingStatistics::m_bytesCached), nullptr)
+                ->Property("TilesPrefetched", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesPrefetched), nullptr)
+                ->Property("BytesPrefetched", BehaviorValueGetter(&TilesetStreamingStatistics::m_bytesPrefetched), nullptr)
+                ->Property("TilesHorizonCulled", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesHorizonCulled), nullptr)
+                ->Property("TilesOcclusionCulled", BehaviorValueGetter(&TilesetStreamingStatistics::m_tilesOcclusionCulled), nullptr)
+                ->Property("OcclusionCullingTime", BehaviorValueGetter(&TilesetStreamingStatistics::m_occlusionCullingTime), nullptr)
+                ->Property("UpdateViewTime", BehaviorValueGetter(&TilesetStreamingStatistics::m_updateViewTime), nullptr)
+                ->Property("UpdateViewSkipped", BehaviorValueGetter(&TilesetStreamingStatistics::m_updateViewSkipped), nullptr);
+        }
+    }
+
+    void TilesetRollingStreamingStatistics::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TilesetRollingStreamingStatistics>()
+                ->Version(0)
+                ->Field("FrameCount", &TilesetRollingStreamingStatistics::m_frameCount)
+                ->Field("AverageTilesRendered", &TilesetRollingStreamingStatistics::m_averageTilesRendered)
+                ->Field("AverageTilesVisited", &TilesetRollingStreamingStatistics::m_averageTilesVisited)
+                ->Field("AverageTilesCulled", &TilesetRollingStreamingStatistics::m_averageTilesCulled)
+                ->Field("AverageTilesOcclusionCulled", &TilesetRollingStreamingStatistics::m_averageTilesOcclusionCulled)
+                ->Field("AverageTilesLoading", &TilesetRollingStreamingStatistics::m_averageTilesLoading)
+                ->Field("AverageMainThreadQueueLength", &TilesetRollingStreamingStatistics::m_averageMainThreadQueueLength)
+                ->Field("AverageBytesCached", &TilesetRollingStreamingStatistics::m_averageBytesCached)
+                ->Field("AverageUpdateViewTime", &TilesetRollingStreamingStatistics::m_averageUpdateViewTime)
+                ->Field("MaxUpdateViewTime", &TilesetRollingStreamingStatistics::m_maxUpdateViewTime)
+                ->Field("TotalVisibilityToggles", &TilesetRollingStreamingStatistics::m_totalVisibilityToggles)
+                ->Field("SkippedUpdateViews", &TilesetRollingStreamingStatistics::m_skippedUpdateViews);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<TilesetRollingStreamingStatistics>("TilesetRollingStreamingStatistics")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/3DTiles")
+                ->Property("FrameCount", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_frameCount), nullptr)
+                ->Property("AverageTilesRendered", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_averageTilesRendered), nullptr)
+                ->Property("AverageTilesVisited", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_averageTilesVisited), nullptr)
+                ->Property("AverageTilesCulled", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_averageTilesCulled), nullptr)
+                ->Property("AverageTilesOcclusionCulled", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_averageTilesOcclusionCulled), nullptr)
+                ->Property("AverageTilesLoading", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_averageTilesLoading), nullptr)
+                ->Property("AverageMainThreadQueueLength", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_averageMainThreadQueueLength), nullptr)
+                ->Property("AverageBytesCached", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_averageBytesCached), nullptr)
+                ->Property("AverageUpdateViewTime", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_averageUpdateViewTime), nullptr)
+                ->Property("MaxUpdateViewTime", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_maxUpdateViewTime), nullptr)
+                ->Property("TotalVisibilityToggles", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_totalVisibilityToggles), nullptr)
+                ->Property("SkippedUpdateViews", BehaviorValueGetter(&TilesetRollingStreamingStatistics::m_skippedUpdateViews), nullptr);
+        }
+    }
+
+    void TilesetDebugConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TilesetDebugConfiguration>()
+                ->Version(0)
+                ->Field("CollectTileInfo", &TilesetDebugConfiguration::m_collectTileInfo)
+                ->Field("DrawMode", &TilesetDebugConfiguration::m_drawMode)
+                ->Field("MaximumLoadLatency", &TilesetDebugConfiguration::m_maximumLoadLatency);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Enum<static_cast<int>(TilesetDebugDrawMode::None)>("TilesetDebugDrawMode_None")
+                ->Enum<static_cast<int>(TilesetDebugDrawMode::LoadLatency)>("TilesetDebugDrawMode_LoadLatency")
+                ->Enum<static_cast<int>(TilesetDebugDrawMode::Depth)>("TilesetDebugDrawMode_Depth");
+
+            auto getDrawMode = [](TilesetDebugConfiguration* configuration) -> int
+            {
+                return static_cast<int>(configuration->m_drawMode);
+            };
+
+            auto setDrawMode = [](TilesetDebugConfiguration* configuration, int drawMode)
+            {
+                configuration->m_drawMode = static_cast<TilesetDebugDrawMode>(drawMode);
+            };
+
+            behaviorContext->Class<TilesetDebugConfiguration>("TilesetDebugConfiguration")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/3DTiles")
+                ->Property("CollectTileInfo", BehaviorValueProperty(&TilesetDebugConfiguration::m_collectTileInfo))
+                ->Property("DrawMode", getDrawMode, setDrawMode)
+                ->Property("MaximumLoadLatency", BehaviorValueProperty(&TilesetDebugConfiguration::m_maximumLoadLatency));
+        }
+    }
+
+    void TilesetDebugTileInfo::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TilesetDebugTileInfo>()
+                ->Version(0)
+                ->Field("WorldBounds", &TilesetDebugTileInfo::m_worldBounds)
+                ->Field("GeometricError", &TilesetDebugTileInfo::m_geometricError)
+                ->Field("ScreenSpaceError", &TilesetDebugTileInfo::m_screenSpaceError)
+                ->Field("Depth", &TilesetDebugTileInfo::m_depth)
+                ->Field("LoadLatency", &TilesetDebugTileInfo::m_loadLatency);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<TilesetDebugTileInfo>("TilesetDebugTileInfo")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/3DTiles")
+                ->Property("WorldBounds", BehaviorValueGetter(&TilesetDebugTileInfo::m_worldBounds), nullptr)
+                ->Property("GeometricError", BehaviorValueGetter(&TilesetDebugTileInfo::m_geometricError), nullptr)
+                ->Property("ScreenSpaceError", BehaviorValueGetter(&TilesetDebugTileInfo::m_screenSpaceError), nullptr)
+                ->Property("Depth", BehaviorValueGetter(&TilesetDebugTileInfo::m_depth), nullptr)
+                ->Property("LoadLatency", BehaviorValueGetter(&TilesetDebugTileInfo::m_loadLatency), nullptr);
         }
     }
 
@@ -224,7 +477,19 @@ namespace Cesium
                 ->Event("LoadTileset", &TilesetRequestBus::Events::LoadTileset)
                 ->Event("GetRootTransform", &TilesetRequestBus::Events::GetRootTransform)
                 ->Event("GetTransform", &TilesetRequestBus::Events::GetTransform)
-                ->Event("ApplyTransformToRoot", &TilesetRequestBus::Events::ApplyTransformToRoot);
+                ->Event("ApplyTransformToRoot", &TilesetRequestBus::Events::ApplyTransformToRoot)
+                ->Event("GetLoadPipelineMetrics", &TilesetRequestBus::Events::GetLoadPipelineMetrics)
+                ->Event("GetMemoryUsage", &TilesetRequestBus::Events::GetMemoryUsage)
+                ->Event("GetStreamingStatistics", &TilesetRequestBus::Events::GetStreamingStatistics)
+                ->Event("GetRollingStreamingStatistics", &TilesetRequestBus::Events::GetRollingStreamingStatistics)
+                ->Event("ResetStreamingStatistics", &TilesetRequestBus::Events::ResetStreamingStatistics)
+                ->Event("GetEffectiveScreenSpaceError", &TilesetRequestBus::Events::GetEffectiveScreenSpaceError)
+                ->Event("SaveStartupSnapshot", &TilesetRequestBus::Events::SaveStartupSnapshot)
+                ->Event("GetTimeToFirstFullDetail", &TilesetRequestBus::Events::GetTimeToFirstFullDetail)
+                ->Event("GetEffectiveSimultaneousTileLoads", &TilesetRequestBus::Events::GetEffectiveSimultaneousTileLoads)
+                ->Event("SetDebugConfiguration", &TilesetRequestBus::Events::SetDebugConfiguration)
+                ->Event("GetDebugConfiguration", &TilesetRequestBus::Events::GetDebugConfiguration)
+                ->Event("GetDebugTileInfos", &TilesetRequestBus::Events::GetDebugTileInfos);
         }
     }
 } // namespace Cesium
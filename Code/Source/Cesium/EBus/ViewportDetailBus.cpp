@@ -0,0 +1,70 @@
+#include <Cesium/EBus/ViewportDetailBus.h>
+#include <Cesium/Math/MathReflect.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace Cesium
+{
+    ViewportDetailConfiguration::ViewportDetailConfiguration()
+        : m_enabled{ true }
+        , m_screenSpaceErrorMultiplier{ 1.0 }
+        , m_priority{ 1.0 }
+        , m_foveated{ false }
+        , m_gazePoint{ 0.0 }
+        , m_fovealRadius{ 0.25 }
+        , m_peripheralScreenSpaceErrorMultiplier{ 4.0 }
+    {
+    }
+
+    void ViewportDetailConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ViewportDetailConfiguration>()
+                ->Version(0)
+                ->Field("Enabled", &ViewportDetailConfiguration::m_enabled)
+                ->Field("ScreenSpaceErrorMultiplier", &ViewportDetailConfiguration::m_screenSpaceErrorMultiplier)
+                ->Field("Priority", &ViewportDetailConfiguration::m_priority)
+                ->Field("Foveated", &ViewportDetailConfiguration::m_foveated)
+                ->Field("GazePoint", &ViewportDetailConfiguration::m_gazePoint)
+                ->Field("FovealRadius", &ViewportDetailConfiguration::m_fovealRadius)
+                ->Field("PeripheralScreenSpaceErrorMultiplier", &ViewportDetailConfiguration::m_peripheralScreenSpaceErrorMultiplier);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<ViewportDetailConfiguration>("ViewportDetailConfiguration")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Camera")
+                ->Constructor()
+                ->Property("Enabled", BehaviorValueProperty(&ViewportDetailConfiguration::m_enabled))
+                ->Property(
+                    "ScreenSpaceErrorMultiplier", BehaviorValueProperty(&ViewportDetailConfiguration::m_screenSpaceErrorMultiplier))
+                ->Property("Priority", BehaviorValueProperty(&ViewportDetailConfiguration::m_priority))
+                ->Property("Foveated", BehaviorValueProperty(&ViewportDetailConfiguration::m_foveated))
+                ->Property("GazePoint", BehaviorValueProperty(&ViewportDetailConfiguration::m_gazePoint))
+                ->Property("FovealRadius", BehaviorValueProperty(&ViewportDetailConfiguration::m_fovealRadius))
+                ->Property(
+                    "PeripheralScreenSpaceErrorMultiplier",
+                    BehaviorValueProperty(&ViewportDetailConfiguration::m_peripheralScreenSpaceErrorMultiplier));
+        }
+    }
+
+    void ViewportDetailRequest::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->EBus<ViewportDetailRequestBus>("ViewportDetailRequestBus")
+                ->Attribute(AZ::Script::Attributes::Category, "Cesium/Camera")
+                ->Event(
+                    "SetViewportDetail", &ViewportDetailRequestBus::Events::SetViewportDetail,
+                    { AZ::BehaviorParameterOverrides("ViewportId"), AZ::BehaviorParameterOverrides("Configuration") })
+                ->Event("GetViewportDetail", &ViewportDetailRequestBus::Events::GetViewportDetail)
+                ->Event("ClearViewportDetail", &ViewportDetailRequestBus::Events::ClearViewportDetail)
+                ->Event(
+                    "SetViewportGazePoint", &ViewportDetailRequestBus::Events::SetViewportGazePoint,
+                    { AZ::BehaviorParameterOverrides("ViewportId"), AZ::BehaviorParameterOverrides("GazePoint") })
+                ->Event(
+                    "SetViewportEnabled", &ViewportDetailRequestBus::Events::SetViewportEnabled,
+                    { AZ::BehaviorParameterOverrides("ViewportId"), AZ::BehaviorParameterOverrides("Enabled") });
+        }
+    }
+} // namespace Cesium
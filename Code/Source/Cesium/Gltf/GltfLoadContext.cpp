@@ -1,4 +1,5 @@
 #include "Cesium/Gltf/GltfLoadContext.h"
+#include <Atom/RHI.Reflect/ImageDescriptor.h>
 
 namespace Cesium
 {
@@ -45,12 +46,14 @@ namespace Cesium
     GltfLoadPrimitive::GltfLoadPrimitive()
         : m_modelAsset{}
         , m_materialId{ -1 }
+        , m_bufferByteSize{ 0 }
     {
     }
 
     GltfLoadPrimitive::GltfLoadPrimitive(AZ::Data::Asset<AZ::RPI::ModelAsset>&& modelAsset, MaterialId materialId)
         : m_modelAsset{ std::move(modelAsset) }
         , m_materialId{ materialId }
+        , m_bufferByteSize{ 0 }
     {
     }
 
@@ -75,4 +78,30 @@ namespace Cesium
     {
         return m_primitives.empty();
     }
+
+    std::uint64_t GltfLoadModel::EstimateByteSize() const
+    {
+        std::uint64_t totalBytes = 0;
+        for (const auto& mesh : m_meshes)
+        {
+            for (const auto& primitive : mesh.m_primitives)
+            {
+                totalBytes += primitive.m_bufferByteSize;
+            }
+        }
+
+        for (const auto& texture : m_textures)
+        {
+            if (texture.second.IsEmpty())
+            {
+                continue;
+            }
+
+            const AZ::RHI::ImageDescriptor& descriptor = texture.second.m_imageAsset->GetImageDescriptor();
+            totalBytes += static_cast<std::uint64_t>(descriptor.m_size.m_width) * descriptor.m_size.m_height *
+                descriptor.m_size.m_depth * AZ::RHI::GetFormatSize(descriptor.m_format);
+        }
+
+        return totalBytes;
+    }
 } // namespace Cesium
@@ -60,6 +60,7 @@ namespace Cesium
 
         AZ::Data::Asset<AZ::RPI::ModelAsset> m_modelAsset;
         MaterialId m_materialId;
+        std::size_t m_bufferByteSize;
     };
 
     struct GltfLoadMesh final
@@ -76,6 +77,8 @@ namespace Cesium
 
     struct GltfLoadModel final
     {
+        std::uint64_t EstimateByteSize() const;
+
         AZStd::unordered_map<TextureId, GltfLoadTexture> m_textures;
         AZStd::vector<GltfLoadMaterial> m_materials;
         AZStd::vector<GltfLoadMesh> m_meshes;
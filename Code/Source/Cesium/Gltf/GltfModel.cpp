@@ -1,5 +1,6 @@
 #include "Cesium/Gltf/GltfModel.h"
 #include "Cesium/Gltf/GltfLoadContext.h"
+#include "Cesium/Systems/TraceRecorder.h"
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <AzCore/std/algorithm.h>
 #include <glm/gtc/matrix_transform.hpp>
@@ -19,6 +20,7 @@ namespace Cesium
 
     GltfModel::GltfModel(AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor, const GltfLoadModel& loadModel)
         : m_visible{ true }
+        , m_rayTracingEnabled{ false }
         , m_transform{ glm::dmat4(1.0) }
         , m_meshFeatureProcessor{ meshFeatureProcessor }
         , m_meshes{}
@@ -41,6 +43,7 @@ namespace Cesium
                 if (!m_materials.empty() && loadPrimitive.m_materialId >= 0 && !m_materials[loadPrimitive.m_materialId].m_material)
                 {
                     // Create material instance
+                    ScopedTraceEvent traceEvent("Tile", "MaterialInstance");
                     const GltfLoadMaterial& loadMaterial = loadModel.m_materials[loadPrimitive.m_materialId];
                     const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset = loadMaterial.m_materialAsset;
                     AZ::Data::Instance<AZ::RPI::Material> materialInstance = AZ::RPI::Material::FindOrCreate(materialAsset);
@@ -67,6 +70,7 @@ namespace Cesium
     GltfModel::GltfModel(GltfModel&& rhs) noexcept
     {
         m_visible = rhs.m_visible;
+        m_rayTracingEnabled = rhs.m_rayTracingEnabled;
         m_transform = rhs.m_transform;
         m_meshFeatureProcessor = rhs.m_meshFeatureProcessor;
         m_meshes = std::move(rhs.m_meshes);
@@ -79,6 +83,7 @@ namespace Cesium
         if (&rhs != this)
         {
             swap(m_visible, rhs.m_visible);
+            swap(m_rayTracingEnabled, rhs.m_rayTracingEnabled);
             swap(m_transform, rhs.m_transform);
             swap(m_meshFeatureProcessor, rhs.m_meshFeatureProcessor);
             swap(m_meshes, rhs.m_meshes);
@@ -138,6 +143,23 @@ namespace Cesium
         }
     }
 
+    bool GltfModel::IsRayTracingEnabled() const
+    {
+        return m_rayTracingEnabled;
+    }
+
+    void GltfModel::SetRayTracingEnabled(bool rayTracingEnabled)
+    {
+        m_rayTracingEnabled = rayTracingEnabled;
+        for (auto& mesh : m_meshes)
+        {
+            for (auto& primitive : mesh.m_primitives)
+            {
+                m_meshFeatureProcessor->SetRayTracingEnabled(primitive.m_meshHandle, m_rayTracingEnabled);
+            }
+        }
+    }
+
     void GltfModel::SetTransform(const glm::dmat4& transform)
     {
         m_transform = transform;
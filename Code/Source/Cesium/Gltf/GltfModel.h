@@ -61,6 +61,10 @@ namespace Cesium
 
         void SetVisible(bool visible);
 
+        bool IsRayTracingEnabled() const;
+
+        void SetRayTracingEnabled(bool rayTracingEnabled);
+
         void SetTransform(const glm::dmat4& transform);
 
         const glm::dmat4& GetTransform() const;
@@ -71,6 +75,7 @@ namespace Cesium
         void ConvertMat4ToTransformAndScale(const glm::dmat4& mat4, AZ::Transform& o3deTransform, AZ::Vector3& o3deScale);
 
         bool m_visible;
+        bool m_rayTracingEnabled;
         glm::dmat4 m_transform;
         AZ::Render::MeshFeatureProcessorInterface* m_meshFeatureProcessor;
         AZStd::vector<GltfMesh> m_meshes;
@@ -2,6 +2,7 @@
 #include "Cesium/Gltf/GltfPrimitiveBuilder.h"
 #include "Cesium/Gltf/GltfLoadContext.h"
 #include "Cesium/Systems/GenericIOManager.h"
+#include "Cesium/Systems/TraceRecorder.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 
@@ -166,6 +167,7 @@ namespace Cesium
             GltfLoadMaterial& loadMaterial = result.m_materials[primitive.material];
             if (loadMaterial.IsEmpty())
             {
+                ScopedTraceEvent traceEvent("Tile", "MaterialBuild");
                 m_materialBuilder->Create(model, *material, result.m_textures, loadMaterial);
             }
 
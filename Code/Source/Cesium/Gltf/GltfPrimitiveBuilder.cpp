@@ -2,6 +2,7 @@
 #include "Cesium/Gltf/BitangentAndTangentGenerator.h"
 #include "Cesium/Systems/CesiumSystem.h"
 #include "Cesium/Systems/CriticalAssetManager.h"
+#include "Cesium/Systems/TraceRecorder.h"
 #include "Cesium/Math/MathHelper.h"
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 #include <Atom/RPI.Reflect/Buffer/BufferAsset.h>
@@ -309,6 +310,7 @@ namespace Cesium
 
         result.m_modelAsset = std::move(modelAsset);
         result.m_materialId = primitive.material;
+        result.m_bufferByteSize = totalBufferSize;
     }
 
     void GltfTrianglePrimitiveBuilder::DetermineLoadContext(const CommonAccessorViews& accessorViews, const GltfLoadMaterial& material)
@@ -628,6 +630,7 @@ namespace Cesium
             assert(m_normals.size() % 3 == 0);
 
             // Try to generate tangents and bitangents
+            ScopedTraceEvent traceEvent("Tile", "MikkTSpace");
             bool success = false;
             for (std::size_t i = 0; i < m_uvs.size(); ++i)
             {
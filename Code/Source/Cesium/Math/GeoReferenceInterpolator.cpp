@@ -145,6 +145,11 @@ namespace Cesium
         m_currentOrientation = glm::dquat(enuToECEF) * glm::dquat(currentPitchRollHead);
     }
 
+    double GeoReferenceInterpolator::GetTotalDuration() const
+    {
+        return m_totalDuration;
+    }
+
     glm::dvec3 GeoReferenceInterpolator::CalculatePitchRollHead(const glm::dvec3& position, const glm::dvec3& direction)
     {
         glm::dmat4 enuToECEF = CesiumGeospatial::Transforms::eastNorthUpToFixedFrame(position);
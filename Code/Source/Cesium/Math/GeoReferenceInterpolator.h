@@ -26,6 +26,9 @@ namespace Cesium
 
         void Update(float deltaTime) override;
 
+        // in seconds
+        double GetTotalDuration() const;
+
     private:
         glm::dvec3 CalculatePitchRollHead(const glm::dvec3& position, const glm::dvec3& direction);
 
@@ -0,0 +1,223 @@
+#include "Cesium/Systems/CameraBookmarks.h"
+#include <AzCore/std/algorithm.h>
+
+namespace Cesium
+{
+    CameraBookmarks::CameraBookmarks(ViewStateProvider& viewStateProvider)
+        : m_viewStateProvider{ viewStateProvider }
+    {
+    }
+
+    CameraBookmarks::~CameraBookmarks() noexcept
+    {
+        for (Bookmark& bookmark : m_bookmarks)
+        {
+            StopLoading(bookmark, CameraBookmarkState::Cold);
+        }
+    }
+
+    void CameraBookmarks::Add(
+        const AZStd::string& name,
+        const glm::dvec3& ecefPosition,
+        const glm::dvec3& ecefDirection,
+        const glm::dvec3& ecefUp,
+        std::uint64_t memoryBudgetBytes,
+        bool keepWarm)
+    {
+        Bookmark* bookmark = Find(name);
+        if (bookmark)
+        {
+            StopLoading(*bookmark, CameraBookmarkState::Cold);
+        }
+        else
+        {
+            bookmark = &m_bookmarks.emplace_back();
+            bookmark->m_name = name;
+            bookmark->m_prefetchViewsId = 0;
+            bookmark->m_state = CameraBookmarkState::Cold;
+            bookmark->m_loadedBytes = 0;
+        }
+
+        // the viewport size and field of view are replaced by the ones of the first viewport when the views are created
+        ViewportCamera& camera = bookmark->m_ecefCamera;
+        camera.m_position = ecefPosition;
+        camera.m_direction = glm::length(ecefDirection) > 0.0 ? glm::normalize(ecefDirection) : glm::dvec3{ 0.0, 1.0, 0.0 };
+        camera.m_up = ecefUp - glm::dot(ecefUp, camera.m_direction) * camera.m_direction;
+        camera.m_up = glm::length(camera.m_up) > 0.0 ? glm::normalize(camera.m_up) : glm::dvec3{ 0.0, 0.0, 1.0 };
+        camera.m_viewportSize = glm::dvec2{ 1920.0, 1080.0 };
+        camera.m_verticalFieldOfView = glm::radians(60.0);
+        camera.m_horizontalFieldOfView =
+            2.0 * glm::atan(glm::tan(camera.m_verticalFieldOfView * 0.5) * camera.m_viewportSize.x / camera.m_viewportSize.y);
+        bookmark->m_memoryBudgetBytes = memoryBudgetBytes;
+        bookmark->m_keepWarm = keepWarm;
+        if (keepWarm)
+        {
+            StartLoading(*bookmark);
+        }
+    }
+
+    bool CameraBookmarks::Remove(const AZStd::string& name)
+    {
+        Bookmark* bookmark = Find(name);
+        if (!bookmark)
+        {
+            return false;
+        }
+
+        StopLoading(*bookmark, CameraBookmarkState::Cold);
+        m_bookmarks.erase(m_bookmarks.begin() + (bookmark - m_bookmarks.data()));
+        return true;
+    }
+
+    AZStd::vector<AZStd::string> CameraBookmarks::GetNames() const
+    {
+        AZStd::vector<AZStd::string> names;
+        names.reserve(m_bookmarks.size());
+        for (const Bookmark& bookmark : m_bookmarks)
+        {
+            names.emplace_back(bookmark.m_name);
+        }
+
+        return names;
+    }
+
+    bool CameraBookmarks::Preload(const AZStd::string& name)
+    {
+        Bookmark* bookmark = Find(name);
+        if (!bookmark)
+        {
+            return false;
+        }
+
+        // a bookmark over its budget is loaded again, since the tiles of the other views may have been evicted since
+        if (bookmark->m_prefetchViewsId == 0)
+        {
+            StartLoading(*bookmark);
+        }
+
+        return true;
+    }
+
+    bool CameraBookmarks::Release(const AZStd::string& name)
+    {
+        Bookmark* bookmark = Find(name);
+        if (!bookmark)
+        {
+            return false;
+        }
+
+        if (!bookmark->m_keepWarm)
+        {
+            StopLoading(*bookmark, CameraBookmarkState::Cold);
+        }
+
+        return true;
+    }
+
+    bool CameraBookmarks::IsReady(const AZStd::string& name) const
+    {
+        const Bookmark* bookmark = Find(name);
+        return bookmark && bookmark->m_state == CameraBookmarkState::Ready;
+    }
+
+    CameraBookmarkStatus CameraBookmarks::GetStatus(const AZStd::string& name) const
+    {
+        CameraBookmarkStatus status;
+        if (const Bookmark* bookmark = Find(name))
+        {
+            status.m_state = bookmark->m_state;
+            status.m_loadedBytes = bookmark->m_loadedBytes;
+            status.m_memoryBudgetBytes = bookmark->m_memoryBudgetBytes;
+            status.m_keepWarm = bookmark->m_keepWarm;
+        }
+
+        return status;
+    }
+
+    bool CameraBookmarks::GetPose(
+        const AZStd::string& name, glm::dvec3& ecefPosition, glm::dvec3& ecefDirection, glm::dvec3& ecefUp) const
+    {
+        const Bookmark* bookmark = Find(name);
+        if (!bookmark)
+        {
+            return false;
+        }
+
+        ecefPosition = bookmark->m_ecefCamera.m_position;
+        ecefDirection = bookmark->m_ecefCamera.m_direction;
+        ecefUp = bookmark->m_ecefCamera.m_up;
+        return true;
+    }
+
+    void CameraBookmarks::Update(AZStd::vector<AZStd::string>& readyBookmarks)
+    {
+        for (Bookmark& bookmark : m_bookmarks)
+        {
+            if (bookmark.m_prefetchViewsId == 0)
+            {
+                continue;
+            }
+
+            bookmark.m_loadedBytes = m_viewStateProvider.GetPrefetchBytes(bookmark.m_prefetchViewsId);
+            if (bookmark.m_memoryBudgetBytes > 0 && bookmark.m_loadedBytes > bookmark.m_memoryBudgetBytes)
+            {
+                StopLoading(bookmark, CameraBookmarkState::OverBudget);
+                continue;
+            }
+
+            // a ready bookmark loads again when its tiles are evicted, like under memory pressure
+            bool ready = m_viewStateProvider.IsPrefetchReady(bookmark.m_prefetchViewsId);
+            if (ready && bookmark.m_state != CameraBookmarkState::Ready)
+            {
+                bookmark.m_state = CameraBookmarkState::Ready;
+                readyBookmarks.emplace_back(bookmark.m_name);
+            }
+            else if (!ready)
+            {
+                bookmark.m_state = CameraBookmarkState::Preloading;
+            }
+        }
+    }
+
+    CameraBookmarks::Bookmark* CameraBookmarks::Find(const AZStd::string& name)
+    {
+        auto bookmark = AZStd::find_if(
+            m_bookmarks.begin(), m_bookmarks.end(),
+            [&name](const Bookmark& candidate)
+            {
+                return candidate.m_name == name;
+            });
+        return bookmark != m_bookmarks.end() ? &*bookmark : nullptr;
+    }
+
+    const CameraBookmarks::Bookmark* CameraBookmarks::Find(const AZStd::string& name) const
+    {
+        auto bookmark = AZStd::find_if(
+            m_bookmarks.begin(), m_bookmarks.end(),
+            [&name](const Bookmark& candidate)
+            {
+                return candidate.m_name == name;
+            });
+        return bookmark != m_bookmarks.end() ? &*bookmark : nullptr;
+    }
+
+    void CameraBookmarks::StartLoading(Bookmark& bookmark)
+    {
+        AZStd::vector<ViewportCamera> ecefCameras;
+        ecefCameras.emplace_back(bookmark.m_ecefCamera);
+        bookmark.m_prefetchViewsId = m_viewStateProvider.AddPrefetchViews(AZStd::move(ecefCameras));
+        bookmark.m_state = CameraBookmarkState::Preloading;
+        bookmark.m_loadedBytes = 0;
+    }
+
+    void CameraBookmarks::StopLoading(Bookmark& bookmark, CameraBookmarkState state)
+    {
+        if (bookmark.m_prefetchViewsId != 0)
+        {
+            m_viewStateProvider.RemovePrefetchViews(bookmark.m_prefetchViewsId);
+            bookmark.m_prefetchViewsId = 0;
+        }
+
+        bookmark.m_state = state;
+    }
+} // namespace Cesium
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Cesium/Systems/ViewStateProvider.h"
+#include <Cesium/EBus/CameraBookmarkBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Named camera poses in ECEF whose tiles are loaded ahead of time through the prefetch views of the ViewStateProvider. A warm
+    // bookmark keeps its views, so its tiles stay in the caches of the tilesets and jumping to it shows full detail in the first
+    // frame. Other bookmarks are only loaded on request. A bookmark whose tiles need more than its memory budget drops its views.
+    class CameraBookmarks final
+    {
+    public:
+        explicit CameraBookmarks(ViewStateProvider& viewStateProvider);
+
+        ~CameraBookmarks() noexcept;
+
+        CameraBookmarks(const CameraBookmarks&) = delete;
+
+        CameraBookmarks& operator=(const CameraBookmarks&) = delete;
+
+        void Add(
+            const AZStd::string& name,
+            const glm::dvec3& ecefPosition,
+            const glm::dvec3& ecefDirection,
+            const glm::dvec3& ecefUp,
+            std::uint64_t memoryBudgetBytes,
+            bool keepWarm);
+
+        bool Remove(const AZStd::string& name);
+
+        AZStd::vector<AZStd::string> GetNames() const;
+
+        bool Preload(const AZStd::string& name);
+
+        // a warm bookmark keeps its views
+        bool Release(const AZStd::string& name);
+
+        bool IsReady(const AZStd::string& name) const;
+
+        CameraBookmarkStatus GetStatus(const AZStd::string& name) const;
+
+        // return false if there is no bookmark with the name
+        bool GetPose(const AZStd::string& name, glm::dvec3& ecefPosition, glm::dvec3& ecefDirection, glm::dvec3& ecefUp) const;
+
+        // read the readiness and the bytes reported by the tilesets last frame. Called once per frame after the ViewStateProvider
+        // is updated. readyBookmarks receives the bookmarks that became ready
+        void Update(AZStd::vector<AZStd::string>& readyBookmarks);
+
+    private:
+        struct Bookmark
+        {
+            AZStd::string m_name;
+            ViewportCamera m_ecefCamera;
+            std::uint64_t m_memoryBudgetBytes;
+            ViewStateProvider::PrefetchViewsId m_prefetchViewsId;
+            CameraBookmarkState m_state;
+            std::uint64_t m_loadedBytes;
+            bool m_keepWarm;
+        };
+
+        Bookmark* Find(const AZStd::string& name);
+
+        const Bookmark* Find(const AZStd::string& name) const;
+
+        void StartLoading(Bookmark& bookmark);
+
+        void StopLoading(Bookmark& bookmark, CameraBookmarkState state);
+
+        ViewStateProvider& m_viewStateProvider;
+        AZStd::vector<Bookmark> m_bookmarks;
+    };
+} // namespace Cesium
@@ -7,18 +7,42 @@
 namespace Cesium
 {
     CesiumSystem::CesiumSystem()
+        : CesiumSystem(ExecutionMode::Concurrent)
     {
-        // initialize IO managers
-        m_httpManager = AZStd::make_unique<HttpManager>();
-        m_localFileManager = AZStd::make_unique<LocalFileManager>();
+    }
+
+    CesiumSystem::CesiumSystem(ExecutionMode executionMode)
+        : CesiumSystem(executionMode, ThreadAffinityPolicy{})
+    {
+    }
+
+    CesiumSystem::CesiumSystem(ExecutionMode executionMode, const ThreadAffinityPolicy& affinityPolicy)
+        : m_executionMode{ executionMode }
+        , m_affinityPolicy{ affinityPolicy }
+        , m_cameraBookmarks{ m_viewStateProvider }
+    {
+        // in deterministic mode, every task and IO request goes through a single queue and camera paths use a fixed time step.
+        // Otherwise, the job managers create their threads according to the affinity policy
+        if (m_executionMode == ExecutionMode::Deterministic)
+        {
+            m_deterministicQueue = AZStd::make_unique<DeterministicTaskQueue>();
+            m_virtualClock.Enable();
+
+            m_httpManager = AZStd::make_unique<HttpManager>(m_deterministicQueue.get());
+            m_localFileManager = AZStd::make_unique<LocalFileManager>(m_deterministicQueue.get());
+            m_taskProcessor = std::make_shared<TaskProcessor>(m_deterministicQueue.get());
+        }
+        else
+        {
+            m_httpManager = AZStd::make_unique<HttpManager>(m_affinityPolicy);
+            m_localFileManager = AZStd::make_unique<LocalFileManager>(m_affinityPolicy);
+            m_taskProcessor = std::make_shared<TaskProcessor>(m_affinityPolicy);
+        }
 
         // initialize asset accessors
         m_httpAssetAccessor = std::make_shared<HttpAssetAccessor>(m_httpManager.get());
         m_localFileAssetAccessor = std::make_shared<GenericAssetAccessor>(m_localFileManager.get(), "");
 
-        // initialize task processor
-        m_taskProcessor = std::make_shared<TaskProcessor>();
-
         // initialize credit system
         m_creditSystem = std::make_shared<Cesium3DTilesSelection::CreditSystem>();
 
@@ -28,6 +52,21 @@ namespace Cesium
         m_logger->sinks().push_back(std::make_shared<LoggerSink>());
     }
 
+    CesiumSystem::~CesiumSystem() noexcept
+    {
+        // the workers can log until they are joined, and the sinks of the logger are not protected against a log() in another thread
+        m_httpAssetAccessor.reset();
+        m_localFileAssetAccessor.reset();
+        m_taskProcessor.reset();
+        m_httpManager.reset();
+        m_localFileManager.reset();
+        m_deterministicQueue.reset();
+
+        // the logger is global, so release the sink here to stop its drain thread together with the system
+        m_logger->flush();
+        m_logger->sinks().clear();
+    }
+
     GenericIOManager& CesiumSystem::GetIOManager(IOKind kind)
     {
         switch (kind)
@@ -73,4 +112,64 @@ namespace Cesium
     {
         return m_criticalAssetManager;
     }
+
+    TraceRecorder& CesiumSystem::GetTraceRecorder()
+    {
+        return m_traceRecorder;
+    }
+
+    MemoryTracker& CesiumSystem::GetMemoryTracker()
+    {
+        return m_memoryTracker;
+    }
+
+    MemoryBudget& CesiumSystem::GetMemoryBudget()
+    {
+        return m_memoryBudget;
+    }
+
+    LoadSlotArbiter& CesiumSystem::GetLoadSlotArbiter()
+    {
+        return m_loadSlotArbiter;
+    }
+
+    TileOccluderRegistry& CesiumSystem::GetTileOccluderRegistry()
+    {
+        return m_tileOccluderRegistry;
+    }
+
+    HttpMetrics& CesiumSystem::GetHttpMetrics()
+    {
+        return m_httpManager->GetMetrics();
+    }
+
+    ExecutionMode CesiumSystem::GetExecutionMode() const
+    {
+        return m_executionMode;
+    }
+
+    const ThreadAffinityPolicy& CesiumSystem::GetThreadAffinityPolicy() const
+    {
+        return m_affinityPolicy;
+    }
+
+    DeterministicTaskQueue* CesiumSystem::GetDeterministicTaskQueue()
+    {
+        return m_deterministicQueue.get();
+    }
+
+    VirtualClock& CesiumSystem::GetVirtualClock()
+    {
+        return m_virtualClock;
+    }
+
+    ViewStateProvider& CesiumSystem::GetViewStateProvider()
+    {
+        return m_viewStateProvider;
+    }
+
+    CameraBookmarks& CesiumSystem::GetCameraBookmarks()
+    {
+        return m_cameraBookmarks;
+    }
 } // namespace Cesium
\ No newline at end of file
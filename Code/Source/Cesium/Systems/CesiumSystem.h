@@ -4,6 +4,16 @@
 #include "Cesium/Systems/LocalFileManager.h"
 #include "Cesium/Systems/HttpManager.h"
 #include "Cesium/Systems/CriticalAssetManager.h"
+#include "Cesium/Systems/TraceRecorder.h"
+#include "Cesium/Systems/MemoryTracker.h"
+#include "Cesium/Systems/MemoryBudget.h"
+#include "Cesium/Systems/LoadSlotArbiter.h"
+#include "Cesium/Systems/TileOccluderRegistry.h"
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/VirtualClock.h"
+#include "Cesium/Systems/ThreadAffinityPolicy.h"
+#include "Cesium/Systems/ViewStateProvider.h"
+#include "Cesium/Systems/CameraBookmarks.h"
 #include <AzCore/JSON/rapidjson.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/TypeInfo.h>
@@ -25,12 +35,25 @@ namespace Cesium
         Http
     };
 
+    enum class ExecutionMode
+    {
+        // tasks and IO requests run concurrently on the job managers
+        Concurrent,
+
+        // tasks and IO requests run in submission order on one queue that is drained every tick
+        Deterministic
+    };
+
     class CesiumSystem final
     {
     public:
         CesiumSystem();
 
-        ~CesiumSystem() noexcept = default;
+        explicit CesiumSystem(ExecutionMode executionMode);
+
+        CesiumSystem(ExecutionMode executionMode, const ThreadAffinityPolicy& affinityPolicy);
+
+        ~CesiumSystem() noexcept;
 
         GenericIOManager& GetIOManager(IOKind kind);
 
@@ -44,7 +67,42 @@ namespace Cesium
 
         const CriticalAssetManager& GetCriticalAssetManager() const;
 
+        TraceRecorder& GetTraceRecorder();
+
+        MemoryTracker& GetMemoryTracker();
+
+        MemoryBudget& GetMemoryBudget();
+
+        LoadSlotArbiter& GetLoadSlotArbiter();
+
+        TileOccluderRegistry& GetTileOccluderRegistry();
+
+        HttpMetrics& GetHttpMetrics();
+
+        ExecutionMode GetExecutionMode() const;
+
+        const ThreadAffinityPolicy& GetThreadAffinityPolicy() const;
+
+        // return nullptr in concurrent mode
+        DeterministicTaskQueue* GetDeterministicTaskQueue();
+
+        VirtualClock& GetVirtualClock();
+
+        ViewStateProvider& GetViewStateProvider();
+
+        CameraBookmarks& GetCameraBookmarks();
+
     private:
+        ExecutionMode m_executionMode;
+        ThreadAffinityPolicy m_affinityPolicy;
+
+        // declared before the task processor and the IO managers, so it outlives the tasks and requests that record into it
+        TraceRecorder m_traceRecorder;
+        MemoryTracker m_memoryTracker;
+        MemoryBudget m_memoryBudget;
+        LoadSlotArbiter m_loadSlotArbiter;
+        TileOccluderRegistry m_tileOccluderRegistry;
+        AZStd::unique_ptr<DeterministicTaskQueue> m_deterministicQueue;
         AZStd::unique_ptr<HttpManager> m_httpManager;
         AZStd::unique_ptr<LocalFileManager> m_localFileManager;
         std::shared_ptr<CesiumAsync::IAssetAccessor> m_httpAssetAccessor;
@@ -53,6 +111,9 @@ namespace Cesium
         std::shared_ptr<spdlog::logger> m_logger;
         std::shared_ptr<Cesium3DTilesSelection::CreditSystem> m_creditSystem;
         CriticalAssetManager m_criticalAssetManager;
+        VirtualClock m_virtualClock;
+        ViewStateProvider m_viewStateProvider;
+        CameraBookmarks m_cameraBookmarks;
     };
 } // namespace Cesium
 
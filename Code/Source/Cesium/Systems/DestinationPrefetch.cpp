@@ -0,0 +1,62 @@
+#include "Cesium/Systems/DestinationPrefetch.h"
+
+namespace Cesium
+{
+    DestinationPrefetch::DestinationPrefetch()
+        : m_destination{ 0.0 }
+        , m_prefetchViewsId{ 0 }
+        , m_ready{ false }
+    {
+    }
+
+    void DestinationPrefetch::Start(
+        ViewStateProvider& viewStateProvider, const glm::dvec3& destination, AZStd::vector<ViewportCamera> ecefCameras)
+    {
+        Stop(viewStateProvider);
+        m_destination = destination;
+        if (!ecefCameras.empty())
+        {
+            m_prefetchViewsId = viewStateProvider.AddPrefetchViews(AZStd::move(ecefCameras));
+        }
+    }
+
+    void DestinationPrefetch::Update(ViewStateProvider& viewStateProvider)
+    {
+        // the views are kept after the fly stops until the destination is ready, since it's also the current view by then
+        if (m_prefetchViewsId == 0 || !viewStateProvider.IsPrefetchReady(m_prefetchViewsId))
+        {
+            return;
+        }
+
+        viewStateProvider.RemovePrefetchViews(m_prefetchViewsId);
+        m_prefetchViewsId = 0;
+        m_ready = true;
+        m_readyEvent.Signal(m_destination);
+    }
+
+    void DestinationPrefetch::Stop(ViewStateProvider& viewStateProvider)
+    {
+        if (m_prefetchViewsId != 0)
+        {
+            viewStateProvider.RemovePrefetchViews(m_prefetchViewsId);
+            m_prefetchViewsId = 0;
+        }
+
+        m_ready = false;
+    }
+
+    bool DestinationPrefetch::IsPending() const
+    {
+        return m_prefetchViewsId != 0;
+    }
+
+    bool DestinationPrefetch::IsReady() const
+    {
+        return m_ready;
+    }
+
+    void DestinationPrefetch::BindReadyEventHandler(CameraDestinationReadyEvent::Handler& handler)
+    {
+        handler.Connect(m_readyEvent);
+    }
+} // namespace Cesium
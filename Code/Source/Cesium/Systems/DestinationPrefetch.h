@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Cesium/Systems/ViewStateProvider.h"
+#include <Cesium/EBus/GeoReferenceCameraFlyControllerBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <glm/glm.hpp>
+
+namespace Cesium
+{
+    // Loads the tiles of a camera destination, like the end of a camera fly, through the prefetch views of the ViewStateProvider.
+    // The views are kept until every tileset rendered their tiles at full detail, then the ready event is signaled once with the
+    // destination and the views are removed.
+    class DestinationPrefetch final
+    {
+    public:
+        DestinationPrefetch();
+
+        // replace the views of the last destination
+        void Start(ViewStateProvider& viewStateProvider, const glm::dvec3& destination, AZStd::vector<ViewportCamera> ecefCameras);
+
+        // read the readiness reported by the tilesets last frame. Called once per frame
+        void Update(ViewStateProvider& viewStateProvider);
+
+        // remove the views without signaling the destination
+        void Stop(ViewStateProvider& viewStateProvider);
+
+        bool IsPending() const;
+
+        bool IsReady() const;
+
+        void BindReadyEventHandler(CameraDestinationReadyEvent::Handler& handler);
+
+    private:
+        CameraDestinationReadyEvent m_readyEvent;
+        glm::dvec3 m_destination;
+        ViewStateProvider::PrefetchViewsId m_prefetchViewsId;
+        bool m_ready;
+    };
+} // namespace Cesium
@@ -0,0 +1,45 @@
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+
+namespace Cesium
+{
+    DeterministicTaskQueue::DeterministicTaskQueue()
+    {
+    }
+
+    void DeterministicTaskQueue::Push(std::function<void()> task)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_tasksMutex);
+        m_tasks.emplace_back(std::move(task));
+    }
+
+    std::size_t DeterministicTaskQueue::RunPending()
+    {
+        std::size_t executedTasks = 0;
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                AZStd::scoped_lock<AZStd::mutex> lock(m_tasksMutex);
+                if (m_tasks.empty())
+                {
+                    break;
+                }
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            // the task may push more tasks, so the lock must not be held while running it
+            task();
+            ++executedTasks;
+        }
+
+        return executedTasks;
+    }
+
+    std::size_t DeterministicTaskQueue::GetPendingCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_tasksMutex);
+        return m_tasks.size();
+    }
+} // namespace Cesium
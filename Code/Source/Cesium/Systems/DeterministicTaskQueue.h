@@ -0,0 +1,29 @@
+#pragma once
+
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <cstddef>
+#include <functional>
+
+namespace Cesium
+{
+    // Single FIFO queue that replaces the job managers of TaskProcessor and the IO managers in deterministic mode.
+    // Nothing runs until RunPending() is called, and then every task runs on the calling thread in submission order,
+    // so the same workload always produces the same order of tile loads.
+    class DeterministicTaskQueue final
+    {
+    public:
+        DeterministicTaskQueue();
+
+        void Push(std::function<void()> task);
+
+        // run tasks until the queue is empty, including the tasks that are pushed while running. Return the number of executed tasks
+        std::size_t RunPending();
+
+        std::size_t GetPendingCount() const;
+
+    private:
+        mutable AZStd::mutex m_tasksMutex;
+        AZStd::deque<std::function<void()>> m_tasks;
+    };
+} // namespace Cesium
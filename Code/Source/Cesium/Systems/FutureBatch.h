@@ -0,0 +1,109 @@
+#pragma once
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/Future.h>
+#include <CesiumAsync/Promise.h>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Cesium
+{
+    // Joins a batch of futures into one future of their results, in the order they were added. The futures share a single state, and
+    // each of them only adds a continuation that captures that state and its index, so the batch is handed to one continuation
+    // instead of a lambda chain per request. The first rejected future rejects the batch. T must be default constructible
+    template<typename T>
+    class FutureBatch final
+    {
+    public:
+        explicit FutureBatch(const CesiumAsync::AsyncSystem& asyncSystem)
+            : m_asyncSystem{ asyncSystem }
+        {
+        }
+
+        void Reserve(std::size_t size)
+        {
+            m_futures.reserve(size);
+        }
+
+        void Add(CesiumAsync::Future<T>&& future)
+        {
+            m_futures.emplace_back(std::move(future));
+        }
+
+        std::size_t GetSize() const
+        {
+            return m_futures.size();
+        }
+
+        // the futures are only continued here, once the results are sized, so they can resolve on any thread
+        CesiumAsync::Future<std::vector<T>> WhenAll() &&
+        {
+            if (m_futures.empty())
+            {
+                return m_asyncSystem.createResolvedFuture(std::vector<T>{});
+            }
+
+            auto state = std::make_shared<State>(m_asyncSystem.createPromise<std::vector<T>>(), m_futures.size());
+            CesiumAsync::Future<std::vector<T>> result = state->m_promise.getFuture();
+            for (std::size_t i = 0; i < m_futures.size(); ++i)
+            {
+                std::move(m_futures[i])
+                    .thenImmediately(
+                        [state, i](T&& value)
+                        {
+                            state->m_results[i] = std::move(value);
+                            state->Release();
+                        })
+                    .catchImmediately(
+                        [state](std::exception&& error)
+                        {
+                            state->Reject(error);
+                        });
+            }
+
+            m_futures.clear();
+            return result;
+        }
+
+    private:
+        struct State
+        {
+            State(CesiumAsync::Promise<std::vector<T>>&& promise, std::size_t size)
+                : m_promise{ std::move(promise) }
+                , m_results(size)
+                , m_remaining{ size }
+                , m_rejected{ false }
+            {
+            }
+
+            void Release()
+            {
+                if (m_remaining.fetch_sub(1) == 1 && !m_rejected.load())
+                {
+                    m_promise.resolve(std::move(m_results));
+                }
+            }
+
+            void Reject(const std::exception& error)
+            {
+                if (!m_rejected.exchange(true))
+                {
+                    m_promise.reject(std::runtime_error(error.what()));
+                }
+            }
+
+            CesiumAsync::Promise<std::vector<T>> m_promise;
+            std::vector<T> m_results;
+            std::atomic<std::size_t> m_remaining;
+            std::atomic<bool> m_rejected;
+        };
+
+        CesiumAsync::AsyncSystem m_asyncSystem;
+        std::vector<CesiumAsync::Future<T>> m_futures;
+    };
+} // namespace Cesium
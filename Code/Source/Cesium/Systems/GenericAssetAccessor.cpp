@@ -12,20 +12,30 @@ namespace Cesium
     {
         std::shared_ptr<CesiumAsync::IAssetRequest> operator()(IOContent&& result)
         {
-            // Hack: We need to add prefix here, so that Cesium Native can compose absolute url from base url and relative url correctly
-            m_url = PREFIX + m_url;
-            std::uint16_t responseStatus = 200;
-            if (result.empty())
+            return CreateRequest(m_contentType, m_url, std::move(m_headers), std::move(result));
+        }
+
+        std::string m_contentType;
+        std::string m_url;
+        CesiumAsync::HttpHeaders m_headers;
+    };
+
+    struct GenericAssetAccessor::RequestAssetsHandler
+    {
+        std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>> operator()(std::vector<IOContent>&& results)
+        {
+            std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>> requests;
+            requests.reserve(results.size());
+            for (std::size_t i = 0; i < results.size(); ++i)
             {
-                responseStatus = 404;
+                requests.emplace_back(CreateRequest(m_contentType, m_urls[i], m_headers, std::move(results[i])));
             }
 
-            auto response = std::make_unique<GenericAssetResponse>(responseStatus, std::move(m_contentType), std::move(result));
-            return std::make_shared<GenericAssetRequest>(std::move(m_url), std::move(m_headers), std::move(response));
+            return requests;
         }
 
         std::string m_contentType;
-        std::string m_url;
+        std::vector<std::string> m_urls;
         CesiumAsync::HttpHeaders m_headers;
     };
 
@@ -36,19 +46,11 @@ namespace Cesium
     }
 
     CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> GenericAssetAccessor::requestAsset(
-        const CesiumAsync::AsyncSystem& asyncSystem, const std::string& url, [[maybe_unused]] const std::vector<THeader>& headers)
+        const CesiumAsync::AsyncSystem& asyncSystem, const std::string& url, const std::vector<THeader>& headers)
     {
-        // Hack: We need to add prefix in the RequestAssetHandler above, so that Cesium Native can compose absolute url from base url and
-        // relative url correctly. We need to remove the prefix before sending the url to GenericIOManager
-        if (url.substr(0, PREFIX.size()) == PREFIX)
-        {
-            std::string noPrefixUrl = url.substr(PREFIX.size());
-            return m_ioManager->GetFileContentAsync(asyncSystem, IORequestParameter{ "", noPrefixUrl.c_str() })
-                .thenImmediately(RequestAssetHandler{ m_contentType, noPrefixUrl, ConvertToCesiumHeaders(headers) });
-        }
-
-        return m_ioManager->GetFileContentAsync(asyncSystem, IORequestParameter{ "", url.c_str() })
-            .thenImmediately(RequestAssetHandler{ m_contentType, url, ConvertToCesiumHeaders(headers) });
+        std::string noPrefixUrl = RemovePrefix(url);
+        return m_ioManager->GetFileContentAsync(asyncSystem, IORequestParameter{ "", noPrefixUrl.c_str() })
+            .thenImmediately(RequestAssetHandler{ m_contentType, std::move(noPrefixUrl), ConvertToCesiumHeaders(headers) });
     }
 
     CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> GenericAssetAccessor::post(
@@ -64,6 +66,44 @@ namespace Cesium
     {
     }
 
+    CesiumAsync::Future<std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>>> GenericAssetAccessor::RequestAssets(
+        const CesiumAsync::AsyncSystem& asyncSystem, const std::vector<std::string>& urls, const std::vector<THeader>& headers)
+    {
+        std::vector<std::string> noPrefixUrls;
+        std::vector<IORequestParameter> ioRequests;
+        noPrefixUrls.reserve(urls.size());
+        ioRequests.reserve(urls.size());
+        for (const std::string& url : urls)
+        {
+            noPrefixUrls.emplace_back(RemovePrefix(url));
+            ioRequests.emplace_back(IORequestParameter{ "", noPrefixUrls.back().c_str() });
+        }
+
+        return m_ioManager->GetFilesContentAsync(asyncSystem, std::move(ioRequests))
+            .thenImmediately(RequestAssetsHandler{ m_contentType, std::move(noPrefixUrls), ConvertToCesiumHeaders(headers) });
+    }
+
+    std::string GenericAssetAccessor::RemovePrefix(const std::string& url)
+    {
+        // Hack: We need to add prefix in CreateRequest below, so that Cesium Native can compose absolute url from base url and relative
+        // url correctly. We need to remove the prefix before sending the url to GenericIOManager
+        if (url.substr(0, PREFIX.size()) == PREFIX)
+        {
+            return url.substr(PREFIX.size());
+        }
+
+        return url;
+    }
+
+    std::shared_ptr<CesiumAsync::IAssetRequest> GenericAssetAccessor::CreateRequest(
+        const std::string& contentType, const std::string& url, CesiumAsync::HttpHeaders headers, IOContent&& content)
+    {
+        // Hack: We need to add prefix here, so that Cesium Native can compose absolute url from base url and relative url correctly
+        std::uint16_t responseStatus = content.empty() ? 404 : 200;
+        auto response = std::make_unique<GenericAssetResponse>(responseStatus, std::string(contentType), std::move(content));
+        return std::make_shared<GenericAssetRequest>(PREFIX + url, std::move(headers), std::move(response));
+    }
+
     CesiumAsync::HttpHeaders GenericAssetAccessor::ConvertToCesiumHeaders(const std::vector<THeader>& headers)
     {
         CesiumAsync::HttpHeaders convertedHeaders;
@@ -5,6 +5,9 @@
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetResponse.h>
 #include <CesiumAsync/Future.h>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace Cesium
 {
@@ -87,6 +90,7 @@ namespace Cesium
     class GenericAssetAccessor final : public CesiumAsync::IAssetAccessor
     {
         struct RequestAssetHandler;
+        struct RequestAssetsHandler;
 
     public:
         GenericAssetAccessor(GenericIOManager* ioManager, const std::string& contentType);
@@ -102,9 +106,19 @@ namespace Cesium
 
         void tick() noexcept override;
 
+        // read a batch of assets with GenericIOManager::GetFilesContentAsync, and create all their requests in one continuation
+        CesiumAsync::Future<std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>>> RequestAssets(
+            const CesiumAsync::AsyncSystem& asyncSystem, const std::vector<std::string>& urls, const std::vector<THeader>& headers = {});
+
     private:
         static const std::string PREFIX;
 
+        // the url without the prefix, as GenericIOManager expects it
+        static std::string RemovePrefix(const std::string& url);
+
+        static std::shared_ptr<CesiumAsync::IAssetRequest> CreateRequest(
+            const std::string& contentType, const std::string& url, CesiumAsync::HttpHeaders headers, IOContent&& content);
+
         static CesiumAsync::HttpHeaders ConvertToCesiumHeaders(const std::vector<THeader>& headers);
 
         GenericIOManager* m_ioManager;
@@ -1 +1,18 @@
 #include "Cesium/Systems/GenericIOManager.h"
+#include "Cesium/Systems/FutureBatch.h"
+
+namespace Cesium
+{
+    CesiumAsync::Future<std::vector<IOContent>> GenericIOManager::GetFilesContentAsync(
+        const CesiumAsync::AsyncSystem& asyncSystem, std::vector<IORequestParameter>&& requests)
+    {
+        FutureBatch<IOContent> batch{ asyncSystem };
+        batch.Reserve(requests.size());
+        for (IORequestParameter& request : requests)
+        {
+            batch.Add(GetFileContentAsync(asyncSystem, std::move(request)));
+        }
+
+        return std::move(batch).WhenAll();
+    }
+} // namespace Cesium
@@ -33,5 +33,9 @@ namespace Cesium
 
         virtual CesiumAsync::Future<IOContent> GetFileContentAsync(
             const CesiumAsync::AsyncSystem& asyncSystem, IORequestParameter&& request) = 0;
+
+        // the contents in the order of the requests. By default the requests are joined with a FutureBatch
+        virtual CesiumAsync::Future<std::vector<IOContent>> GetFilesContentAsync(
+            const CesiumAsync::AsyncSystem& asyncSystem, std::vector<IORequestParameter>&& requests);
     };
 } // namespace Cesium
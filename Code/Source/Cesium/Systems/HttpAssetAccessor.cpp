@@ -1,11 +1,39 @@
 #include "Cesium/Systems/HttpAssetAccessor.h"
 #include "Cesium/PlatformInfo/PlatformInfo.h"
+#include "Cesium/Systems/FutureBatch.h"
 #include <cassert>
 #include <string>
 #include <zlib.h>
 
 namespace Cesium
 {
+    struct HttpAssetAccessor::RequestAssetHandler
+    {
+        std::shared_ptr<CesiumAsync::IAssetRequest> operator()(HttpResult&& result)
+        {
+            return HttpAssetAccessor::CreateO3DEAssetRequest(*result.m_request, result.m_response.get(), *m_metrics);
+        }
+
+        HttpMetrics* m_metrics;
+    };
+
+    struct HttpAssetAccessor::RequestAssetsHandler
+    {
+        std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>> operator()(std::vector<HttpResult>&& results)
+        {
+            std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>> requests;
+            requests.reserve(results.size());
+            for (HttpResult& result : results)
+            {
+                requests.emplace_back(HttpAssetAccessor::CreateO3DEAssetRequest(*result.m_request, result.m_response.get(), *m_metrics));
+            }
+
+            return requests;
+        }
+
+        HttpMetrics* m_metrics;
+    };
+
     HttpAssetAccessor::HttpAssetAccessor(HttpManager* httpManager)
         : m_httpManager{ httpManager }
     {
@@ -17,15 +45,8 @@ namespace Cesium
     CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> HttpAssetAccessor::requestAsset(
         const CesiumAsync::AsyncSystem& asyncSystem, const std::string& url, const std::vector<THeader>& headers)
     {
-        CesiumAsync::HttpHeaders requestHeaders = ConvertToCesiumHeaders(headers);
-        requestHeaders[USER_AGENT_HEADER_KEY] = m_userAgentHeaderValue;
-        HttpRequestParameter parameter(AZStd ::string(url.c_str()), Aws::Http::HttpMethod::HTTP_GET, std::move(requestHeaders));
-        return m_httpManager->AddRequest(asyncSystem, std::move(parameter))
-            .thenImmediately(
-                [](HttpResult&& result) -> std::shared_ptr<CesiumAsync::IAssetRequest>
-                {
-                    return HttpAssetAccessor::CreateO3DEAssetRequest(*result.m_request, result.m_response.get());
-                });
+        return m_httpManager->AddRequest(asyncSystem, CreateGetParameter(url, headers))
+            .thenImmediately(RequestAssetHandler{ &m_httpManager->GetMetrics() });
     }
 
     CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> HttpAssetAccessor::post(
@@ -40,17 +61,33 @@ namespace Cesium
         HttpRequestParameter parameter(
             AZStd ::string(url.c_str()), Aws::Http::HttpMethod::HTTP_POST, std::move(requestHeaders), std::move(requestBody));
         return m_httpManager->AddRequest(asyncSystem, std::move(parameter))
-            .thenImmediately(
-                [](HttpResult&& result) -> std::shared_ptr<CesiumAsync::IAssetRequest>
-                {
-                    return HttpAssetAccessor::CreateO3DEAssetRequest(*result.m_request, result.m_response.get());
-                });
+            .thenImmediately(RequestAssetHandler{ &m_httpManager->GetMetrics() });
     }
 
     void HttpAssetAccessor::tick() noexcept
     {
     }
 
+    CesiumAsync::Future<std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>>> HttpAssetAccessor::RequestAssets(
+        const CesiumAsync::AsyncSystem& asyncSystem, const std::vector<std::string>& urls, const std::vector<THeader>& headers)
+    {
+        FutureBatch<HttpResult> batch{ asyncSystem };
+        batch.Reserve(urls.size());
+        for (const std::string& url : urls)
+        {
+            batch.Add(m_httpManager->AddRequest(asyncSystem, CreateGetParameter(url, headers)));
+        }
+
+        return std::move(batch).WhenAll().thenImmediately(RequestAssetsHandler{ &m_httpManager->GetMetrics() });
+    }
+
+    HttpRequestParameter HttpAssetAccessor::CreateGetParameter(const std::string& url, const std::vector<THeader>& headers) const
+    {
+        CesiumAsync::HttpHeaders requestHeaders = ConvertToCesiumHeaders(headers);
+        requestHeaders[USER_AGENT_HEADER_KEY] = m_userAgentHeaderValue;
+        return HttpRequestParameter(AZStd::string(url.c_str()), Aws::Http::HttpMethod::HTTP_GET, std::move(requestHeaders));
+    }
+
     std::string HttpAssetAccessor::ConvertMethodToString(Aws::Http::HttpMethod method)
     {
         switch (method)
@@ -96,7 +133,7 @@ namespace Cesium
     }
 
     std::shared_ptr<HttpAssetRequest> HttpAssetAccessor::CreateO3DEAssetRequest(
-        const Aws::Http::HttpRequest& request, Aws::Http::HttpResponse* response)
+        const Aws::Http::HttpRequest& request, Aws::Http::HttpResponse* response, HttpMetrics& metrics)
     {
         std::string method = ConvertMethodToString(request.GetMethod());
         std::string url = request.GetURIString().c_str();
@@ -104,7 +141,7 @@ namespace Cesium
         std::unique_ptr<HttpAssetResponse> assetResponse;
         if (response)
         {
-            assetResponse = CreateO3DEAssetResponse(*response);
+            assetResponse = CreateO3DEAssetResponse(request, *response, metrics);
         }
         else
         {
@@ -114,7 +151,8 @@ namespace Cesium
         return std::make_shared<HttpAssetRequest>(std::move(method), std::move(url), std::move(headers), std::move(assetResponse));
     }
 
-    std::unique_ptr<HttpAssetResponse> HttpAssetAccessor::CreateO3DEAssetResponse(Aws::Http::HttpResponse& response)
+    std::unique_ptr<HttpAssetResponse> HttpAssetAccessor::CreateO3DEAssetResponse(
+        const Aws::Http::HttpRequest& request, Aws::Http::HttpResponse& response, HttpMetrics& metrics)
     {
         std::uint16_t statusCode = static_cast<std::uint16_t>(response.GetResponseCode());
         std::string contentType = response.GetContentType().c_str();
@@ -127,8 +165,11 @@ namespace Cesium
         {
             if (contentEncoding->second.find("gzip") != std::string::npos)
             {
+                std::size_t compressedSize = responseContent.size();
+                IOContent decodedContent = DecodeGzip(responseContent);
+                metrics.RecordDecompression(request.GetUri().GetAuthority().c_str(), compressedSize, decodedContent.size());
                 return std::make_unique<HttpAssetResponse>(
-                    statusCode, std::move(contentType), std::move(headers), DecodeGzip(responseContent));
+                    statusCode, std::move(contentType), std::move(headers), std::move(decodedContent));
             }
         }
 
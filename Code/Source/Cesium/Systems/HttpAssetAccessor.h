@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Cesium/Systems/HttpManager.h"
+#include "Cesium/Systems/MemoryTracker.h"
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/Future.h>
@@ -34,6 +35,7 @@ namespace Cesium
             , m_contentType{ std::move(contentType) }
             , m_headers{ std::move(headers) }
             , m_responseData{ std::move(responseData) }
+            , m_trackedMemory{ MemoryTrackerInterface::Get(), MemoryCategory::HttpBodies, m_responseData.size() }
         {
         }
 
@@ -62,6 +64,7 @@ namespace Cesium
         std::string m_contentType;
         CesiumAsync::HttpHeaders m_headers;
         IOContent m_responseData;
+        TrackedMemory m_trackedMemory;
     };
 
     class HttpAssetRequest final : public CesiumAsync::IAssetRequest
@@ -105,6 +108,9 @@ namespace Cesium
 
     class HttpAssetAccessor final : public CesiumAsync::IAssetAccessor
     {
+        struct RequestAssetHandler;
+        struct RequestAssetsHandler;
+
     public:
         HttpAssetAccessor(HttpManager* httpManager);
 
@@ -119,7 +125,13 @@ namespace Cesium
 
         void tick() noexcept override;
 
+        // send a batch of GET requests and join them with a FutureBatch, so all their asset requests are created in one continuation
+        CesiumAsync::Future<std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>>> RequestAssets(
+            const CesiumAsync::AsyncSystem& asyncSystem, const std::vector<std::string>& urls, const std::vector<THeader>& headers = {});
+
     private:
+        HttpRequestParameter CreateGetParameter(const std::string& url, const std::vector<THeader>& headers) const;
+
         static std::string ConvertMethodToString(Aws::Http::HttpMethod method);
 
         static CesiumAsync::HttpHeaders ConvertToCesiumHeaders(const std::vector<THeader>& headers);
@@ -127,9 +139,10 @@ namespace Cesium
         static CesiumAsync::HttpHeaders ConvertToCesiumHeaders(const Aws::Http::HeaderValueCollection& headers);
 
         static std::shared_ptr<HttpAssetRequest> CreateO3DEAssetRequest(
-            const Aws::Http::HttpRequest& request, Aws::Http::HttpResponse* response);
+            const Aws::Http::HttpRequest& request, Aws::Http::HttpResponse* response, HttpMetrics& metrics);
 
-        static std::unique_ptr<HttpAssetResponse> CreateO3DEAssetResponse(Aws::Http::HttpResponse& response);
+        static std::unique_ptr<HttpAssetResponse> CreateO3DEAssetResponse(
+            const Aws::Http::HttpRequest& request, Aws::Http::HttpResponse& response, HttpMetrics& metrics);
 
         static IOContent DecodeGzip(IOContent& content);
 
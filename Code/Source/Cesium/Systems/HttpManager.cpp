@@ -1,4 +1,7 @@
 #include "Cesium/Systems/HttpManager.h"
+#include "Cesium/Systems/TraceRecorder.h"
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/ThreadAffinityPolicy.h"
 #include <AzFramework/AzFramework_Traits_Platform.h>
 #include <AWSNativeSDKInit/AWSNativeSDKInit.h>
 #include <AzCore/PlatformDef.h>
@@ -22,24 +25,97 @@ AZ_PUSH_DISABLE_WARNING(4251 4996, "-Wunknown-warning-option")
 #include <aws/core/http/HttpResponse.h>
 AZ_POP_DISABLE_WARNING
 
+#include <chrono>
 #include <stdexcept>
 
 namespace Cesium
 {
+    namespace
+    {
+        std::int64_t GetEnqueueTime()
+        {
+            TraceRecorder* recorder = GetActiveTraceRecorder();
+            return recorder ? recorder->GetTimestamp() : 0;
+        }
+
+        void RecordQueueWait(AZStd::string_view url, std::int64_t enqueueTime)
+        {
+            TraceRecorder* recorder = GetActiveTraceRecorder();
+            if (recorder)
+            {
+                recorder->RecordComplete("Http", "HttpQueueWait", url, enqueueTime, recorder->GetTimestamp());
+            }
+        }
+
+        std::uint64_t ToMicroseconds(std::chrono::steady_clock::duration duration)
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+        }
+
+        std::shared_ptr<Aws::Http::HttpResponse> MakeMeasuredRequest(
+            Aws::Http::HttpClient& httpClient,
+            const std::shared_ptr<Aws::Http::HttpRequest>& request,
+            HttpMetrics& metrics,
+            std::chrono::steady_clock::time_point enqueueTime)
+        {
+            AZStd::string host = request->GetUri().GetAuthority().c_str();
+            auto startTime = std::chrono::steady_clock::now();
+            metrics.RecordStart(host, ToMicroseconds(startTime - enqueueTime));
+
+            // the handler is called for every chunk of the body that arrives, so the first call marks the first byte
+            bool firstByteReceived = false;
+            std::chrono::steady_clock::time_point firstByteTime;
+            std::uint64_t bytesReceived = 0;
+            request->SetDataReceivedEventHandler(
+                [&firstByteReceived, &firstByteTime, &bytesReceived](
+                    const Aws::Http::HttpRequest*, Aws::Http::HttpResponse*, long long bytes)
+                {
+                    if (!firstByteReceived)
+                    {
+                        firstByteReceived = true;
+                        firstByteTime = std::chrono::steady_clock::now();
+                    }
+
+                    bytesReceived += static_cast<std::uint64_t>(bytes);
+                });
+
+            auto response = httpClient.MakeRequest(request);
+            auto endTime = std::chrono::steady_clock::now();
+            request->SetDataReceivedEventHandler(Aws::Http::DataReceivedEventHandler{});
+            if (!firstByteReceived)
+            {
+                firstByteTime = endTime;
+            }
+
+            int statusCode = response ? static_cast<int>(response->GetResponseCode()) : 0;
+            metrics.RecordFinish(
+                host, statusCode, ToMicroseconds(firstByteTime - startTime), ToMicroseconds(endTime - startTime), bytesReceived);
+            return response;
+        }
+    } // namespace
+
     struct HttpManager::RequestHandler
     {
         RequestHandler(
             const std::shared_ptr<Aws::Http::HttpClient>& awsHttpClient,
+            HttpMetrics& metrics,
             HttpRequestParameter&& httpRequestParameter,
             const CesiumAsync::Promise<HttpResult>& promise)
             : m_awsHttpClient{ awsHttpClient }
+            , m_metrics{ &metrics }
             , m_httpRequestParameter{ std::move(httpRequestParameter) }
             , m_promise{ promise }
+            , m_enqueueTime{ GetEnqueueTime() }
+            , m_enqueueTimePoint{ std::chrono::steady_clock::now() }
         {
+            m_metrics->RecordEnqueue();
         }
 
         void operator()()
         {
+            RecordQueueWait(m_httpRequestParameter.m_url, m_enqueueTime);
+            ScopedTraceEvent traceEvent("Http", "HttpRequest", m_httpRequestParameter.m_url);
+
             Aws::Http::URI awsURI(m_httpRequestParameter.m_url.c_str());
             auto awsHttpRequest = Aws::Http::CreateHttpRequest(
                 awsURI, m_httpRequestParameter.m_method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
@@ -57,46 +133,61 @@ namespace Cesium
                 awsHttpRequest->SetContentLength(std::to_string(m_httpRequestParameter.m_body.length()).c_str());
             }
 
-            auto awsHttpResponse = m_awsHttpClient->MakeRequest(awsHttpRequest);
+            auto awsHttpResponse = MakeMeasuredRequest(*m_awsHttpClient, awsHttpRequest, *m_metrics, m_enqueueTimePoint);
             m_promise.resolve({ awsHttpRequest, awsHttpResponse });
         }
 
         std::shared_ptr<Aws::Http::HttpClient> m_awsHttpClient;
+        HttpMetrics* m_metrics;
         HttpRequestParameter m_httpRequestParameter;
         CesiumAsync::Promise<HttpResult> m_promise;
+        std::int64_t m_enqueueTime;
+        std::chrono::steady_clock::time_point m_enqueueTimePoint;
     };
 
     struct HttpManager::GenericIORequestHandler
     {
         GenericIORequestHandler(
             const std::shared_ptr<Aws::Http::HttpClient>& awsHttpClient,
+            HttpMetrics& metrics,
             const IORequestParameter& request,
             const CesiumAsync::Promise<IOContent>& promise)
             : m_awsHttpClient{ awsHttpClient }
+            , m_metrics{ &metrics }
             , m_request{ request }
             , m_promise{ promise }
+            , m_enqueueTime{ GetEnqueueTime() }
+            , m_enqueueTimePoint{ std::chrono::steady_clock::now() }
         {
+            m_metrics->RecordEnqueue();
         }
 
         GenericIORequestHandler(
             const std::shared_ptr<Aws::Http::HttpClient>& awsHttpClient,
+            HttpMetrics& metrics,
             IORequestParameter&& request,
             const CesiumAsync::Promise<IOContent>& promise)
             : m_awsHttpClient{ awsHttpClient }
+            , m_metrics{ &metrics }
             , m_request{ std::move(request) }
             , m_promise{ promise }
+            , m_enqueueTime{ GetEnqueueTime() }
+            , m_enqueueTimePoint{ std::chrono::steady_clock::now() }
         {
+            m_metrics->RecordEnqueue();
         }
 
         void operator()()
         {
             std::string absoluteUrl = CesiumUtility::Uri::resolve(m_request.m_parentPath.c_str(), m_request.m_path.c_str());
+            RecordQueueWait(absoluteUrl.c_str(), m_enqueueTime);
+            ScopedTraceEvent traceEvent("Http", "HttpRequest", absoluteUrl.c_str());
 
             Aws::Http::URI awsURI(absoluteUrl.c_str());
             auto awsHttpRequest = Aws::Http::CreateHttpRequest(
                 awsURI, Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
 
-            auto awsHttpResponse = m_awsHttpClient->MakeRequest(awsHttpRequest);
+            auto awsHttpResponse = MakeMeasuredRequest(*m_awsHttpClient, awsHttpRequest, *m_metrics, m_enqueueTimePoint);
             if (awsHttpResponse)
             {
                 m_promise.resolve(HttpManager::GetResponseBodyContent(*awsHttpResponse));
@@ -108,19 +199,38 @@ namespace Cesium
         }
 
         std::shared_ptr<Aws::Http::HttpClient> m_awsHttpClient;
+        HttpMetrics* m_metrics;
         IORequestParameter m_request;
         CesiumAsync::Promise<IOContent> m_promise;
+        std::int64_t m_enqueueTime;
+        std::chrono::steady_clock::time_point m_enqueueTimePoint;
     };
 
     HttpManager::HttpManager()
+        : HttpManager(nullptr, ThreadAffinityPolicy{})
+    {
+    }
+
+    HttpManager::HttpManager(DeterministicTaskQueue* deterministicQueue)
+        : HttpManager(deterministicQueue, ThreadAffinityPolicy{})
     {
-        AZ::JobManagerDesc jobDesc;
-        for (size_t i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+    }
+
+    HttpManager::HttpManager(const ThreadAffinityPolicy& affinityPolicy)
+        : HttpManager(nullptr, affinityPolicy)
+    {
+    }
+
+    HttpManager::HttpManager(DeterministicTaskQueue* deterministicQueue, const ThreadAffinityPolicy& affinityPolicy)
+        : m_deterministicQueue{ deterministicQueue }
+    {
+        if (!m_deterministicQueue)
         {
-            jobDesc.m_workerThreads.push_back({ static_cast<int>(i) });
+            AZ::JobManagerDesc jobDesc;
+            jobDesc.m_workerThreads = affinityPolicy.CreateHttpThreadDescs();
+            m_ioJobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_ioJobContext = AZStd::make_unique<AZ::JobContext>(*m_ioJobManager);
         }
-        m_ioJobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
-        m_ioJobContext = AZStd::make_unique<AZ::JobContext>(*m_ioJobManager);
 
         AZ::Utils::SetEnv("AWS_EC2_METADATA_DISABLED", "True", true);
         AWSNativeSDKInit::InitializationManager::InitAwsApi();
@@ -142,9 +252,7 @@ namespace Cesium
         const CesiumAsync::AsyncSystem& asyncSystem, HttpRequestParameter&& httpRequestParameter)
     {
         auto promise = asyncSystem.createPromise<HttpResult>();
-        AZ::Job* job = aznew AZ::JobFunction<std::function<void()>>(
-            RequestHandler{ m_awsHttpClient, std::move(httpRequestParameter), promise }, true, m_ioJobContext.get());
-        job->Start();
+        StartRequest(RequestHandler{ m_awsHttpClient, m_metrics, std::move(httpRequestParameter), promise });
 
         return promise.getFuture();
     }
@@ -172,7 +280,8 @@ namespace Cesium
         auto awsHttpRequest =
             Aws::Http::CreateHttpRequest(awsURI, Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
 
-        auto awsHttpResponse = awsHttpClient->MakeRequest(awsHttpRequest);
+        m_metrics.RecordEnqueue();
+        auto awsHttpResponse = MakeMeasuredRequest(*awsHttpClient, awsHttpRequest, m_metrics, std::chrono::steady_clock::now());
         if (!awsHttpRequest || !awsHttpResponse)
         {
             return {};
@@ -190,9 +299,7 @@ namespace Cesium
         const CesiumAsync::AsyncSystem& asyncSystem, const IORequestParameter& request)
     {
         auto promise = asyncSystem.createPromise<IOContent>();
-        AZ::Job* job = aznew AZ::JobFunction<std::function<void()>>(
-            GenericIORequestHandler{ m_awsHttpClient, request, promise }, true, m_ioJobContext.get());
-        job->Start();
+        StartRequest(GenericIORequestHandler{ m_awsHttpClient, m_metrics, request, promise });
 
         return promise.getFuture();
     }
@@ -201,13 +308,33 @@ namespace Cesium
         const CesiumAsync::AsyncSystem& asyncSystem, IORequestParameter&& request)
     {
         auto promise = asyncSystem.createPromise<IOContent>();
-        AZ::Job* job = aznew AZ::JobFunction<std::function<void()>>(
-            GenericIORequestHandler{ m_awsHttpClient, std::move(request), promise }, true, m_ioJobContext.get());
-        job->Start();
+        StartRequest(GenericIORequestHandler{ m_awsHttpClient, m_metrics, std::move(request), promise });
 
         return promise.getFuture();
     }
 
+    void HttpManager::StartRequest(std::function<void()> requestHandler)
+    {
+        if (m_deterministicQueue)
+        {
+            m_deterministicQueue->Push(std::move(requestHandler));
+            return;
+        }
+
+        AZ::Job* job = aznew AZ::JobFunction<std::function<void()>>(std::move(requestHandler), true, m_ioJobContext.get());
+        job->Start();
+    }
+
+    HttpMetrics& HttpManager::GetMetrics()
+    {
+        return m_metrics;
+    }
+
+    const HttpMetrics& HttpManager::GetMetrics() const
+    {
+        return m_metrics;
+    }
+
     IOContent HttpManager::GetResponseBodyContent(Aws::Http::HttpResponse& response)
     {
         auto& ioStream = response.GetResponseBody();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Cesium/Systems/GenericIOManager.h"
+#include "Cesium/Systems/HttpMetrics.h"
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <CesiumAsync/AsyncSystem.h>
@@ -25,6 +26,9 @@ namespace Aws
 
 namespace Cesium
 {
+    class DeterministicTaskQueue;
+    struct ThreadAffinityPolicy;
+
     struct HttpRequestParameter final
     {
         HttpRequestParameter(AZStd::string&& url, Aws::Http::HttpMethod method)
@@ -71,6 +75,11 @@ namespace Cesium
     public:
         HttpManager();
 
+        // run all requests on the deterministic queue instead of the IO job manager
+        explicit HttpManager(DeterministicTaskQueue* deterministicQueue);
+
+        explicit HttpManager(const ThreadAffinityPolicy& affinityPolicy);
+
         ~HttpManager() noexcept;
 
         CesiumAsync::Future<HttpResult> AddRequest(
@@ -88,11 +97,21 @@ namespace Cesium
         CesiumAsync::Future<IOContent> GetFileContentAsync(
             const CesiumAsync::AsyncSystem& asyncSystem, IORequestParameter&& request) override;
 
+        HttpMetrics& GetMetrics();
+
+        const HttpMetrics& GetMetrics() const;
+
         static IOContent GetResponseBodyContent(Aws::Http::HttpResponse& response);
 
     private:
+        HttpManager(DeterministicTaskQueue* deterministicQueue, const ThreadAffinityPolicy& affinityPolicy);
+
+        void StartRequest(std::function<void()> requestHandler);
+
+        HttpMetrics m_metrics;
         AZStd::unique_ptr<AZ::JobManager> m_ioJobManager;
         AZStd::unique_ptr<AZ::JobContext> m_ioJobContext;
+        DeterministicTaskQueue* m_deterministicQueue;
         std::shared_ptr<Aws::Http::HttpClient> m_awsHttpClient;
     };
 } // namespace Cesium
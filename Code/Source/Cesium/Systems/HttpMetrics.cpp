@@ -0,0 +1,145 @@
+#include "Cesium/Systems/HttpMetrics.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace Cesium
+{
+    HttpMetrics::HttpMetrics()
+        : m_queuedRequests{ 0 }
+        , m_activeRequests{ 0 }
+        , m_peakQueuedRequests{ 0 }
+        , m_peakActiveRequests{ 0 }
+    {
+    }
+
+    void HttpMetrics::RecordEnqueue()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        ++m_queuedRequests;
+        m_peakQueuedRequests = AZStd::max(m_peakQueuedRequests, m_queuedRequests);
+    }
+
+    void HttpMetrics::RecordStart(AZStd::string_view host, std::uint64_t queueWaitMicroseconds)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_queuedRequests > 0)
+        {
+            --m_queuedRequests;
+        }
+
+        ++m_activeRequests;
+        m_peakActiveRequests = AZStd::max(m_peakActiveRequests, m_activeRequests);
+
+        HttpHostMetrics& hostMetrics = GetHostMetrics(host);
+        hostMetrics.m_queueWait.Add(queueWaitMicroseconds);
+        ++hostMetrics.m_activeRequests;
+        hostMetrics.m_peakActiveRequests = AZStd::max(hostMetrics.m_peakActiveRequests, hostMetrics.m_activeRequests);
+    }
+
+    void HttpMetrics::RecordFinish(
+        AZStd::string_view host,
+        int statusCode,
+        std::uint64_t timeToFirstByteMicroseconds,
+        std::uint64_t latencyMicroseconds,
+        std::uint64_t bytes)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_activeRequests > 0)
+        {
+            --m_activeRequests;
+        }
+
+        HttpHostMetrics& hostMetrics = GetHostMetrics(host);
+        if (hostMetrics.m_activeRequests > 0)
+        {
+            --hostMetrics.m_activeRequests;
+        }
+
+        ++hostMetrics.m_requestCount;
+        if (statusCode < 100)
+        {
+            ++hostMetrics.m_failedRequests;
+            return;
+        }
+
+        if (statusCode < 200)
+        {
+            ++hostMetrics.m_informationalResponses;
+        }
+        else if (statusCode < 300)
+        {
+            ++hostMetrics.m_successfulResponses;
+        }
+        else if (statusCode < 400)
+        {
+            ++hostMetrics.m_redirectResponses;
+        }
+        else if (statusCode < 500)
+        {
+            ++hostMetrics.m_clientErrorResponses;
+        }
+        else
+        {
+            ++hostMetrics.m_serverErrorResponses;
+        }
+
+        hostMetrics.m_timeToFirstByte.Add(timeToFirstByteMicroseconds);
+        hostMetrics.m_latency.Add(latencyMicroseconds);
+        hostMetrics.m_bytes.Add(bytes);
+    }
+
+    void HttpMetrics::RecordDecompression(AZStd::string_view host, std::uint64_t compressedBytes, std::uint64_t decompressedBytes)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        HttpHostMetrics& hostMetrics = GetHostMetrics(host);
+        hostMetrics.m_compressedBytes += compressedBytes;
+        hostMetrics.m_decompressedBytes += decompressedBytes;
+    }
+
+    HttpMetricsSnapshot HttpMetrics::GetSnapshot() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        HttpMetricsSnapshot snapshot;
+        snapshot.m_hosts.reserve(m_hosts.size());
+        for (const auto& host : m_hosts)
+        {
+            snapshot.m_hosts.emplace_back(host.second);
+        }
+
+        snapshot.m_queuedRequests = m_queuedRequests;
+        snapshot.m_activeRequests = m_activeRequests;
+        snapshot.m_peakQueuedRequests = m_peakQueuedRequests;
+        snapshot.m_peakActiveRequests = m_peakActiveRequests;
+        return snapshot;
+    }
+
+    void HttpMetrics::Reset()
+    {
+        // keep the requests in flight, so their completion does not make the counts wrap around
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        for (auto& host : m_hosts)
+        {
+            HttpHostMetrics resetMetrics;
+            resetMetrics.m_host = host.first;
+            resetMetrics.m_activeRequests = host.second.m_activeRequests;
+            resetMetrics.m_peakActiveRequests = host.second.m_activeRequests;
+            host.second = AZStd::move(resetMetrics);
+        }
+
+        m_peakQueuedRequests = m_queuedRequests;
+        m_peakActiveRequests = m_activeRequests;
+    }
+
+    HttpHostMetrics& HttpMetrics::GetHostMetrics(AZStd::string_view host)
+    {
+        AZStd::string hostName(host);
+        auto it = m_hosts.find(hostName);
+        if (it == m_hosts.end())
+        {
+            it = m_hosts.emplace(hostName, HttpHostMetrics{}).first;
+            it->second.m_host = AZStd::move(hostName);
+        }
+
+        return it->second;
+    }
+} // namespace Cesium
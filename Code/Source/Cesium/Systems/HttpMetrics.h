@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Cesium/EBus/HttpMetricsBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Aggregates the behavior of the HTTP requests per host. Every request takes the lock a few times, which is negligible next to
+    // the request itself.
+    class HttpMetrics final
+    {
+    public:
+        HttpMetrics();
+
+        void RecordEnqueue();
+
+        void RecordStart(AZStd::string_view host, std::uint64_t queueWaitMicroseconds);
+
+        // status code is 0 when no response is received
+        void RecordFinish(
+            AZStd::string_view host,
+            int statusCode,
+            std::uint64_t timeToFirstByteMicroseconds,
+            std::uint64_t latencyMicroseconds,
+            std::uint64_t bytes);
+
+        void RecordDecompression(AZStd::string_view host, std::uint64_t compressedBytes, std::uint64_t decompressedBytes);
+
+        HttpMetricsSnapshot GetSnapshot() const;
+
+        void Reset();
+
+    private:
+        HttpHostMetrics& GetHostMetrics(AZStd::string_view host);
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZStd::string, HttpHostMetrics> m_hosts;
+        std::uint32_t m_queuedRequests;
+        std::uint32_t m_activeRequests;
+        std::uint32_t m_peakQueuedRequests;
+        std::uint32_t m_peakActiveRequests;
+    };
+} // namespace Cesium
@@ -0,0 +1,267 @@
+#include "Cesium/Systems/LoadSlotArbiter.h"
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+#include <limits>
+
+namespace Cesium
+{
+    LoadSlotArbiter::LoadSlotArbiter(std::uint32_t globalLoadSlots, std::uint32_t minimumLoadSlots)
+        : m_globalLoadSlots{ globalLoadSlots }
+        , m_minimumLoadSlots{ minimumLoadSlots }
+        , m_nextConsumerId{ 1 }
+    {
+        m_status.m_globalLoadSlots = m_globalLoadSlots;
+        m_status.m_minimumLoadSlots = m_minimumLoadSlots;
+    }
+
+    void LoadSlotArbiter::SetGlobalLoadSlots(std::uint32_t globalLoadSlots)
+    {
+        m_globalLoadSlots = globalLoadSlots;
+        m_status.m_globalLoadSlots = m_globalLoadSlots;
+    }
+
+    std::uint32_t LoadSlotArbiter::GetGlobalLoadSlots() const
+    {
+        return m_globalLoadSlots;
+    }
+
+    void LoadSlotArbiter::SetMinimumLoadSlots(std::uint32_t minimumLoadSlots)
+    {
+        m_minimumLoadSlots = minimumLoadSlots;
+        m_status.m_minimumLoadSlots = m_minimumLoadSlots;
+    }
+
+    std::uint32_t LoadSlotArbiter::GetMinimumLoadSlots() const
+    {
+        return m_minimumLoadSlots;
+    }
+
+    LoadSlotArbiter::ConsumerId LoadSlotArbiter::AddConsumer()
+    {
+        // a new consumer keeps its own loads until the next rebalance
+        Consumer consumer;
+        consumer.m_id = m_nextConsumerId++;
+        consumer.m_maximumLoads = 0;
+        consumer.m_requestedLoads = 0;
+        consumer.m_allocatedLoads = std::numeric_limits<std::uint32_t>::max();
+        consumer.m_screenContribution = 0.0;
+        m_consumers.emplace_back(consumer);
+        return consumer.m_id;
+    }
+
+    void LoadSlotArbiter::RemoveConsumer(ConsumerId id)
+    {
+        auto it = AZStd::find_if(
+            m_consumers.begin(), m_consumers.end(),
+            [id](const Consumer& consumer)
+            {
+                return consumer.m_id == id;
+            });
+        if (it != m_consumers.end())
+        {
+            m_consumers.erase(it);
+        }
+    }
+
+    void LoadSlotArbiter::ReportDemand(ConsumerId id, std::uint32_t maximumLoads, std::uint32_t pendingLoads, double screenContribution)
+    {
+        Consumer* consumer = FindConsumer(id);
+        if (!consumer)
+        {
+            return;
+        }
+
+        consumer->m_maximumLoads = maximumLoads;
+        consumer->m_requestedLoads = AZStd::min(pendingLoads, maximumLoads);
+        consumer->m_allocatedLoads = AZStd::min(consumer->m_allocatedLoads, maximumLoads);
+        consumer->m_screenContribution = AZStd::clamp(screenContribution, 0.0, 1.0);
+    }
+
+    std::uint32_t LoadSlotArbiter::GetAllocation(ConsumerId id) const
+    {
+        const Consumer* consumer = FindConsumer(id);
+        return consumer ? consumer->m_allocatedLoads : 0;
+    }
+
+    void LoadSlotArbiter::Rebalance()
+    {
+        if (m_globalLoadSlots == 0)
+        {
+            for (Consumer& consumer : m_consumers)
+            {
+                consumer.m_allocatedLoads = consumer.m_maximumLoads;
+            }
+
+            UpdateStatus();
+            return;
+        }
+
+        std::uint32_t consumerCount = 0;
+        for (const Consumer& consumer : m_consumers)
+        {
+            consumerCount += consumer.m_maximumLoads > 0 ? 1 : 0;
+        }
+
+        // the fair share is kept even without pending loads, so a tileset can start loading as soon as it needs to. At least one
+        // load is kept when there are more tilesets than slots
+        std::uint32_t fairShare = consumerCount > 0 ? AZStd::max(m_globalLoadSlots / consumerCount, 1u) : 0;
+        std::uint32_t guaranteedLoads = AZStd::min(m_minimumLoadSlots, fairShare);
+        std::uint32_t remainingSlots = m_globalLoadSlots;
+        for (Consumer& consumer : m_consumers)
+        {
+            consumer.m_allocatedLoads = AZStd::min(consumer.m_maximumLoads, guaranteedLoads);
+            remainingSlots -= AZStd::min(remainingSlots, consumer.m_allocatedLoads);
+        }
+
+        m_weights.assign(m_consumers.size(), 0.0);
+        m_remainders.assign(m_consumers.size(), 0.0);
+        m_activeConsumers.clear();
+        for (std::size_t i = 0; i < m_consumers.size(); ++i)
+        {
+            if (m_consumers[i].m_screenContribution > 0.0 && m_consumers[i].m_requestedLoads > m_consumers[i].m_allocatedLoads)
+            {
+                m_weights[i] = m_consumers[i].m_screenContribution;
+                m_activeConsumers.emplace_back(i);
+            }
+        }
+
+        remainingSlots = Distribute(m_activeConsumers, m_weights, remainingSlots);
+
+        // the slots left load the tiles of the consumers that are not on screen, like the prefetched views, by how many they wait for
+        m_activeConsumers.clear();
+        for (std::size_t i = 0; i < m_consumers.size(); ++i)
+        {
+            if (m_consumers[i].m_screenContribution <= 0.0 && m_consumers[i].m_requestedLoads > m_consumers[i].m_allocatedLoads)
+            {
+                m_weights[i] = static_cast<double>(m_consumers[i].m_requestedLoads - m_consumers[i].m_allocatedLoads);
+                m_activeConsumers.emplace_back(i);
+            }
+        }
+
+        Distribute(m_activeConsumers, m_weights, remainingSlots);
+        UpdateStatus();
+    }
+
+    const LoadSlotStatus& LoadSlotArbiter::GetStatus() const
+    {
+        return m_status;
+    }
+
+    LoadSlotArbiter::Consumer* LoadSlotArbiter::FindConsumer(ConsumerId id)
+    {
+        for (Consumer& consumer : m_consumers)
+        {
+            if (consumer.m_id == id)
+            {
+                return &consumer;
+            }
+        }
+
+        return nullptr;
+    }
+
+    const LoadSlotArbiter::Consumer* LoadSlotArbiter::FindConsumer(ConsumerId id) const
+    {
+        for (const Consumer& consumer : m_consumers)
+        {
+            if (consumer.m_id == id)
+            {
+                return &consumer;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::uint32_t LoadSlotArbiter::Distribute(
+        AZStd::vector<std::size_t>& consumers, const AZStd::vector<double>& weights, std::uint32_t slots)
+    {
+        while (!consumers.empty() && slots > 0)
+        {
+            double totalWeight = 0.0;
+            for (std::size_t index : consumers)
+            {
+                totalWeight += weights[index];
+            }
+
+            if (totalWeight <= 0.0)
+            {
+                break;
+            }
+
+            m_satisfiedConsumers.clear();
+            for (std::size_t index : consumers)
+            {
+                double share = static_cast<double>(slots) * weights[index] / totalWeight;
+                std::uint32_t neededLoads = m_consumers[index].m_requestedLoads - m_consumers[index].m_allocatedLoads;
+                if (share >= static_cast<double>(neededLoads))
+                {
+                    m_satisfiedConsumers.emplace_back(index);
+                }
+            }
+
+            if (m_satisfiedConsumers.empty())
+            {
+                // every share is below what its consumer needs, so rounding up a share never gives more than needed
+                std::uint32_t distributedSlots = 0;
+                for (std::size_t index : consumers)
+                {
+                    double share = static_cast<double>(slots) * weights[index] / totalWeight;
+                    double wholeShare = std::floor(share);
+                    m_consumers[index].m_allocatedLoads += static_cast<std::uint32_t>(wholeShare);
+                    distributedSlots += static_cast<std::uint32_t>(wholeShare);
+                    m_remainders[index] = share - wholeShare;
+                }
+
+                AZStd::stable_sort(
+                    consumers.begin(), consumers.end(),
+                    [this](std::size_t lhs, std::size_t rhs)
+                    {
+                        return m_remainders[lhs] > m_remainders[rhs];
+                    });
+                for (std::size_t i = 0; i < consumers.size() && distributedSlots < slots; ++i)
+                {
+                    ++m_consumers[consumers[i]].m_allocatedLoads;
+                    ++distributedSlots;
+                }
+
+                consumers.clear();
+                return slots - distributedSlots;
+            }
+
+            // the shares of the others are computed again with what is left
+            for (std::size_t index : m_satisfiedConsumers)
+            {
+                slots -= m_consumers[index].m_requestedLoads - m_consumers[index].m_allocatedLoads;
+                m_consumers[index].m_allocatedLoads = m_consumers[index].m_requestedLoads;
+            }
+
+            consumers.erase(
+                AZStd::remove_if(
+                    consumers.begin(), consumers.end(),
+                    [this](std::size_t index)
+                    {
+                        return AZStd::find(m_satisfiedConsumers.begin(), m_satisfiedConsumers.end(), index) != m_satisfiedConsumers.end();
+                    }),
+                consumers.end());
+        }
+
+        return slots;
+    }
+
+    void LoadSlotArbiter::UpdateStatus()
+    {
+        m_status.m_globalLoadSlots = m_globalLoadSlots;
+        m_status.m_minimumLoadSlots = m_minimumLoadSlots;
+        m_status.m_requestedLoadSlots = 0;
+        m_status.m_allocatedLoadSlots = 0;
+        m_status.m_consumerCount = static_cast<std::uint32_t>(m_consumers.size());
+        m_status.m_throttledConsumerCount = 0;
+        for (const Consumer& consumer : m_consumers)
+        {
+            m_status.m_requestedLoadSlots += consumer.m_requestedLoads;
+            m_status.m_allocatedLoadSlots += consumer.m_allocatedLoads;
+            m_status.m_throttledConsumerCount += consumer.m_allocatedLoads < consumer.m_requestedLoads ? 1 : 0;
+        }
+    }
+} // namespace Cesium
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Cesium/EBus/LoadSlotBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Divides the simultaneous tile loads between all the tilesets. Every frame each tileset reports the loads it would use on its
+    // own, the tiles waiting to be loaded and how much of the viewports it covers. Each tileset first gets the minimum load slots,
+    // so no tileset starves. The rest goes to the tilesets waiting for more tiles, in proportion to their coverage, so the terrain
+    // under the camera loads before the tilesets in the background. What the tilesets on screen don't need is given to the others.
+    class LoadSlotArbiter final
+    {
+    public:
+        using ConsumerId = std::uint32_t;
+
+        explicit LoadSlotArbiter(
+            std::uint32_t globalLoadSlots = DEFAULT_GLOBAL_LOAD_SLOTS, std::uint32_t minimumLoadSlots = DEFAULT_MINIMUM_LOAD_SLOTS);
+
+        // zero disables the arbitration, and every consumer keeps its own loads
+        void SetGlobalLoadSlots(std::uint32_t globalLoadSlots);
+
+        std::uint32_t GetGlobalLoadSlots() const;
+
+        void SetMinimumLoadSlots(std::uint32_t minimumLoadSlots);
+
+        std::uint32_t GetMinimumLoadSlots() const;
+
+        ConsumerId AddConsumer();
+
+        void RemoveConsumer(ConsumerId id);
+
+        // maximumLoads is what the consumer would use on its own. screenContribution is the fraction of the viewports covered by
+        // the consumer in [0, 1]
+        void ReportDemand(ConsumerId id, std::uint32_t maximumLoads, std::uint32_t pendingLoads, double screenContribution);
+
+        // the simultaneous loads the consumer may use. It never exceeds the maximum loads reported by the consumer
+        std::uint32_t GetAllocation(ConsumerId id) const;
+
+        // share the load slots using the last reported demand. Called once per frame
+        void Rebalance();
+
+        const LoadSlotStatus& GetStatus() const;
+
+        static constexpr std::uint32_t DEFAULT_GLOBAL_LOAD_SLOTS = 64;
+
+        static constexpr std::uint32_t DEFAULT_MINIMUM_LOAD_SLOTS = 2;
+
+    private:
+        struct Consumer
+        {
+            ConsumerId m_id;
+            std::uint32_t m_maximumLoads;
+            std::uint32_t m_requestedLoads;
+            std::uint32_t m_allocatedLoads;
+            double m_screenContribution;
+        };
+
+        Consumer* FindConsumer(ConsumerId id);
+
+        const Consumer* FindConsumer(ConsumerId id) const;
+
+        // water filling: the slots are shared in proportion to the weights, and the consumers getting all they asked for give the
+        // rest of their share to the others. The slots lost to rounding go to the largest remainders
+        std::uint32_t Distribute(AZStd::vector<std::size_t>& consumers, const AZStd::vector<double>& weights, std::uint32_t slots);
+
+        void UpdateStatus();
+
+        AZStd::vector<Consumer> m_consumers;
+        AZStd::vector<std::size_t> m_activeConsumers;
+        AZStd::vector<std::size_t> m_satisfiedConsumers;
+        AZStd::vector<double> m_weights;
+        AZStd::vector<double> m_remainders;
+        LoadSlotStatus m_status;
+        std::uint32_t m_globalLoadSlots;
+        std::uint32_t m_minimumLoadSlots;
+        ConsumerId m_nextConsumerId;
+    };
+} // namespace Cesium
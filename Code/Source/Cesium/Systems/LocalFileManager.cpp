@@ -1,4 +1,7 @@
 #include "Cesium/Systems/LocalFileManager.h"
+#include "Cesium/Systems/TraceRecorder.h"
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/ThreadAffinityPolicy.h"
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Jobs/JobManager.h>
@@ -8,17 +11,28 @@
 
 namespace Cesium
 {
+    namespace
+    {
+        std::int64_t GetEnqueueTime()
+        {
+            TraceRecorder* recorder = GetActiveTraceRecorder();
+            return recorder ? recorder->GetTimestamp() : 0;
+        }
+    } // namespace
+
     struct LocalFileManager::RequestHandler
     {
         RequestHandler(const IORequestParameter& request, const CesiumAsync::Promise<IOContent>& promise)
             : m_request{ request }
             , m_promise{ promise }
+            , m_enqueueTime{ GetEnqueueTime() }
         {
         }
 
         RequestHandler(IORequestParameter&& request, const CesiumAsync::Promise<IOContent>& promise)
             : m_request{ std::move(request) }
             , m_promise{ promise }
+            , m_enqueueTime{ GetEnqueueTime() }
         {
         }
 
@@ -38,6 +52,12 @@ namespace Cesium
                 AZ::StringFunc::Path::Join(m_request.m_parentPath.c_str(), m_request.m_path.c_str(), absolutePath);
             }
 
+            if (TraceRecorder* recorder = GetActiveTraceRecorder())
+            {
+                recorder->RecordComplete("File", "FileQueueWait", absolutePath, m_enqueueTime, recorder->GetTimestamp());
+            }
+
+            ScopedTraceEvent traceEvent("File", "FileRead", absolutePath);
             AZ::IO::FileIOStream stream(absolutePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
             if (!stream.IsOpen())
             {
@@ -55,17 +75,54 @@ namespace Cesium
 
         IORequestParameter m_request;
         CesiumAsync::Promise<IOContent> m_promise;
+        std::int64_t m_enqueueTime;
+    };
+
+    struct LocalFileManager::BatchRequestHandler
+    {
+        void operator()()
+        {
+            std::vector<IOContent> contents;
+            contents.reserve(m_requests.size());
+            for (const IORequestParameter& request : m_requests)
+            {
+                ScopedTraceEvent traceEvent("File", "FileRead", request.m_path);
+                contents.emplace_back(m_fileManager->GetFileContent(request));
+            }
+
+            m_promise.resolve(std::move(contents));
+        }
+
+        LocalFileManager* m_fileManager;
+        std::vector<IORequestParameter> m_requests;
+        CesiumAsync::Promise<std::vector<IOContent>> m_promise;
     };
 
     LocalFileManager::LocalFileManager()
+        : LocalFileManager(nullptr, ThreadAffinityPolicy{})
+    {
+    }
+
+    LocalFileManager::LocalFileManager(DeterministicTaskQueue* deterministicQueue)
+        : LocalFileManager(deterministicQueue, ThreadAffinityPolicy{})
+    {
+    }
+
+    LocalFileManager::LocalFileManager(const ThreadAffinityPolicy& affinityPolicy)
+        : LocalFileManager(nullptr, affinityPolicy)
+    {
+    }
+
+    LocalFileManager::LocalFileManager(DeterministicTaskQueue* deterministicQueue, const ThreadAffinityPolicy& affinityPolicy)
+        : m_deterministicQueue{ deterministicQueue }
     {
-        AZ::JobManagerDesc jobDesc;
-        for (size_t i = 0; i < 2; ++i)
+        if (!m_deterministicQueue)
         {
-            jobDesc.m_workerThreads.push_back({ static_cast<int>(i) });
+            AZ::JobManagerDesc jobDesc;
+            jobDesc.m_workerThreads = affinityPolicy.CreateFileThreadDescs();
+            m_ioJobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_ioJobContext = AZStd::make_unique<AZ::JobContext>(*m_ioJobManager);
         }
-        m_ioJobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
-        m_ioJobContext = AZStd::make_unique<AZ::JobContext>(*m_ioJobManager);
     }
 
     AZStd::string LocalFileManager::GetParentPath(const AZStd::string& path)
@@ -113,8 +170,7 @@ namespace Cesium
         const CesiumAsync::AsyncSystem& asyncSystem, const IORequestParameter& request)
     {
         auto promise = asyncSystem.createPromise<IOContent>();
-        AZ::Job* job = aznew AZ::JobFunction<std::function<void()>>(RequestHandler{ request, promise }, true, m_ioJobContext.get());
-        job->Start();
+        StartRequest(RequestHandler{ request, promise });
         return promise.getFuture();
     }
 
@@ -122,9 +178,28 @@ namespace Cesium
         const CesiumAsync::AsyncSystem& asyncSystem, IORequestParameter&& request)
     {
         auto promise = asyncSystem.createPromise<IOContent>();
-        AZ::Job* job =
-            aznew AZ::JobFunction<std::function<void()>>(RequestHandler{ std::move(request), promise }, true, m_ioJobContext.get());
-        job->Start();
+        StartRequest(RequestHandler{ std::move(request), promise });
         return promise.getFuture();
     }
+
+    CesiumAsync::Future<std::vector<IOContent>> LocalFileManager::GetFilesContentAsync(
+        const CesiumAsync::AsyncSystem& asyncSystem, std::vector<IORequestParameter>&& requests)
+    {
+        auto promise = asyncSystem.createPromise<std::vector<IOContent>>();
+        auto future = promise.getFuture();
+        StartRequest(BatchRequestHandler{ this, std::move(requests), std::move(promise) });
+        return future;
+    }
+
+    void LocalFileManager::StartRequest(std::function<void()> requestHandler)
+    {
+        if (m_deterministicQueue)
+        {
+            m_deterministicQueue->Push(std::move(requestHandler));
+            return;
+        }
+
+        AZ::Job* job = aznew AZ::JobFunction<std::function<void()>>(std::move(requestHandler), true, m_ioJobContext.get());
+        job->Start();
+    }
 } // namespace Cesium
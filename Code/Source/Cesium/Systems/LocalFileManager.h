@@ -15,13 +15,22 @@ namespace AZ
 
 namespace Cesium
 {
+    class DeterministicTaskQueue;
+    struct ThreadAffinityPolicy;
+
     class LocalFileManager final : public GenericIOManager
     {
         struct RequestHandler;
+        struct BatchRequestHandler;
 
     public:
         LocalFileManager();
 
+        // run all requests on the deterministic queue instead of the IO job manager
+        explicit LocalFileManager(DeterministicTaskQueue* deterministicQueue);
+
+        explicit LocalFileManager(const ThreadAffinityPolicy& affinityPolicy);
+
         AZStd::string GetParentPath(const AZStd::string& path) override;
 
         IOContent GetFileContent(const IORequestParameter& request) override;
@@ -34,8 +43,17 @@ namespace Cesium
         CesiumAsync::Future<IOContent> GetFileContentAsync(
             const CesiumAsync::AsyncSystem& asyncSystem, IORequestParameter&& request) override;
 
+        // the files are read one after the other in a single job, so the batch costs one job and one promise
+        CesiumAsync::Future<std::vector<IOContent>> GetFilesContentAsync(
+            const CesiumAsync::AsyncSystem& asyncSystem, std::vector<IORequestParameter>&& requests) override;
+
     private:
+        LocalFileManager(DeterministicTaskQueue* deterministicQueue, const ThreadAffinityPolicy& affinityPolicy);
+
+        void StartRequest(std::function<void()> requestHandler);
+
         AZStd::unique_ptr<AZ::JobManager> m_ioJobManager;
         AZStd::unique_ptr<AZ::JobContext> m_ioJobContext;
+        DeterministicTaskQueue* m_deterministicQueue;
     };
 } // namespace Cesium
@@ -0,0 +1,97 @@
+#include "Cesium/Systems/LogMessageQueue.h"
+#include <AzCore/std/algorithm.h>
+#include <cstring>
+
+namespace Cesium
+{
+    LogMessageQueue::LogMessageQueue(std::size_t capacity)
+        : m_pushPosition{ 0 }
+        , m_popPosition{ 0 }
+    {
+        std::size_t roundedCapacity = 1;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity <<= 1;
+        }
+
+        m_slots = AZStd::make_unique<Slot[]>(roundedCapacity);
+        m_mask = roundedCapacity - 1;
+        for (std::size_t i = 0; i < roundedCapacity; ++i)
+        {
+            m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool LogMessageQueue::TryPush(
+        spdlog::level::level_enum level, spdlog::log_clock::time_point time, AZStd::string_view text, std::uint32_t suppressedCount)
+    {
+        // a slot is free for position p when its sequence is p. Producers claim the position with a CAS and publish the message by
+        // setting the sequence to p + 1
+        std::size_t position = m_pushPosition.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true)
+        {
+            slot = &m_slots[position & m_mask];
+            std::size_t sequence = slot->m_sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0)
+            {
+                if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        LogMessage& message = slot->m_message;
+        message.m_level = level;
+        message.m_time = time;
+        message.m_suppressedCount = suppressedCount;
+        message.m_length = static_cast<std::uint32_t>(AZStd::min(text.size(), LogMessage::MAX_LENGTH));
+        std::memcpy(message.m_text, text.data(), message.m_length);
+        slot->m_sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool LogMessageQueue::TryPop(LogMessage& message)
+    {
+        std::size_t position = m_popPosition.load(std::memory_order_relaxed);
+        Slot& slot = m_slots[position & m_mask];
+        std::size_t sequence = slot.m_sequence.load(std::memory_order_acquire);
+        if (sequence != position + 1)
+        {
+            return false;
+        }
+
+        message = slot.m_message;
+        m_popPosition.store(position + 1, std::memory_order_relaxed);
+
+        // give the slot back to the producers of the next lap
+        slot.m_sequence.store(position + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool LogMessageQueue::IsEmpty() const
+    {
+        std::size_t position = m_popPosition.load(std::memory_order_relaxed);
+        return m_slots[position & m_mask].m_sequence.load(std::memory_order_acquire) != position + 1;
+    }
+
+    std::size_t LogMessageQueue::GetCapacity() const
+    {
+        return m_mask + 1;
+    }
+
+    std::size_t LogMessageQueue::GetByteSize() const
+    {
+        return GetCapacity() * sizeof(Slot);
+    }
+} // namespace Cesium
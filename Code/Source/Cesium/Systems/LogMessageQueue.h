@@ -0,0 +1,63 @@
+#pragma once
+
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+#include <spdlog/common.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Cesium
+{
+    struct LogMessage final
+    {
+        static constexpr std::size_t MAX_LENGTH = 512;
+
+        spdlog::level::level_enum m_level;
+        spdlog::log_clock::time_point m_time;
+
+        // identical messages that are dropped by the rate limiter before this one
+        std::uint32_t m_suppressedCount;
+        std::uint32_t m_length;
+        char m_text[MAX_LENGTH];
+    };
+
+    // Bounded lock-free queue of log messages. Any thread can push and a single thread pops. Every slot has a sequence number,
+    // so producers only contend on one atomic increment and never wait for each other. Messages longer than the slot are truncated,
+    // and pushing to a full queue fails instead of blocking the producer.
+    class LogMessageQueue final
+    {
+    public:
+        explicit LogMessageQueue(std::size_t capacity = DEFAULT_CAPACITY);
+
+        LogMessageQueue(const LogMessageQueue&) = delete;
+
+        LogMessageQueue& operator=(const LogMessageQueue&) = delete;
+
+        bool TryPush(
+            spdlog::level::level_enum level, spdlog::log_clock::time_point time, AZStd::string_view text, std::uint32_t suppressedCount);
+
+        bool TryPop(LogMessage& message);
+
+        bool IsEmpty() const;
+
+        std::size_t GetCapacity() const;
+
+        std::size_t GetByteSize() const;
+
+        // the capacity is rounded up to a power of two
+        static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    private:
+        struct Slot
+        {
+            std::atomic<std::size_t> m_sequence;
+            LogMessage m_message;
+        };
+
+        AZStd::unique_ptr<Slot[]> m_slots;
+        std::size_t m_mask;
+        alignas(64) std::atomic<std::size_t> m_pushPosition;
+        alignas(64) std::atomic<std::size_t> m_popPosition;
+    };
+} // namespace Cesium
@@ -0,0 +1,61 @@
+#include "Cesium/Systems/LogRateLimiter.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+
+namespace Cesium
+{
+    LogRateLimiter::LogRateLimiter(std::uint32_t maximumMessagesPerWindow, std::int64_t windowMilliseconds, std::size_t slotCount)
+        : m_slotCount{ AZStd::max(slotCount, std::size_t{ 1 }) }
+        , m_maximumMessagesPerWindow{ maximumMessagesPerWindow }
+        , m_windowMilliseconds{ windowMilliseconds }
+        , m_totalSuppressedCount{ 0 }
+    {
+        m_slots = AZStd::make_unique<Slot[]>(m_slotCount);
+    }
+
+    bool LogRateLimiter::Allow(AZStd::string_view text, std::int64_t nowMilliseconds, std::uint32_t& suppressedCount)
+    {
+        suppressedCount = 0;
+
+        // zero marks an unused slot
+        std::uint64_t hash = static_cast<std::uint64_t>(AZStd::hash<AZStd::string_view>{}(text));
+        hash = hash == 0 ? 1 : hash;
+
+        Slot& slot = m_slots[hash % m_slotCount];
+        if (slot.m_hash.load(std::memory_order_relaxed) != hash)
+        {
+            slot.m_hash.store(hash, std::memory_order_relaxed);
+            slot.m_windowStart.store(nowMilliseconds, std::memory_order_relaxed);
+            slot.m_windowCount.store(1, std::memory_order_relaxed);
+            slot.m_suppressedCount.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        std::int64_t windowStart = slot.m_windowStart.load(std::memory_order_relaxed);
+        if (nowMilliseconds - windowStart >= m_windowMilliseconds &&
+            slot.m_windowStart.compare_exchange_strong(windowStart, nowMilliseconds, std::memory_order_relaxed))
+        {
+            slot.m_windowCount.store(0, std::memory_order_relaxed);
+        }
+
+        if (slot.m_windowCount.fetch_add(1, std::memory_order_relaxed) >= m_maximumMessagesPerWindow)
+        {
+            slot.m_suppressedCount.fetch_add(1, std::memory_order_relaxed);
+            m_totalSuppressedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        suppressedCount = slot.m_suppressedCount.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::uint64_t LogRateLimiter::GetSuppressedCount() const
+    {
+        return m_totalSuppressedCount.load(std::memory_order_relaxed);
+    }
+
+    std::size_t LogRateLimiter::GetByteSize() const
+    {
+        return m_slotCount * sizeof(Slot);
+    }
+} // namespace Cesium
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Limits how many times the same message is logged per time window. Messages are identified by the hash of their text and
+    // tracked in a fixed table of atomic slots, so the check is lock-free. Two messages that share a slot evict each other, which
+    // only makes the limit less strict.
+    class LogRateLimiter final
+    {
+    public:
+        LogRateLimiter(
+            std::uint32_t maximumMessagesPerWindow = DEFAULT_MAXIMUM_MESSAGES_PER_WINDOW,
+            std::int64_t windowMilliseconds = DEFAULT_WINDOW_MILLISECONDS,
+            std::size_t slotCount = DEFAULT_SLOT_COUNT);
+
+        LogRateLimiter(const LogRateLimiter&) = delete;
+
+        LogRateLimiter& operator=(const LogRateLimiter&) = delete;
+
+        // return false if the message must be dropped. When the message is allowed, suppressedCount is the number of the same
+        // messages dropped since the last allowed one
+        bool Allow(AZStd::string_view text, std::int64_t nowMilliseconds, std::uint32_t& suppressedCount);
+
+        std::uint64_t GetSuppressedCount() const;
+
+        std::size_t GetByteSize() const;
+
+        static constexpr std::uint32_t DEFAULT_MAXIMUM_MESSAGES_PER_WINDOW = 5;
+        static constexpr std::int64_t DEFAULT_WINDOW_MILLISECONDS = 1000;
+        static constexpr std::size_t DEFAULT_SLOT_COUNT = 256;
+
+    private:
+        struct Slot
+        {
+            std::atomic<std::uint64_t> m_hash{ 0 };
+            std::atomic<std::int64_t> m_windowStart{ 0 };
+            std::atomic<std::uint32_t> m_windowCount{ 0 };
+            std::atomic<std::uint32_t> m_suppressedCount{ 0 };
+        };
+
+        AZStd::unique_ptr<Slot[]> m_slots;
+        std::size_t m_slotCount;
+        std::uint32_t m_maximumMessagesPerWindow;
+        std::int64_t m_windowMilliseconds;
+        std::atomic<std::uint64_t> m_totalSuppressedCount;
+    };
+} // namespace Cesium
@@ -1,51 +1,146 @@
 #include "Cesium/Systems/LoggerSink.h"
+#include "Cesium/Systems/MemoryTracker.h"
 #include <AzCore/Debug/Trace.h>
-#include <AzCore/std/parallel/scoped_lock.h>
+#include <chrono>
 
 namespace Cesium
 {
-    void LoggerSink::sink_it_([[maybe_unused]] const spdlog::details::log_msg& msg)
+    LoggerSink::LoggerSink()
+        : LoggerSink(LogMessageQueue::DEFAULT_CAPACITY, LogRateLimiter::DEFAULT_MAXIMUM_MESSAGES_PER_WINDOW)
+    {
+    }
+
+    LoggerSink::LoggerSink(std::size_t queueCapacity, std::uint32_t maximumMessagesPerSecond)
+        : m_queue{ queueCapacity }
+        , m_rateLimiter{ maximumMessagesPerSecond, 1000 }
+        , m_droppedCount{ 0 }
+        , m_queuedCount{ 0 }
+        , m_writtenCount{ 0 }
+        , m_running{ true }
+    {
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Cesium Logger";
+        m_drainThread = AZStd::thread(
+            threadDesc,
+            [this]()
+            {
+                while (m_running.load(std::memory_order_acquire))
+                {
+                    DrainMessages();
+                    AZStd::this_thread::sleep_for(DRAIN_INTERVAL);
+                }
+
+                DrainMessages();
+            });
+    }
+
+    LoggerSink::~LoggerSink() noexcept
+    {
+        m_running.store(false, std::memory_order_release);
+        if (m_drainThread.joinable())
+        {
+            m_drainThread.join();
+        }
+    }
+
+    std::uint64_t LoggerSink::GetSuppressedCount() const
+    {
+        return m_rateLimiter.GetSuppressedCount();
+    }
+
+    std::uint64_t LoggerSink::GetDroppedCount() const
+    {
+        return m_droppedCount.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t LoggerSink::GetWrittenCount() const
+    {
+        return m_writtenCount.load(std::memory_order_acquire);
+    }
+
+    void LoggerSink::sink_it_(const spdlog::details::log_msg& msg)
+    {
+        AZStd::string_view text(msg.payload.data(), msg.payload.size());
+        std::int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(msg.time.time_since_epoch()).count();
+        std::uint32_t suppressedCount = 0;
+        if (!m_rateLimiter.Allow(text, now, suppressedCount))
+        {
+            return;
+        }
+
+        if (m_queue.TryPush(msg.level, msg.time, text, suppressedCount))
+        {
+            m_queuedCount.fetch_add(1, std::memory_order_release);
+        }
+        else
+        {
+            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void LoggerSink::flush_()
+    {
+        // the drain thread is the only consumer of the queue, so wait for it instead of draining here. The queue is empty as soon
+        // as the last message is popped, so the wait is on the messages written, including the one being written now
+        std::uint64_t queuedCount = m_queuedCount.load(std::memory_order_acquire);
+        while (m_running.load(std::memory_order_acquire) && m_writtenCount.load(std::memory_order_acquire) < queuedCount)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    void LoggerSink::DrainMessages()
+    {
+        LogMessage message;
+        bool drained = false;
+        while (m_queue.TryPop(message))
+        {
+            OutputMessage(message);
+            m_writtenCount.fetch_add(1, std::memory_order_release);
+            drained = true;
+        }
+
+        if (drained)
+        {
+            if (MemoryTracker* memoryTracker = MemoryTrackerInterface::Get())
+            {
+                memoryTracker->SetLiveBytes(
+                    MemoryCategory::Logger, m_queue.GetByteSize() + m_rateLimiter.GetByteSize() + m_formatBuffer.capacity());
+            }
+        }
+    }
+
+    void LoggerSink::OutputMessage([[maybe_unused]] const LogMessage& message)
     {
 #ifdef AZ_ENABLE_TRACING
-        switch (msg.level)
+        if (message.m_suppressedCount > 0)
+        {
+            AZ_TracePrintf("Cesium", "%u identical messages were suppressed\n", message.m_suppressedCount);
+        }
+
+        // only the drain thread formats, so the formatter does not need a lock anymore
+        spdlog::details::log_msg msg(
+            message.m_time, spdlog::source_loc{}, spdlog::string_view_t{}, message.m_level,
+            spdlog::string_view_t(message.m_text, message.m_length));
+        m_formatBuffer.clear();
+        formatter_->format(msg, m_formatBuffer);
+        m_formatBuffer.push_back('\0');
+        const char* formatted = m_formatBuffer.data();
+
+        switch (message.m_level)
         {
-        case SPDLOG_LEVEL_TRACE:
-            AZ_TracePrintf("Cesium", FormatMessage(msg).c_str());
-            break;
-        case SPDLOG_LEVEL_DEBUG:
-            AZ_TracePrintf("Cesium", FormatMessage(msg).c_str());
-            break;
-        case SPDLOG_LEVEL_INFO:
-            AZ_TracePrintf("Cesium", FormatMessage(msg).c_str());
-            break;
         case SPDLOG_LEVEL_WARN:
-            AZ_Warning("Cesium", false, FormatMessage(msg).c_str());
+            AZ_Warning("Cesium", false, "%s", formatted);
             break;
         case SPDLOG_LEVEL_ERROR:
-            AZ_Error("Cesium", false, FormatMessage(msg).c_str());
+            AZ_Error("Cesium", false, "%s", formatted);
             break;
         case SPDLOG_LEVEL_CRITICAL:
-            AZ_Error("Cesium", false, FormatMessage(msg).c_str());
+            AZ_Error("Cesium", false, "%s", formatted);
             break;
         default:
-            AZ_TracePrintf("Cesium", FormatMessage(msg).c_str());
+            AZ_TracePrintf("Cesium", "%s", formatted);
         }
 #endif // AZ_ENABLE_TRACING
     }
-
-    void LoggerSink::flush_()
-    {
-    }
-
-    std::string LoggerSink::FormatMessage(const spdlog::details::log_msg& msg)
-    {
-        // Frustratingly, spdlog::formatter isn't thread safe. So even though our sink
-        // itself doesn't need to be protected by a mutex, the formatter does.
-        // See https://github.com/gabime/spdlog/issues/897
-        AZStd::scoped_lock<AZStd::mutex> lock(m_formatMutex);
-
-        spdlog::memory_buf_t formatted;
-        formatter_->format(msg, formatted);
-        return fmt::to_string(formatted);
-    }
 } // namespace Cesium
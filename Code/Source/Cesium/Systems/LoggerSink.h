@@ -1,23 +1,56 @@
 #pragma once
 
-#include <AzCore/std/parallel/mutex.h>
+#include "Cesium/Systems/LogMessageQueue.h"
+#include "Cesium/Systems/LogRateLimiter.h"
+#include <AzCore/std/parallel/thread.h>
 #include <spdlog/sinks/base_sink.h>
 #include <spdlog/details/null_mutex.h>
 #include <spdlog/logger.h>
-#include <string>
+#include <atomic>
+#include <cstdint>
 
 namespace Cesium
 {
+    // Logging threads only copy the message into a lock-free queue, after the rate limiter drops repeated messages. A background
+    // thread formats the messages and forwards them to the engine trace, so a burst of warnings from the workers never makes them
+    // wait on each other.
     class LoggerSink : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
     {
+    public:
+        LoggerSink();
+
+        LoggerSink(std::size_t queueCapacity, std::uint32_t maximumMessagesPerSecond);
+
+        ~LoggerSink() noexcept;
+
+        // messages dropped because the same message is logged too often
+        std::uint64_t GetSuppressedCount() const;
+
+        // messages dropped because the queue is full
+        std::uint64_t GetDroppedCount() const;
+
+        // messages forwarded to the engine trace
+        std::uint64_t GetWrittenCount() const;
+
     protected:
         void sink_it_(const spdlog::details::log_msg& msg) override;
 
         void flush_() override;
 
     private:
-        std::string FormatMessage(const spdlog::details::log_msg& msg);
+        void DrainMessages();
+
+        void OutputMessage(const LogMessage& message);
+
+        static constexpr AZStd::chrono::milliseconds DRAIN_INTERVAL{ 5 };
 
-        AZStd::mutex m_formatMutex;
+        LogMessageQueue m_queue;
+        LogRateLimiter m_rateLimiter;
+        std::atomic<std::uint64_t> m_droppedCount;
+        std::atomic<std::uint64_t> m_queuedCount;
+        std::atomic<std::uint64_t> m_writtenCount;
+        std::atomic_bool m_running;
+        spdlog::memory_buf_t m_formatBuffer;
+        AZStd::thread m_drainThread;
     };
 } // namespace Cesium
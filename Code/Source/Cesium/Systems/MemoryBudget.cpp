@@ -0,0 +1,271 @@
+#include "Cesium/Systems/MemoryBudget.h"
+#include <AzCore/std/algorithm.h>
+#include <limits>
+
+namespace Cesium
+{
+    MemoryBudget::MemoryBudget(std::uint64_t budgetBytes, std::uint64_t minimumBytes)
+        : m_budgetBytes{ budgetBytes }
+        , m_minimumBytes{ minimumBytes }
+        , m_nextConsumerId{ 1 }
+    {
+        m_status.m_budgetBytes = m_budgetBytes;
+    }
+
+    void MemoryBudget::SetBudgetBytes(std::uint64_t budgetBytes)
+    {
+        m_budgetBytes = budgetBytes;
+        m_status.m_budgetBytes = m_budgetBytes;
+    }
+
+    std::uint64_t MemoryBudget::GetBudgetBytes() const
+    {
+        return m_budgetBytes;
+    }
+
+    void MemoryBudget::SetMinimumBytes(std::uint64_t minimumBytes)
+    {
+        m_minimumBytes = minimumBytes;
+    }
+
+    std::uint64_t MemoryBudget::GetMinimumBytes() const
+    {
+        return m_minimumBytes;
+    }
+
+    MemoryBudget::ConsumerId MemoryBudget::AddConsumer()
+    {
+        // a new consumer keeps its own limit until the next rebalance
+        Consumer consumer;
+        consumer.m_id = m_nextConsumerId++;
+        consumer.m_usedBytes = 0;
+        consumer.m_maximumBytes = 0;
+        consumer.m_allocatedBytes = std::numeric_limits<std::uint64_t>::max();
+        consumer.m_screenContribution = 0.0;
+        m_consumers.emplace_back(consumer);
+        return consumer.m_id;
+    }
+
+    void MemoryBudget::RemoveConsumer(ConsumerId id)
+    {
+        auto it = AZStd::find_if(
+            m_consumers.begin(), m_consumers.end(),
+            [id](const Consumer& consumer)
+            {
+                return consumer.m_id == id;
+            });
+        if (it != m_consumers.end())
+        {
+            m_consumers.erase(it);
+        }
+    }
+
+    void MemoryBudget::ReportUsage(ConsumerId id, std::uint64_t usedBytes, std::uint64_t maximumBytes, double screenContribution)
+    {
+        Consumer* consumer = FindConsumer(id);
+        if (!consumer)
+        {
+            return;
+        }
+
+        consumer->m_usedBytes = usedBytes;
+        consumer->m_maximumBytes = maximumBytes;
+        consumer->m_allocatedBytes = AZStd::min(consumer->m_allocatedBytes, maximumBytes);
+        consumer->m_screenContribution = AZStd::clamp(screenContribution, 0.0, 1.0);
+    }
+
+    std::uint64_t MemoryBudget::GetAllocation(ConsumerId id) const
+    {
+        const Consumer* consumer = FindConsumer(id);
+        return consumer ? consumer->m_allocatedBytes : 0;
+    }
+
+    void MemoryBudget::Rebalance()
+    {
+        if (m_budgetBytes == 0)
+        {
+            for (Consumer& consumer : m_consumers)
+            {
+                consumer.m_allocatedBytes = consumer.m_maximumBytes;
+            }
+
+            UpdateStatus();
+            return;
+        }
+
+        std::uint64_t consumerCount = 0;
+        for (const Consumer& consumer : m_consumers)
+        {
+            consumerCount += consumer.m_maximumBytes > 0 ? 1 : 0;
+        }
+
+        // the guaranteed bytes are kept even without usage, so a tileset that is not on screen yet can cache what it loads
+        std::uint64_t guaranteedBytes = consumerCount > 0 ? AZStd::min(m_minimumBytes, m_budgetBytes / consumerCount) : 0;
+        std::uint64_t remainingBytes = m_budgetBytes;
+        for (Consumer& consumer : m_consumers)
+        {
+            consumer.m_allocatedBytes = AZStd::min(consumer.m_maximumBytes, guaranteedBytes);
+            remainingBytes -= AZStd::min(remainingBytes, consumer.m_allocatedBytes);
+        }
+
+        m_weights.assign(m_consumers.size(), 0.0);
+        m_activeConsumers.clear();
+        for (std::size_t i = 0; i < m_consumers.size(); ++i)
+        {
+            if (m_consumers[i].m_screenContribution > 0.0 && m_consumers[i].m_maximumBytes > m_consumers[i].m_allocatedBytes)
+            {
+                m_weights[i] = m_consumers[i].m_screenContribution;
+                m_activeConsumers.emplace_back(i);
+            }
+        }
+
+        remainingBytes = Distribute(m_activeConsumers, m_weights, remainingBytes);
+
+        // the bytes left are kept by the consumers that are not on screen, so looking back at them does not reload everything
+        m_activeConsumers.clear();
+        for (std::size_t i = 0; i < m_consumers.size(); ++i)
+        {
+            if (m_consumers[i].m_screenContribution <= 0.0 && m_consumers[i].m_maximumBytes > m_consumers[i].m_allocatedBytes)
+            {
+                m_weights[i] = static_cast<double>(m_consumers[i].m_usedBytes);
+                m_activeConsumers.emplace_back(i);
+            }
+        }
+
+        Distribute(m_activeConsumers, m_weights, remainingBytes);
+
+        for (Consumer& consumer : m_consumers)
+        {
+            if (consumer.m_allocatedBytes < consumer.m_maximumBytes)
+            {
+                consumer.m_allocatedBytes -= consumer.m_allocatedBytes % ALLOCATION_GRANULARITY;
+            }
+        }
+
+        UpdateStatus();
+    }
+
+    const MemoryBudgetStatus& MemoryBudget::GetStatus() const
+    {
+        return m_status;
+    }
+
+    MemoryBudget::Consumer* MemoryBudget::FindConsumer(ConsumerId id)
+    {
+        for (Consumer& consumer : m_consumers)
+        {
+            if (consumer.m_id == id)
+            {
+                return &consumer;
+            }
+        }
+
+        return nullptr;
+    }
+
+    const MemoryBudget::Consumer* MemoryBudget::FindConsumer(ConsumerId id) const
+    {
+        for (const Consumer& consumer : m_consumers)
+        {
+            if (consumer.m_id == id)
+            {
+                return &consumer;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::uint64_t MemoryBudget::Distribute(
+        AZStd::vector<std::size_t>& consumers, const AZStd::vector<double>& weights, std::uint64_t bytes)
+    {
+        while (!consumers.empty())
+        {
+            double totalWeight = 0.0;
+            for (std::size_t index : consumers)
+            {
+                totalWeight += weights[index];
+            }
+
+            if (totalWeight <= 0.0)
+            {
+                break;
+            }
+
+            m_cappedConsumers.clear();
+            for (std::size_t index : consumers)
+            {
+                double share = static_cast<double>(bytes) * weights[index] / totalWeight;
+                if (share >= static_cast<double>(m_consumers[index].m_maximumBytes - m_consumers[index].m_allocatedBytes))
+                {
+                    m_cappedConsumers.emplace_back(index);
+                }
+            }
+
+            if (m_cappedConsumers.empty())
+            {
+                std::uint64_t distributedBytes = 0;
+                for (std::size_t index : consumers)
+                {
+                    double share = static_cast<double>(bytes) * weights[index] / totalWeight;
+                    std::uint64_t shareBytes = AZStd::min(static_cast<std::uint64_t>(share), bytes - distributedBytes);
+                    m_consumers[index].m_allocatedBytes += shareBytes;
+                    distributedBytes += shareBytes;
+                }
+
+                consumers.clear();
+                return bytes - distributedBytes;
+            }
+
+            // the shares of the others are computed again with what is left
+            for (std::size_t index : m_cappedConsumers)
+            {
+                bytes -= m_consumers[index].m_maximumBytes - m_consumers[index].m_allocatedBytes;
+                m_consumers[index].m_allocatedBytes = m_consumers[index].m_maximumBytes;
+            }
+
+            consumers.erase(
+                AZStd::remove_if(
+                    consumers.begin(), consumers.end(),
+                    [this](std::size_t index)
+                    {
+                        return AZStd::find(m_cappedConsumers.begin(), m_cappedConsumers.end(), index) != m_cappedConsumers.end();
+                    }),
+                consumers.end());
+        }
+
+        return bytes;
+    }
+
+    void MemoryBudget::UpdateStatus()
+    {
+        m_status.m_budgetBytes = m_budgetBytes;
+        m_status.m_usedBytes = 0;
+        m_status.m_allocatedBytes = 0;
+        m_status.m_consumerCount = static_cast<std::uint32_t>(m_consumers.size());
+        m_status.m_evictingConsumerCount = 0;
+        for (const Consumer& consumer : m_consumers)
+        {
+            m_status.m_usedBytes += consumer.m_usedBytes;
+            m_status.m_allocatedBytes += consumer.m_allocatedBytes;
+            m_status.m_evictingConsumerCount += consumer.m_usedBytes > consumer.m_allocatedBytes ? 1 : 0;
+        }
+
+        if (m_budgetBytes == 0)
+        {
+            m_status.m_pressure = MemoryPressure::Normal;
+        }
+        else if (m_status.m_usedBytes > m_budgetBytes)
+        {
+            m_status.m_pressure = MemoryPressure::Critical;
+        }
+        else if (static_cast<double>(m_status.m_usedBytes) >= HIGH_PRESSURE_RATIO * static_cast<double>(m_budgetBytes))
+        {
+            m_status.m_pressure = MemoryPressure::High;
+        }
+        else
+        {
+            m_status.m_pressure = MemoryPressure::Normal;
+        }
+    }
+} // namespace Cesium
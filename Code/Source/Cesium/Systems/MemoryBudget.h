@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Cesium/EBus/MemoryBudgetBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Divides one cache budget between all the tilesets. Every frame each tileset reports its cached bytes, its own cache limit
+    // and how much of the viewports it covers. The budget is shared in proportion to the coverage, so a tileset that fills the
+    // screen keeps its tiles while a tileset far in the background evicts its least recently used tiles first. Each tileset first
+    // gets the minimum bytes, so a tileset out of view with an empty cache can still keep the tiles it loads. What one tileset
+    // cannot use is given to the others.
+    class MemoryBudget final
+    {
+    public:
+        using ConsumerId = std::uint32_t;
+
+        explicit MemoryBudget(std::uint64_t budgetBytes = DEFAULT_BUDGET_BYTES, std::uint64_t minimumBytes = DEFAULT_MINIMUM_BYTES);
+
+        // zero disables the budget, and every consumer keeps its own limit
+        void SetBudgetBytes(std::uint64_t budgetBytes);
+
+        std::uint64_t GetBudgetBytes() const;
+
+        // the bytes every consumer keeps whatever its screen contribution, as long as the budget allows it
+        void SetMinimumBytes(std::uint64_t minimumBytes);
+
+        std::uint64_t GetMinimumBytes() const;
+
+        ConsumerId AddConsumer();
+
+        void RemoveConsumer(ConsumerId id);
+
+        // screenContribution is the fraction of the viewports covered by the consumer in [0, 1]
+        void ReportUsage(ConsumerId id, std::uint64_t usedBytes, std::uint64_t maximumBytes, double screenContribution);
+
+        // the cache size the consumer may keep. It never exceeds the maximum bytes reported by the consumer
+        std::uint64_t GetAllocation(ConsumerId id) const;
+
+        // share the budget using the last reported usage. Called once per frame
+        void Rebalance();
+
+        const MemoryBudgetStatus& GetStatus() const;
+
+        static constexpr std::uint64_t DEFAULT_BUDGET_BYTES = 1024ull * 1024ull * 1024ull;
+        static constexpr std::uint64_t DEFAULT_MINIMUM_BYTES = 32ull * 1024ull * 1024ull;
+
+        // allocations are rounded to avoid changing the cache limits of the tilesets every frame
+        static constexpr std::uint64_t ALLOCATION_GRANULARITY = 1024ull * 1024ull;
+
+        static constexpr double HIGH_PRESSURE_RATIO = 0.75;
+
+    private:
+        struct Consumer
+        {
+            ConsumerId m_id;
+            std::uint64_t m_usedBytes;
+            std::uint64_t m_maximumBytes;
+            std::uint64_t m_allocatedBytes;
+            double m_screenContribution;
+        };
+
+        Consumer* FindConsumer(ConsumerId id);
+
+        const Consumer* FindConsumer(ConsumerId id) const;
+
+        // water filling: the bytes are shared in proportion to the weights on top of what the consumers already have, and the
+        // consumers reaching their maximum give the rest of their share to the others
+        std::uint64_t Distribute(AZStd::vector<std::size_t>& consumers, const AZStd::vector<double>& weights, std::uint64_t bytes);
+
+        void UpdateStatus();
+
+        AZStd::vector<Consumer> m_consumers;
+        AZStd::vector<std::size_t> m_activeConsumers;
+        AZStd::vector<std::size_t> m_cappedConsumers;
+        AZStd::vector<double> m_weights;
+        MemoryBudgetStatus m_status;
+        std::uint64_t m_budgetBytes;
+        std::uint64_t m_minimumBytes;
+        ConsumerId m_nextConsumerId;
+    };
+} // namespace Cesium
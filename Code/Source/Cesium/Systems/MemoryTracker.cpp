@@ -0,0 +1,197 @@
+#include "Cesium/Systems/MemoryTracker.h"
+
+namespace Cesium
+{
+    MemoryTracker::MemoryTracker()
+        : MemoryTracker(nullptr)
+    {
+    }
+
+    MemoryTracker::MemoryTracker(MemoryTracker* parent)
+        : m_parent{ parent }
+        , m_totalLiveBytes{ 0 }
+        , m_totalPeakBytes{ 0 }
+    {
+        for (std::size_t i = 0; i < CATEGORY_COUNT; ++i)
+        {
+            m_liveBytes[i] = 0;
+            m_peakBytes[i] = 0;
+        }
+    }
+
+    MemoryTracker::~MemoryTracker() noexcept
+    {
+        // give back whatever is still accounted, so the parent does not keep the bytes of a destroyed tileset
+        if (m_parent)
+        {
+            for (std::size_t i = 0; i < CATEGORY_COUNT; ++i)
+            {
+                m_parent->Free(static_cast<MemoryCategory>(i), m_liveBytes[i]);
+            }
+        }
+    }
+
+    void MemoryTracker::Allocate(MemoryCategory category, std::uint64_t bytes)
+    {
+        if (bytes == 0)
+        {
+            return;
+        }
+
+        std::size_t index = static_cast<std::size_t>(category);
+        UpdatePeak(m_peakBytes[index], m_liveBytes[index].fetch_add(bytes, std::memory_order_relaxed) + bytes);
+        UpdatePeak(m_totalPeakBytes, m_totalLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+        if (m_parent)
+        {
+            m_parent->Allocate(category, bytes);
+        }
+    }
+
+    void MemoryTracker::Free(MemoryCategory category, std::uint64_t bytes)
+    {
+        if (bytes == 0)
+        {
+            return;
+        }
+
+        std::size_t index = static_cast<std::size_t>(category);
+        m_liveBytes[index].fetch_sub(bytes, std::memory_order_relaxed);
+        m_totalLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        if (m_parent)
+        {
+            m_parent->Free(category, bytes);
+        }
+    }
+
+    void MemoryTracker::SetLiveBytes(MemoryCategory category, std::uint64_t bytes)
+    {
+        std::uint64_t current = m_liveBytes[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+        if (bytes > current)
+        {
+            Allocate(category, bytes - current);
+        }
+        else
+        {
+            Free(category, current - bytes);
+        }
+    }
+
+    std::uint64_t MemoryTracker::GetLiveBytes(MemoryCategory category) const
+    {
+        return m_liveBytes[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t MemoryTracker::GetPeakBytes(MemoryCategory category) const
+    {
+        return m_peakBytes[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t MemoryTracker::GetTotalLiveBytes() const
+    {
+        return m_totalLiveBytes.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t MemoryTracker::GetTotalPeakBytes() const
+    {
+        return m_totalPeakBytes.load(std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::ResetPeaks()
+    {
+        for (std::size_t i = 0; i < CATEGORY_COUNT; ++i)
+        {
+            m_peakBytes[i] = m_liveBytes[i].load(std::memory_order_relaxed);
+        }
+
+        m_totalPeakBytes = m_totalLiveBytes.load(std::memory_order_relaxed);
+    }
+
+    const char* MemoryTracker::GetCategoryName(MemoryCategory category)
+    {
+        switch (category)
+        {
+        case MemoryCategory::DecodedTiles:
+            return "DecodedTiles";
+        case MemoryCategory::BuiltAssets:
+            return "BuiltAssets";
+        case MemoryCategory::RasterImages:
+            return "RasterImages";
+        case MemoryCategory::HttpBodies:
+            return "HttpBodies";
+        case MemoryCategory::Logger:
+            return "Logger";
+        default:
+            return "Unknown";
+        }
+    }
+
+    void MemoryTracker::UpdatePeak(std::atomic<std::uint64_t>& peak, std::uint64_t value)
+    {
+        std::uint64_t currentPeak = peak.load(std::memory_order_relaxed);
+        while (value > currentPeak && !peak.compare_exchange_weak(currentPeak, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    TrackedMemory::TrackedMemory()
+        : m_tracker{ nullptr }
+        , m_category{ MemoryCategory::Count }
+        , m_bytes{ 0 }
+    {
+    }
+
+    TrackedMemory::TrackedMemory(MemoryTracker* tracker, MemoryCategory category, std::uint64_t bytes)
+        : m_tracker{ tracker }
+        , m_category{ category }
+        , m_bytes{ bytes }
+    {
+        if (m_tracker)
+        {
+            m_tracker->Allocate(m_category, m_bytes);
+        }
+    }
+
+    TrackedMemory::TrackedMemory(TrackedMemory&& rhs) noexcept
+        : m_tracker{ rhs.m_tracker }
+        , m_category{ rhs.m_category }
+        , m_bytes{ rhs.m_bytes }
+    {
+        rhs.m_tracker = nullptr;
+        rhs.m_bytes = 0;
+    }
+
+    TrackedMemory& TrackedMemory::operator=(TrackedMemory&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            Release();
+            m_tracker = rhs.m_tracker;
+            m_category = rhs.m_category;
+            m_bytes = rhs.m_bytes;
+            rhs.m_tracker = nullptr;
+            rhs.m_bytes = 0;
+        }
+
+        return *this;
+    }
+
+    TrackedMemory::~TrackedMemory() noexcept
+    {
+        Release();
+    }
+
+    std::uint64_t TrackedMemory::GetBytes() const
+    {
+        return m_bytes;
+    }
+
+    void TrackedMemory::Release()
+    {
+        if (m_tracker)
+        {
+            m_tracker->Free(m_category, m_bytes);
+            m_tracker = nullptr;
+            m_bytes = 0;
+        }
+    }
+} // namespace Cesium
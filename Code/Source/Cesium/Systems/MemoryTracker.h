@@ -0,0 +1,101 @@
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Cesium
+{
+    enum class MemoryCategory
+    {
+        DecodedTiles,
+        BuiltAssets,
+        RasterImages,
+        HttpBodies,
+        Logger,
+        Count
+    };
+
+    // Keeps the live bytes and the high-water mark of each memory category. A tracker can forward its changes to a parent,
+    // so each tileset owns a tracker whose bytes also show up in the system wide tracker.
+    class MemoryTracker final
+    {
+    public:
+        MemoryTracker();
+
+        explicit MemoryTracker(MemoryTracker* parent);
+
+        MemoryTracker(const MemoryTracker&) = delete;
+
+        MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+        ~MemoryTracker() noexcept;
+
+        void Allocate(MemoryCategory category, std::uint64_t bytes);
+
+        void Free(MemoryCategory category, std::uint64_t bytes);
+
+        // for the categories that are sampled instead of tracked per allocation
+        void SetLiveBytes(MemoryCategory category, std::uint64_t bytes);
+
+        std::uint64_t GetLiveBytes(MemoryCategory category) const;
+
+        std::uint64_t GetPeakBytes(MemoryCategory category) const;
+
+        std::uint64_t GetTotalLiveBytes() const;
+
+        std::uint64_t GetTotalPeakBytes() const;
+
+        void ResetPeaks();
+
+        static const char* GetCategoryName(MemoryCategory category);
+
+        static constexpr std::size_t CATEGORY_COUNT = static_cast<std::size_t>(MemoryCategory::Count);
+
+    private:
+        static void UpdatePeak(std::atomic<std::uint64_t>& peak, std::uint64_t value);
+
+        MemoryTracker* m_parent;
+        std::atomic<std::uint64_t> m_liveBytes[CATEGORY_COUNT];
+        std::atomic<std::uint64_t> m_peakBytes[CATEGORY_COUNT];
+        std::atomic<std::uint64_t> m_totalLiveBytes;
+        std::atomic<std::uint64_t> m_totalPeakBytes;
+    };
+
+    // Account the bytes of an allocation for as long as the owner is alive
+    class TrackedMemory final
+    {
+    public:
+        TrackedMemory();
+
+        TrackedMemory(MemoryTracker* tracker, MemoryCategory category, std::uint64_t bytes);
+
+        TrackedMemory(TrackedMemory&& rhs) noexcept;
+
+        TrackedMemory& operator=(TrackedMemory&& rhs) noexcept;
+
+        ~TrackedMemory() noexcept;
+
+        std::uint64_t GetBytes() const;
+
+    private:
+        void Release();
+
+        MemoryTracker* m_tracker;
+        MemoryCategory m_category;
+        std::uint64_t m_bytes;
+    };
+} // namespace Cesium
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE(Cesium::MemoryTracker, "{8F5D2A61-3B7C-4E9A-A1D4-6C0E2B9F7A53}");
+}
+
+namespace Cesium
+{
+    // the system wide tracker. HTTP bodies and the logger are only accounted here
+    using MemoryTrackerInterface = AZ::Interface<MemoryTracker>;
+}
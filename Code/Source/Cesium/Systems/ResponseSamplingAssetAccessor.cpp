@@ -0,0 +1,87 @@
+#include "Cesium/Systems/ResponseSamplingAssetAccessor.h"
+#include <AzCore/std/algorithm.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <chrono>
+
+namespace Cesium
+{
+    ResponseSamplingAssetAccessor::ResponseSamplingAssetAccessor(std::shared_ptr<CesiumAsync::IAssetAccessor> assetAccessor)
+        : m_assetAccessor{ std::move(assetAccessor) }
+        , m_requestsInFlight{ 0 }
+        , m_peakRequestsInFlight{ 0 }
+    {
+    }
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> ResponseSamplingAssetAccessor::requestAsset(
+        const CesiumAsync::AsyncSystem& asyncSystem, const std::string& url, const std::vector<THeader>& headers)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            ++m_requestsInFlight;
+            m_peakRequestsInFlight = AZStd::max(m_peakRequestsInFlight, m_requestsInFlight);
+        }
+
+        auto requestBegin = std::chrono::steady_clock::now();
+        return m_assetAccessor->requestAsset(asyncSystem, url, headers)
+            .thenImmediately(
+                [self = shared_from_this(), requestBegin](std::shared_ptr<CesiumAsync::IAssetRequest>&& request)
+                {
+                    const CesiumAsync::IAssetResponse* response = request ? request->response() : nullptr;
+                    ResponseSample sample;
+                    sample.m_latency = std::chrono::duration<double>(std::chrono::steady_clock::now() - requestBegin).count();
+                    sample.m_bytes = response ? static_cast<std::uint64_t>(response->data().size()) : 0;
+                    sample.m_failed = IsFailure(request.get());
+                    self->RecordResponse(sample);
+                    return std::move(request);
+                });
+    }
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> ResponseSamplingAssetAccessor::post(
+        const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& url,
+        const std::vector<THeader>& headers,
+        const gsl::span<const std::byte>& contentPayload)
+    {
+        return m_assetAccessor->post(asyncSystem, url, headers, contentPayload);
+    }
+
+    void ResponseSamplingAssetAccessor::tick() noexcept
+    {
+        m_assetAccessor->tick();
+    }
+
+    std::uint32_t ResponseSamplingAssetAccessor::TakeSamples(std::vector<ResponseSample>& samples)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        samples.clear();
+        samples.swap(m_samples);
+        std::uint32_t peakRequestsInFlight = m_peakRequestsInFlight;
+        m_peakRequestsInFlight = m_requestsInFlight;
+        return peakRequestsInFlight;
+    }
+
+    std::uint32_t ResponseSamplingAssetAccessor::GetRequestsInFlight()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_requestsInFlight;
+    }
+
+    bool ResponseSamplingAssetAccessor::IsFailure(const CesiumAsync::IAssetRequest* request)
+    {
+        const CesiumAsync::IAssetResponse* response = request ? request->response() : nullptr;
+        if (!response)
+        {
+            return true;
+        }
+
+        std::uint16_t statusCode = response->statusCode();
+        return statusCode == 0 || statusCode == 429 || statusCode >= 500;
+    }
+
+    void ResponseSamplingAssetAccessor::RecordResponse(const ResponseSample& sample)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_samples.emplace_back(sample);
+        --m_requestsInFlight;
+    }
+} // namespace Cesium
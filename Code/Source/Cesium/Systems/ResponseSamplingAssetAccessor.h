@@ -0,0 +1,59 @@
+#pragma once
+
+#include <AzCore/std/parallel/mutex.h>
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/Future.h>
+#include <CesiumAsync/IAssetAccessor.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Cesium
+{
+    struct ResponseSample
+    {
+        // in seconds
+        double m_latency;
+        std::uint64_t m_bytes;
+        bool m_failed;
+    };
+
+    // Records the latency and size of the responses of the wrapped accessor, and the requests in flight, so the simultaneous loads
+    // of a tileset can follow the link it is loaded over.
+    class ResponseSamplingAssetAccessor final
+        : public CesiumAsync::IAssetAccessor
+        , public std::enable_shared_from_this<ResponseSamplingAssetAccessor>
+    {
+    public:
+        explicit ResponseSamplingAssetAccessor(std::shared_ptr<CesiumAsync::IAssetAccessor> assetAccessor);
+
+        CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> requestAsset(
+            const CesiumAsync::AsyncSystem& asyncSystem, const std::string& url, const std::vector<THeader>& headers = {}) override;
+
+        CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> post(
+            const CesiumAsync::AsyncSystem& asyncSystem,
+            const std::string& url,
+            const std::vector<THeader>& headers = std::vector<THeader>(),
+            const gsl::span<const std::byte>& contentPayload = {}) override;
+
+        void tick() noexcept override;
+
+        // move the samples recorded since the last call into the vector. Return the most requests in flight during that time
+        std::uint32_t TakeSamples(std::vector<ResponseSample>& samples);
+
+        std::uint32_t GetRequestsInFlight();
+
+        // a request without response, throttled by the server or with a server error. A missing file is not a failure of the link
+        static bool IsFailure(const CesiumAsync::IAssetRequest* request);
+
+    private:
+        void RecordResponse(const ResponseSample& sample);
+
+        std::shared_ptr<CesiumAsync::IAssetAccessor> m_assetAccessor;
+        AZStd::mutex m_mutex;
+        std::vector<ResponseSample> m_samples;
+        std::uint32_t m_requestsInFlight;
+        std::uint32_t m_peakRequestsInFlight;
+    };
+} // namespace Cesium
@@ -0,0 +1,439 @@
+#include "Cesium/Systems/SnapshotAssetAccessor.h"
+#include "Cesium/Systems/GenericAssetAccessor.h"
+#include <AzCore/std/algorithm.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <cstring>
+#include <unordered_set>
+
+namespace Cesium
+{
+    namespace
+    {
+        constexpr char SNAPSHOT_MAGIC[4] = { 'C', 'T', 'S', 'S' };
+
+        // the query parameters holding credentials or sessions, which change between sessions without changing the content
+        constexpr const char* CREDENTIAL_PARAMETERS[] = { "access_token", "token", "key", "api_key", "apikey", "session",
+                                                          "sessionid", "session_id", "sig", "signature", "expires", "policy",
+                                                          "key-pair-id", "x-amz-credential", "x-amz-security-token",
+                                                          "x-amz-signature", "x-amz-date" };
+
+        bool IsCredentialParameter(const std::string& parameter)
+        {
+            std::string name = parameter.substr(0, parameter.find('='));
+            std::transform(
+                name.begin(), name.end(), name.begin(),
+                [](unsigned char c)
+                {
+                    return static_cast<char>(std::tolower(c));
+                });
+
+            return std::any_of(
+                std::begin(CREDENTIAL_PARAMETERS), std::end(CREDENTIAL_PARAMETERS),
+                [&name](const char* credential)
+                {
+                    return name == credential;
+                });
+        }
+
+        std::string GetPath(const std::string& url)
+        {
+            return url.substr(0, url.find('?'));
+        }
+
+        bool EndsWithSegment(const std::string& url, const std::string& relativeUrl)
+        {
+            if (relativeUrl.empty() || url.size() < relativeUrl.size() ||
+                url.compare(url.size() - relativeUrl.size(), relativeUrl.size(), relativeUrl) != 0)
+            {
+                return false;
+            }
+
+            if (url.size() == relativeUrl.size())
+            {
+                return true;
+            }
+
+            char separator = url[url.size() - relativeUrl.size() - 1];
+            return separator == '/' || separator == ':';
+        }
+
+        template<typename T>
+        void Append(IOContent& snapshot, const T& value)
+        {
+            const std::byte* begin = reinterpret_cast<const std::byte*>(&value);
+            snapshot.insert(snapshot.end(), begin, begin + sizeof(T));
+        }
+
+        void AppendBytes(IOContent& snapshot, const void* data, std::size_t size)
+        {
+            const std::byte* begin = reinterpret_cast<const std::byte*>(data);
+            snapshot.insert(snapshot.end(), begin, begin + size);
+        }
+
+        class SnapshotReader
+        {
+        public:
+            explicit SnapshotReader(const IOContent& snapshot)
+                : m_snapshot{ snapshot }
+                , m_offset{ 0 }
+            {
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (m_snapshot.size() - m_offset < sizeof(T))
+                {
+                    return false;
+                }
+
+                std::memcpy(&value, m_snapshot.data() + m_offset, sizeof(T));
+                m_offset += sizeof(T);
+                return true;
+            }
+
+            bool ReadBytes(std::uint64_t size, const std::byte*& data)
+            {
+                if (m_snapshot.size() - m_offset < size)
+                {
+                    return false;
+                }
+
+                data = m_snapshot.data() + m_offset;
+                m_offset += static_cast<std::size_t>(size);
+                return true;
+            }
+
+            bool ReadString(std::string& value)
+            {
+                std::uint32_t size = 0;
+                const std::byte* data = nullptr;
+                if (!Read(size) || !ReadBytes(size, data))
+                {
+                    return false;
+                }
+
+                value.assign(reinterpret_cast<const char*>(data), size);
+                return true;
+            }
+
+        private:
+            const IOContent& m_snapshot;
+            std::size_t m_offset;
+        };
+    } // namespace
+
+    SnapshotAssetAccessor::SnapshotAssetAccessor(
+        std::shared_ptr<CesiumAsync::IAssetAccessor> assetAccessor, std::uint64_t maximumRecordedBytes)
+        : m_assetAccessor{ std::move(assetAccessor) }
+        , m_maximumRecordedBytes{ maximumRecordedBytes }
+        , m_recordedContentBytes{ 0 }
+        , m_restoredRequestCount{ 0 }
+    {
+    }
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> SnapshotAssetAccessor::requestAsset(
+        const CesiumAsync::AsyncSystem& asyncSystem, const std::string& url, const std::vector<THeader>& headers)
+    {
+        std::string key = GetKey(url);
+        std::shared_ptr<const Response> restoredResponse;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto restored = m_restoredResponses.find(key);
+            if (restored != m_restoredResponses.end())
+            {
+                restoredResponse = restored->second;
+                ++m_restoredRequestCount;
+            }
+        }
+
+        if (restoredResponse)
+        {
+            // the restored response is recorded again, so it stays in the next snapshot
+            Record(restoredResponse);
+
+            std::string contentType = restoredResponse->m_contentType;
+            IOContent content = restoredResponse->m_content;
+            auto response = std::make_unique<GenericAssetResponse>(std::uint16_t{ 200 }, std::move(contentType), std::move(content));
+            std::shared_ptr<CesiumAsync::IAssetRequest> request =
+                std::make_shared<GenericAssetRequest>(std::string(url), CesiumAsync::HttpHeaders{}, std::move(response));
+            return asyncSystem.createResolvedFuture(std::move(request));
+        }
+
+        // the key of the request is used instead of the url of the response, which the accessors may rewrite
+        return m_assetAccessor->requestAsset(asyncSystem, url, headers)
+            .thenImmediately(
+                [self = shared_from_this(), key = std::move(key)](std::shared_ptr<CesiumAsync::IAssetRequest>&& request) mutable
+                {
+                    const CesiumAsync::IAssetResponse* response = request ? request->response() : nullptr;
+                    if (response && response->statusCode() >= 200 && response->statusCode() < 300)
+                    {
+                        auto recordedResponse = std::make_shared<Response>();
+                        recordedResponse->m_url = std::move(key);
+                        recordedResponse->m_contentType = response->contentType();
+                        recordedResponse->m_content.assign(response->data().begin(), response->data().end());
+                        recordedResponse->m_tree = IsTreeFile(recordedResponse->m_url, recordedResponse->m_contentType);
+                        self->Record(std::move(recordedResponse));
+                    }
+
+                    return std::move(request);
+                });
+    }
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> SnapshotAssetAccessor::post(
+        const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& url,
+        const std::vector<THeader>& headers,
+        const gsl::span<const std::byte>& contentPayload)
+    {
+        return m_assetAccessor->post(asyncSystem, url, headers, contentPayload);
+    }
+
+    void SnapshotAssetAccessor::tick() noexcept
+    {
+        m_assetAccessor->tick();
+    }
+
+    bool SnapshotAssetAccessor::Restore(const IOContent& snapshot)
+    {
+        SnapshotReader reader{ snapshot };
+        char magic[sizeof(SNAPSHOT_MAGIC)];
+        std::uint32_t version = 0;
+        std::uint32_t responseCount = 0;
+        if (!reader.Read(magic) || std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || !reader.Read(version) ||
+            version != SNAPSHOT_VERSION || !reader.Read(responseCount))
+        {
+            return false;
+        }
+
+        std::unordered_map<std::string, std::shared_ptr<const Response>> restoredResponses;
+        for (std::uint32_t i = 0; i < responseCount; ++i)
+        {
+            auto response = std::make_shared<Response>();
+            std::uint8_t tree = 0;
+            std::uint64_t contentSize = 0;
+            const std::byte* content = nullptr;
+            if (!reader.Read(tree) || !reader.ReadString(response->m_url) || !reader.ReadString(response->m_contentType) ||
+                !reader.Read(contentSize) || !reader.ReadBytes(contentSize, content))
+            {
+                return false;
+            }
+
+            response->m_tree = tree != 0;
+            response->m_content.assign(content, content + contentSize);
+            restoredResponses[response->m_url] = std::move(response);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_restoredResponses = std::move(restoredResponses);
+        return true;
+    }
+
+    void SnapshotAssetAccessor::ReleaseRestoredResponses()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_restoredResponses.clear();
+    }
+
+    IOContent SnapshotAssetAccessor::CreateSnapshot(const std::vector<std::string>& visibleTileIds) const
+    {
+        std::vector<std::shared_ptr<const Response>> responses;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (const auto& treeFile : m_recordedTreeFiles)
+            {
+                responses.emplace_back(treeFile.second);
+            }
+
+            // a content is only saved once, even when several visible tiles share it
+            std::unordered_set<std::string> savedContents;
+            for (auto content = m_recordedContents.rbegin(); content != m_recordedContents.rend(); ++content)
+            {
+                const std::string& key = (*content)->m_url;
+                if (savedContents.count(key) > 0)
+                {
+                    continue;
+                }
+
+                for (const std::string& tileId : visibleTileIds)
+                {
+                    if (MatchesTileId(key, tileId))
+                    {
+                        savedContents.insert(key);
+                        responses.emplace_back(*content);
+                        break;
+                    }
+                }
+            }
+        }
+
+        IOContent snapshot;
+        AppendBytes(snapshot, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        Append(snapshot, SNAPSHOT_VERSION);
+        Append(snapshot, static_cast<std::uint32_t>(responses.size()));
+        for (const std::shared_ptr<const Response>& response : responses)
+        {
+            Append(snapshot, static_cast<std::uint8_t>(response->m_tree ? 1 : 0));
+            Append(snapshot, static_cast<std::uint32_t>(response->m_url.size()));
+            AppendBytes(snapshot, response->m_url.data(), response->m_url.size());
+            Append(snapshot, static_cast<std::uint32_t>(response->m_contentType.size()));
+            AppendBytes(snapshot, response->m_contentType.data(), response->m_contentType.size());
+            Append(snapshot, static_cast<std::uint64_t>(response->m_content.size()));
+            AppendBytes(snapshot, response->m_content.data(), response->m_content.size());
+        }
+
+        return snapshot;
+    }
+
+    std::uint32_t SnapshotAssetAccessor::GetRestoredRequestCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_restoredRequestCount;
+    }
+
+    void SnapshotAssetAccessor::SetMaximumRecordedBytes(std::uint64_t maximumRecordedBytes)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_maximumRecordedBytes = maximumRecordedBytes;
+        EvictRecordedContents();
+    }
+
+    void SnapshotAssetAccessor::Record(std::shared_ptr<const Response> response)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (response->m_tree)
+        {
+            m_recordedTreeFiles[response->m_url] = std::move(response);
+            return;
+        }
+
+        m_recordedContentBytes += response->m_content.size();
+        m_recordedContents.emplace_back(std::move(response));
+        EvictRecordedContents();
+    }
+
+    void SnapshotAssetAccessor::EvictRecordedContents()
+    {
+        // the contents loaded first are dropped, since the visible tiles were usually loaded last
+        while (m_recordedContentBytes > m_maximumRecordedBytes && !m_recordedContents.empty())
+        {
+            m_recordedContentBytes -= m_recordedContents.front()->m_content.size();
+            m_recordedContents.pop_front();
+        }
+    }
+
+    std::string SnapshotAssetAccessor::GetKey(const std::string& url)
+    {
+        std::size_t queryBegin = url.find('?');
+        if (queryBegin == std::string::npos)
+        {
+            return url;
+        }
+
+        std::string key = url.substr(0, queryBegin);
+        char separator = '?';
+        std::size_t begin = queryBegin + 1;
+        while (begin <= url.size())
+        {
+            std::size_t end = AZStd::min(url.find('&', begin), url.size());
+            std::string parameter = url.substr(begin, end - begin);
+            if (!parameter.empty() && !IsCredentialParameter(parameter))
+            {
+                key += separator;
+                key += parameter;
+                separator = '&';
+            }
+
+            begin = end + 1;
+        }
+
+        return key;
+    }
+
+    bool SnapshotAssetAccessor::IsTreeFile(const std::string& key, const std::string& contentType)
+    {
+        std::string path = GetPath(key);
+        auto endsWith = [&path](const char* suffix)
+        {
+            std::size_t suffixSize = std::strlen(suffix);
+            return path.size() >= suffixSize && path.compare(path.size() - suffixSize, suffixSize, suffix) == 0;
+        };
+
+        return endsWith(".json") || endsWith(".subtree") || contentType.find("application/json") != std::string::npos;
+    }
+
+    bool SnapshotAssetAccessor::MatchesTileId(const std::string& key, const std::string& tileId)
+    {
+        std::vector<std::string> implicitCoordinates = ParseImplicitTileId(tileId);
+        if (!implicitCoordinates.empty())
+        {
+            return MatchesImplicitCoordinates(GetPath(key), implicitCoordinates);
+        }
+
+        // the explicit tile ids are the content uris as written in their tileset json. Without a query of their own, they match the
+        // urls whatever query the tileset adds to them
+        std::string relativeUrl = GetKey(tileId);
+        while (relativeUrl.compare(0, 2, "./") == 0)
+        {
+            relativeUrl.erase(0, 2);
+        }
+
+        if (relativeUrl.find('?') == std::string::npos)
+        {
+            return EndsWithSegment(GetPath(key), relativeUrl);
+        }
+
+        return EndsWithSegment(key, relativeUrl);
+    }
+
+    std::vector<std::string> SnapshotAssetAccessor::ParseImplicitTileId(const std::string& tileId)
+    {
+        // the implicit tile ids are written as L<level>-X<x>-Y<y>, and -Z<z> for the octrees
+        static constexpr char AXES[] = { 'L', 'X', 'Y', 'Z' };
+        std::vector<std::string> coordinates;
+        std::size_t begin = 0;
+        while (begin < tileId.size() && coordinates.size() < sizeof(AXES))
+        {
+            std::size_t end = AZStd::min(tileId.find('-', begin), tileId.size());
+            if (tileId[begin] != AXES[coordinates.size()] || end - begin < 2 ||
+                tileId.find_first_not_of("0123456789", begin + 1) < end)
+            {
+                return {};
+            }
+
+            coordinates.emplace_back(tileId.substr(begin + 1, end - begin - 1));
+            begin = end + 1;
+        }
+
+        if (begin < tileId.size() || coordinates.size() < 3)
+        {
+            return {};
+        }
+
+        return coordinates;
+    }
+
+    bool SnapshotAssetAccessor::MatchesImplicitCoordinates(const std::string& key, const std::vector<std::string>& coordinates)
+    {
+        // the content templates put the coordinates in their order as the last directories and the file name, like
+        // {level}/{x}/{y}.glb for the implicit tilesets and the terrains
+        std::size_t fileBegin = key.find_last_of("/:");
+        fileBegin = fileBegin == std::string::npos ? 0 : fileBegin + 1;
+        std::size_t extension = key.find('.', fileBegin);
+        std::size_t fileSize = extension == std::string::npos ? std::string::npos : extension - fileBegin;
+        std::vector<std::string> segments{ key.substr(fileBegin, fileSize) };
+        std::size_t end = fileBegin;
+        while (segments.size() < coordinates.size() && end > 1)
+        {
+            std::size_t separator = key.find_last_of("/:", end - 2);
+            std::size_t begin = separator == std::string::npos ? 0 : separator + 1;
+            segments.emplace_back(key.substr(begin, end - 1 - begin));
+            end = begin;
+        }
+
+        return std::equal(coordinates.rbegin(), coordinates.rend(), segments.begin(), segments.end());
+    }
+} // namespace Cesium
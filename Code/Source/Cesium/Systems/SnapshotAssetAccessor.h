@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Cesium/Systems/GenericIOManager.h"
+#include <AzCore/std/parallel/mutex.h>
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/Future.h>
+#include <CesiumAsync/IAssetAccessor.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Cesium
+{
+    // Serves the responses of the last session to the tileset at startup, so the tileset json, the external tilesets and the tiles
+    // that were visible are parsed without waiting for the network. Other requests go to the wrapped accessor, and their responses
+    // are recorded for the next snapshot: every tileset json and subtree, and the tile contents loaded last up to the maximum bytes.
+    // The restored responses are not revalidated, so they are released once the tileset reached full detail.
+    class SnapshotAssetAccessor final
+        : public CesiumAsync::IAssetAccessor
+        , public std::enable_shared_from_this<SnapshotAssetAccessor>
+    {
+    public:
+        SnapshotAssetAccessor(std::shared_ptr<CesiumAsync::IAssetAccessor> assetAccessor, std::uint64_t maximumRecordedBytes);
+
+        CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> requestAsset(
+            const CesiumAsync::AsyncSystem& asyncSystem, const std::string& url, const std::vector<THeader>& headers = {}) override;
+
+        CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> post(
+            const CesiumAsync::AsyncSystem& asyncSystem,
+            const std::string& url,
+            const std::vector<THeader>& headers = std::vector<THeader>(),
+            const gsl::span<const std::byte>& contentPayload = {}) override;
+
+        void tick() noexcept override;
+
+        // return false if the snapshot is not valid. Nothing is restored in that case
+        bool Restore(const IOContent& snapshot);
+
+        void ReleaseRestoredResponses();
+
+        // the tree files and the contents of the tiles with the ids. The explicit ids are relative to the url of their tileset json,
+        // and the implicit ids are matched with the contents named after their level and coordinates
+        IOContent CreateSnapshot(const std::vector<std::string>& visibleTileIds) const;
+
+        std::uint32_t GetRestoredRequestCount() const;
+
+        void SetMaximumRecordedBytes(std::uint64_t maximumRecordedBytes);
+
+        static constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+    private:
+        struct Response
+        {
+            std::string m_url;
+            std::string m_contentType;
+            IOContent m_content;
+            bool m_tree;
+        };
+
+        void Record(std::shared_ptr<const Response> response);
+
+        // the mutex must be held
+        void EvictRecordedContents();
+
+        // the url without its credential and session parameters, which change between sessions. The rest of the query is kept,
+        // since the servers addressing their tiles or versions with it serve other contents for it
+        static std::string GetKey(const std::string& url);
+
+        static bool IsTreeFile(const std::string& key, const std::string& contentType);
+
+        static bool MatchesTileId(const std::string& key, const std::string& tileId);
+
+        // the level and the coordinates of an implicit tile id, empty for the other ids
+        static std::vector<std::string> ParseImplicitTileId(const std::string& tileId);
+
+        static bool MatchesImplicitCoordinates(const std::string& key, const std::vector<std::string>& coordinates);
+
+        std::shared_ptr<CesiumAsync::IAssetAccessor> m_assetAccessor;
+        std::uint64_t m_maximumRecordedBytes;
+        mutable AZStd::mutex m_mutex;
+        std::unordered_map<std::string, std::shared_ptr<const Response>> m_restoredResponses;
+        std::unordered_map<std::string, std::shared_ptr<const Response>> m_recordedTreeFiles;
+        std::deque<std::shared_ptr<const Response>> m_recordedContents;
+        std::uint64_t m_recordedContentBytes;
+        std::uint32_t m_restoredRequestCount;
+    };
+} // namespace Cesium
@@ -1,28 +1,96 @@
 #include "Cesium/Systems/TaskProcessor.h"
+#include "Cesium/Systems/TraceRecorder.h"
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/ThreadAffinityPolicy.h"
 #include <AzCore/Jobs/JobFunction.h>
 
 namespace Cesium
 {
     TaskProcessor::TaskProcessor()
+        : TaskProcessor(nullptr, ThreadAffinityPolicy{})
     {
-        AZ::JobManagerDesc jobDesc;
-        for (size_t i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+    }
+
+    TaskProcessor::TaskProcessor(DeterministicTaskQueue* deterministicQueue)
+        : TaskProcessor(deterministicQueue, ThreadAffinityPolicy{})
+    {
+    }
+
+    TaskProcessor::TaskProcessor(const ThreadAffinityPolicy& affinityPolicy)
+        : TaskProcessor(nullptr, affinityPolicy)
+    {
+    }
+
+    TaskProcessor::TaskProcessor(DeterministicTaskQueue* deterministicQueue, const ThreadAffinityPolicy& affinityPolicy)
+        : m_deterministicQueue{ deterministicQueue }
+        , m_pendingTaskCount{ 0 }
+    {
+        if (!m_deterministicQueue)
         {
-            jobDesc.m_workerThreads.push_back({ static_cast<int>(i) });
+            AZ::JobManagerDesc jobDesc;
+            jobDesc.m_workerThreads = affinityPolicy.CreateWorkerThreadDescs();
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
         }
-        m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
-        m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
     }
 
     TaskProcessor::~TaskProcessor() noexcept
     {
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pendingTaskMutex);
+            m_pendingTaskCondition.wait(
+                lock,
+                [this]()
+                {
+                    return m_pendingTaskCount == 0;
+                });
+        }
+
         m_jobContext.reset();
         m_jobManager.reset();
     }
 
     void TaskProcessor::startTask(std::function<void()> task)
     {
-        AZ::Job* job = aznew AZ::JobFunction<std::function<void()>>(task, true, nullptr);
+        TraceRecorder* recorder = GetActiveTraceRecorder();
+        if (recorder)
+        {
+            // record how long the task waited in the queue before it is executed. The recorder is looked up again when the task
+            // runs, since it can be stopped or destroyed in the meantime
+            std::int64_t enqueueTime = recorder->GetTimestamp();
+            task = [enqueueTime, task = std::move(task)]()
+            {
+                if (TraceRecorder* taskRecorder = GetActiveTraceRecorder())
+                {
+                    taskRecorder->RecordComplete("Task", "TaskQueueWait", "", enqueueTime, taskRecorder->GetTimestamp());
+                }
+
+                ScopedTraceEvent traceEvent("Task", "TaskExecute");
+                task();
+            };
+        }
+
+        if (m_deterministicQueue)
+        {
+            m_deterministicQueue->Push(std::move(task));
+            return;
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingTaskMutex);
+            ++m_pendingTaskCount;
+        }
+
+        task = [this, task = std::move(task)]()
+        {
+            task();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingTaskMutex);
+            --m_pendingTaskCount;
+            m_pendingTaskCondition.notify_all();
+        };
+
+        AZ::Job* job = aznew AZ::JobFunction<std::function<void()>>(std::move(task), true, m_jobContext.get());
         job->Start();
     }
 } // namespace Cesium
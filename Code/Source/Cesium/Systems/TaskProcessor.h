@@ -2,22 +2,40 @@
 
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <CesiumAsync/ITaskProcessor.h>
+#include <cstdint>
 
 namespace Cesium
 {
+    class DeterministicTaskQueue;
+    struct ThreadAffinityPolicy;
+
     class TaskProcessor : public CesiumAsync::ITaskProcessor
     {
     public:
         TaskProcessor();
 
+        // run all tasks on the deterministic queue instead of the job manager
+        explicit TaskProcessor(DeterministicTaskQueue* deterministicQueue);
+
+        explicit TaskProcessor(const ThreadAffinityPolicy& affinityPolicy);
+
+        // wait for the tasks started on the job manager, so the work they hold, like writing a snapshot, is not lost
         ~TaskProcessor() noexcept;
 
         void startTask(std::function<void()> task) override;
 
     private:
+        TaskProcessor(DeterministicTaskQueue* deterministicQueue, const ThreadAffinityPolicy& affinityPolicy);
+
         AZStd::unique_ptr<AZ::JobManager> m_jobManager;
         AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        DeterministicTaskQueue* m_deterministicQueue;
+        AZStd::mutex m_pendingTaskMutex;
+        AZStd::condition_variable m_pendingTaskCondition;
+        std::uint32_t m_pendingTaskCount;
     };
 } // namespace Cesium
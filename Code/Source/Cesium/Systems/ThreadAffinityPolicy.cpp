@@ -0,0 +1,100 @@
+#include "Cesium/Systems/ThreadAffinityPolicy.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace Cesium
+{
+    ThreadAffinityPolicy::ThreadAffinityPolicy()
+        : m_reservedCores{ 0 }
+        , m_efficiencyCores{ 0 }
+        , m_workerThreadCount{ AUTO_THREAD_COUNT }
+        , m_httpThreadCount{ AUTO_THREAD_COUNT }
+        , m_fileThreadCount{ 2 }
+        , m_workerPriority{ DEFAULT_PRIORITY }
+        , m_ioPriority{ DEFAULT_PRIORITY }
+        , m_pinThreads{ true }
+    {
+    }
+
+    AZStd::vector<AZ::JobManagerThreadDesc> ThreadAffinityPolicy::CreateWorkerThreadDescs(std::uint32_t hardwareConcurrency) const
+    {
+        CoreRange cores = GetWorkerCores(hardwareConcurrency);
+        std::uint32_t threadCount = m_workerThreadCount == AUTO_THREAD_COUNT ? cores.m_count : m_workerThreadCount;
+        return CreateThreadDescs(threadCount, cores, m_workerPriority);
+    }
+
+    AZStd::vector<AZ::JobManagerThreadDesc> ThreadAffinityPolicy::CreateHttpThreadDescs(std::uint32_t hardwareConcurrency) const
+    {
+        // HTTP threads mostly wait on the network, so by default there are more of them than IO cores
+        std::uint32_t threadCount = m_httpThreadCount == AUTO_THREAD_COUNT ? AZStd::max(hardwareConcurrency, 1u) : m_httpThreadCount;
+        return CreateThreadDescs(threadCount, GetIOCores(hardwareConcurrency), m_ioPriority);
+    }
+
+    AZStd::vector<AZ::JobManagerThreadDesc> ThreadAffinityPolicy::CreateFileThreadDescs(std::uint32_t hardwareConcurrency) const
+    {
+        std::uint32_t threadCount = AZStd::max(m_fileThreadCount, 1u);
+        return CreateThreadDescs(threadCount, GetIOCores(hardwareConcurrency), m_ioPriority);
+    }
+
+    AZStd::vector<AZ::JobManagerThreadDesc> ThreadAffinityPolicy::CreateWorkerThreadDescs() const
+    {
+        return CreateWorkerThreadDescs(AZStd::thread::hardware_concurrency());
+    }
+
+    AZStd::vector<AZ::JobManagerThreadDesc> ThreadAffinityPolicy::CreateHttpThreadDescs() const
+    {
+        return CreateHttpThreadDescs(AZStd::thread::hardware_concurrency());
+    }
+
+    AZStd::vector<AZ::JobManagerThreadDesc> ThreadAffinityPolicy::CreateFileThreadDescs() const
+    {
+        return CreateFileThreadDescs(AZStd::thread::hardware_concurrency());
+    }
+
+    ThreadAffinityPolicy::CoreRange ThreadAffinityPolicy::GetWorkerCores(std::uint32_t hardwareConcurrency) const
+    {
+        // always leave at least one core to Cesium
+        hardwareConcurrency = AZStd::max(hardwareConcurrency, 1u);
+        std::uint32_t reservedCores = AZStd::min(m_reservedCores, hardwareConcurrency - 1);
+        std::uint32_t usableCores = hardwareConcurrency - reservedCores;
+
+        // when every usable core is an efficiency core, the workers share them with the IO threads
+        std::uint32_t efficiencyCores = AZStd::min(m_efficiencyCores, usableCores);
+        if (efficiencyCores == usableCores)
+        {
+            return CoreRange{ reservedCores, usableCores };
+        }
+
+        return CoreRange{ reservedCores, usableCores - efficiencyCores };
+    }
+
+    ThreadAffinityPolicy::CoreRange ThreadAffinityPolicy::GetIOCores(std::uint32_t hardwareConcurrency) const
+    {
+        hardwareConcurrency = AZStd::max(hardwareConcurrency, 1u);
+        std::uint32_t reservedCores = AZStd::min(m_reservedCores, hardwareConcurrency - 1);
+        std::uint32_t usableCores = hardwareConcurrency - reservedCores;
+        std::uint32_t efficiencyCores = AZStd::min(m_efficiencyCores, usableCores);
+        if (efficiencyCores == 0)
+        {
+            return CoreRange{ reservedCores, usableCores };
+        }
+
+        return CoreRange{ hardwareConcurrency - efficiencyCores, efficiencyCores };
+    }
+
+    AZStd::vector<AZ::JobManagerThreadDesc> ThreadAffinityPolicy::CreateThreadDescs(
+        std::uint32_t threadCount, CoreRange cores, int priority) const
+    {
+        AZStd::vector<AZ::JobManagerThreadDesc> threadDescs;
+        threadDescs.reserve(threadCount);
+        for (std::uint32_t i = 0; i < threadCount; ++i)
+        {
+            AZ::JobManagerThreadDesc threadDesc;
+            threadDesc.m_cpuId = m_pinThreads ? static_cast<int>(cores.m_begin + i % cores.m_count) : -1;
+            threadDesc.m_priority = priority;
+            threadDescs.emplace_back(threadDesc);
+        }
+
+        return threadDescs;
+    }
+} // namespace Cesium
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/std/containers/vector.h>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Decides how many threads each Cesium job manager creates, which cores they are pinned to, and their priority.
+    // The first m_reservedCores cores are left to the engine main and render threads. The last m_efficiencyCores of the remaining
+    // cores are treated as efficiency cores: the IO threads are pinned to them and the task workers use the other cores.
+    struct ThreadAffinityPolicy final
+    {
+        ThreadAffinityPolicy();
+
+        AZStd::vector<AZ::JobManagerThreadDesc> CreateWorkerThreadDescs(std::uint32_t hardwareConcurrency) const;
+
+        AZStd::vector<AZ::JobManagerThreadDesc> CreateHttpThreadDescs(std::uint32_t hardwareConcurrency) const;
+
+        AZStd::vector<AZ::JobManagerThreadDesc> CreateFileThreadDescs(std::uint32_t hardwareConcurrency) const;
+
+        AZStd::vector<AZ::JobManagerThreadDesc> CreateWorkerThreadDescs() const;
+
+        AZStd::vector<AZ::JobManagerThreadDesc> CreateHttpThreadDescs() const;
+
+        AZStd::vector<AZ::JobManagerThreadDesc> CreateFileThreadDescs() const;
+
+        // keep the engine default priority of the thread
+        static constexpr int DEFAULT_PRIORITY = -100000;
+
+        // 0 uses one thread per usable core for the workers and one per hardware thread for HTTP
+        static constexpr std::uint32_t AUTO_THREAD_COUNT = 0;
+
+        std::uint32_t m_reservedCores;
+        std::uint32_t m_efficiencyCores;
+        std::uint32_t m_workerThreadCount;
+        std::uint32_t m_httpThreadCount;
+        std::uint32_t m_fileThreadCount;
+        int m_workerPriority;
+        int m_ioPriority;
+        bool m_pinThreads;
+
+    private:
+        struct CoreRange
+        {
+            std::uint32_t m_begin;
+            std::uint32_t m_count;
+        };
+
+        CoreRange GetWorkerCores(std::uint32_t hardwareConcurrency) const;
+
+        CoreRange GetIOCores(std::uint32_t hardwareConcurrency) const;
+
+        AZStd::vector<AZ::JobManagerThreadDesc> CreateThreadDescs(std::uint32_t threadCount, CoreRange cores, int priority) const;
+    };
+} // namespace Cesium
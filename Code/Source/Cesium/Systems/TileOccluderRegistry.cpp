@@ -0,0 +1,83 @@
+#include "Cesium/Systems/TileOccluderRegistry.h"
+#include <AzCore/std/algorithm.h>
+
+namespace Cesium
+{
+    TileOccluderRegistry::TileOccluderRegistry()
+        : m_nextSourceId{ 1 }
+    {
+    }
+
+    TileOccluderRegistry::SourceId TileOccluderRegistry::AddSource()
+    {
+        Source source;
+        source.m_id = m_nextSourceId++;
+        m_sources.emplace_back(AZStd::move(source));
+        return m_sources.back().m_id;
+    }
+
+    void TileOccluderRegistry::RemoveSource(SourceId id)
+    {
+        auto it = AZStd::find_if(
+            m_sources.begin(), m_sources.end(),
+            [id](const Source& source)
+            {
+                return source.m_id == id;
+            });
+        if (it != m_sources.end())
+        {
+            m_sources.erase(it);
+        }
+    }
+
+    void TileOccluderRegistry::SubmitOccluders(SourceId id, const AZStd::vector<TileOccluder>& occluders)
+    {
+        if (Source* source = FindSource(id))
+        {
+            source->m_occluders.assign(occluders.begin(), occluders.end());
+        }
+    }
+
+    void TileOccluderRegistry::ClearOccluders(SourceId id)
+    {
+        if (Source* source = FindSource(id))
+        {
+            source->m_occluders.clear();
+        }
+    }
+
+    void TileOccluderRegistry::CollectOccluders(SourceId excludedId, AZStd::vector<TileOccluder>& occluders) const
+    {
+        for (const Source& source : m_sources)
+        {
+            if (source.m_id != excludedId)
+            {
+                occluders.insert(occluders.end(), source.m_occluders.begin(), source.m_occluders.end());
+            }
+        }
+    }
+
+    std::size_t TileOccluderRegistry::GetOccluderCount() const
+    {
+        std::size_t occluderCount = 0;
+        for (const Source& source : m_sources)
+        {
+            occluderCount += source.m_occluders.size();
+        }
+
+        return occluderCount;
+    }
+
+    TileOccluderRegistry::Source* TileOccluderRegistry::FindSource(SourceId id)
+    {
+        for (Source& source : m_sources)
+        {
+            if (source.m_id == id)
+            {
+                return &source;
+            }
+        }
+
+        return nullptr;
+    }
+} // namespace Cesium
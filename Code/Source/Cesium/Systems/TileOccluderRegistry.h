@@ -0,0 +1,55 @@
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Box in earth centered, earth fixed coordinates that hides what is behind it. The axes are unit vectors
+    struct TileOccluder
+    {
+        glm::dvec3 m_center;
+        glm::dmat3 m_axes;
+        glm::dvec3 m_halfExtents;
+
+        // apparent size from the cameras, used to keep the occluders that hide the most
+        double m_score;
+    };
+
+    // The occluders shared between the tilesets, so the ground of a terrain tileset hides the buildings of another tileset. Each
+    // source replaces its occluders once per frame, and the others see them on their next update
+    class TileOccluderRegistry final
+    {
+    public:
+        using SourceId = std::uint32_t;
+
+        TileOccluderRegistry();
+
+        SourceId AddSource();
+
+        void RemoveSource(SourceId id);
+
+        void SubmitOccluders(SourceId id, const AZStd::vector<TileOccluder>& occluders);
+
+        void ClearOccluders(SourceId id);
+
+        // append the occluders of every source except the excluded one
+        void CollectOccluders(SourceId excludedId, AZStd::vector<TileOccluder>& occluders) const;
+
+        std::size_t GetOccluderCount() const;
+
+    private:
+        struct Source
+        {
+            SourceId m_id;
+            AZStd::vector<TileOccluder> m_occluders;
+        };
+
+        Source* FindSource(SourceId id);
+
+        AZStd::vector<Source> m_sources;
+        SourceId m_nextSourceId;
+    };
+} // namespace Cesium
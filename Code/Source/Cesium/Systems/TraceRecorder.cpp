@@ -0,0 +1,246 @@
+#include "Cesium/Systems/TraceRecorder.h"
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/std/algorithm.h>
+#include <functional>
+#include <thread>
+
+namespace Cesium
+{
+    TraceEvent::TraceEvent()
+        : m_category{ "" }
+        , m_name{ "" }
+        , m_threadId{ 0 }
+        , m_timestamp{ 0 }
+        , m_duration{ 0 }
+        , m_instant{ false }
+    {
+    }
+
+    TraceRecorder::TraceRecorder()
+        : m_epoch{ std::chrono::steady_clock::now() }
+        , m_recording{ false }
+        , m_nextEvent{ 0 }
+        , m_wrapped{ false }
+    {
+    }
+
+    void TraceRecorder::Start(std::size_t capacity)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_eventsMutex);
+        m_events.clear();
+        m_events.resize(AZStd::max(capacity, std::size_t{ 1 }));
+        m_nextEvent = 0;
+        m_wrapped = false;
+        m_recording = true;
+    }
+
+    void TraceRecorder::Stop()
+    {
+        m_recording = false;
+    }
+
+    void TraceRecorder::Clear()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_eventsMutex);
+        m_nextEvent = 0;
+        m_wrapped = false;
+    }
+
+    bool TraceRecorder::IsRecording() const
+    {
+        return m_recording;
+    }
+
+    std::int64_t TraceRecorder::GetTimestamp() const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+    }
+
+    void TraceRecorder::RecordComplete(
+        const char* category, const char* name, AZStd::string_view tag, std::int64_t begin, std::int64_t end)
+    {
+        if (!m_recording)
+        {
+            return;
+        }
+
+        TraceEvent event;
+        event.m_category = category;
+        event.m_name = name;
+        event.m_tag = tag;
+        event.m_threadId = GetCurrentThreadId();
+        event.m_timestamp = begin;
+        event.m_duration = AZStd::max(end - begin, std::int64_t{ 0 });
+        Record(std::move(event));
+    }
+
+    void TraceRecorder::RecordInstant(const char* category, const char* name, AZStd::string_view tag)
+    {
+        if (!m_recording)
+        {
+            return;
+        }
+
+        TraceEvent event;
+        event.m_category = category;
+        event.m_name = name;
+        event.m_tag = tag;
+        event.m_threadId = GetCurrentThreadId();
+        event.m_timestamp = GetTimestamp();
+        event.m_instant = true;
+        Record(std::move(event));
+    }
+
+    AZStd::vector<TraceEvent> TraceRecorder::GetEvents() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_eventsMutex);
+        AZStd::vector<TraceEvent> events;
+        if (m_wrapped)
+        {
+            // oldest events start right after the last written slot
+            events.reserve(m_events.size());
+            events.insert(events.end(), m_events.begin() + m_nextEvent, m_events.end());
+        }
+        else
+        {
+            events.reserve(m_nextEvent);
+        }
+
+        events.insert(events.end(), m_events.begin(), m_events.begin() + m_nextEvent);
+        return events;
+    }
+
+    AZStd::string TraceRecorder::ExportChromeTrace() const
+    {
+        AZStd::vector<TraceEvent> events = GetEvents();
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        writer.StartObject();
+        writer.Key("displayTimeUnit");
+        writer.String("ms");
+        writer.Key("traceEvents");
+        writer.StartArray();
+        for (const TraceEvent& event : events)
+        {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(event.m_name);
+            writer.Key("cat");
+            writer.String(event.m_category);
+            writer.Key("ph");
+            writer.String(event.m_instant ? "i" : "X");
+            writer.Key("ts");
+            writer.Int64(event.m_timestamp);
+            if (event.m_instant)
+            {
+                writer.Key("s");
+                writer.String("t");
+            }
+            else
+            {
+                writer.Key("dur");
+                writer.Int64(event.m_duration);
+            }
+
+            writer.Key("pid");
+            writer.Int(1);
+            writer.Key("tid");
+            writer.Uint64(event.m_threadId);
+            if (!event.m_tag.empty())
+            {
+                writer.Key("args");
+                writer.StartObject();
+                writer.Key("tile");
+                writer.String(event.m_tag.c_str(), static_cast<rapidjson::SizeType>(event.m_tag.size()));
+                writer.EndObject();
+            }
+
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+        writer.EndObject();
+        return AZStd::string(buffer.GetString(), buffer.GetSize());
+    }
+
+    bool TraceRecorder::ExportChromeTrace(const AZStd::string& path) const
+    {
+        AZ::IO::FileIOStream stream(path.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeText);
+        if (!stream.IsOpen())
+        {
+            return false;
+        }
+
+        AZStd::string json = ExportChromeTrace();
+        return stream.Write(json.size(), json.data()) == json.size();
+    }
+
+    void TraceRecorder::Record(TraceEvent&& event)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_eventsMutex);
+        if (m_events.empty())
+        {
+            return;
+        }
+
+        m_events[m_nextEvent] = std::move(event);
+        ++m_nextEvent;
+        if (m_nextEvent == m_events.size())
+        {
+            m_nextEvent = 0;
+            m_wrapped = true;
+        }
+    }
+
+    std::uint64_t TraceRecorder::GetCurrentThreadId()
+    {
+        return static_cast<std::uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    }
+
+    ScopedTraceEvent::ScopedTraceEvent(const char* category, const char* name)
+        : m_recorder{ GetActiveTraceRecorder() }
+        , m_category{ category }
+        , m_name{ name }
+        , m_begin{ 0 }
+    {
+        if (m_recorder)
+        {
+            m_begin = m_recorder->GetTimestamp();
+        }
+    }
+
+    ScopedTraceEvent::ScopedTraceEvent(const char* category, const char* name, AZStd::string_view tag)
+        : m_recorder{ GetActiveTraceRecorder() }
+        , m_category{ category }
+        , m_name{ name }
+        , m_begin{ 0 }
+    {
+        if (m_recorder)
+        {
+            m_tag = tag;
+            m_begin = m_recorder->GetTimestamp();
+        }
+    }
+
+    ScopedTraceEvent::~ScopedTraceEvent() noexcept
+    {
+        if (m_recorder)
+        {
+            m_recorder->RecordComplete(m_category, m_name, m_tag, m_begin, m_recorder->GetTimestamp());
+        }
+    }
+
+    TraceRecorder* GetActiveTraceRecorder()
+    {
+        TraceRecorder* recorder = TraceRecorderInterface::Get();
+        if (recorder && recorder->IsRecording())
+        {
+            return recorder;
+        }
+
+        return nullptr;
+    }
+} // namespace Cesium
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace Cesium
+{
+    struct TraceEvent final
+    {
+        TraceEvent();
+
+        const char* m_category;
+        const char* m_name;
+        AZStd::string m_tag;
+        std::uint64_t m_threadId;
+        std::int64_t m_timestamp;
+        std::int64_t m_duration;
+        bool m_instant;
+    };
+
+    // Records timed events of the tile lifecycle (queue wait, request, decode, build, first visible) into a fixed-size
+    // ring buffer. The events can be exported in the Chrome trace event format, which is viewable in Perfetto.
+    class TraceRecorder final
+    {
+    public:
+        TraceRecorder();
+
+        void Start(std::size_t capacity = DEFAULT_CAPACITY);
+
+        void Stop();
+
+        void Clear();
+
+        bool IsRecording() const;
+
+        std::int64_t GetTimestamp() const;
+
+        void RecordComplete(const char* category, const char* name, AZStd::string_view tag, std::int64_t begin, std::int64_t end);
+
+        void RecordInstant(const char* category, const char* name, AZStd::string_view tag);
+
+        AZStd::vector<TraceEvent> GetEvents() const;
+
+        AZStd::string ExportChromeTrace() const;
+
+        bool ExportChromeTrace(const AZStd::string& path) const;
+
+        static constexpr std::size_t DEFAULT_CAPACITY = 65536;
+
+    private:
+        void Record(TraceEvent&& event);
+
+        static std::uint64_t GetCurrentThreadId();
+
+        std::chrono::steady_clock::time_point m_epoch;
+        std::atomic_bool m_recording;
+        mutable AZStd::mutex m_eventsMutex;
+        AZStd::vector<TraceEvent> m_events;
+        std::size_t m_nextEvent;
+        bool m_wrapped;
+    };
+
+    class ScopedTraceEvent final
+    {
+    public:
+        ScopedTraceEvent(const char* category, const char* name);
+
+        ScopedTraceEvent(const char* category, const char* name, AZStd::string_view tag);
+
+        ScopedTraceEvent(const ScopedTraceEvent&) = delete;
+
+        ScopedTraceEvent& operator=(const ScopedTraceEvent&) = delete;
+
+        ~ScopedTraceEvent() noexcept;
+
+    private:
+        TraceRecorder* m_recorder;
+        const char* m_category;
+        const char* m_name;
+        AZStd::string m_tag;
+        std::int64_t m_begin;
+    };
+
+} // namespace Cesium
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE(Cesium::TraceRecorder, "{3E1A8C5B-0C4D-4F1B-8E6A-7B2D9C4F1A30}");
+}
+
+namespace Cesium
+{
+    using TraceRecorderInterface = AZ::Interface<TraceRecorder>;
+
+    // returns the registered recorder only while it is recording, so instrumented code can skip the tracing cost
+    TraceRecorder* GetActiveTraceRecorder();
+}
@@ -0,0 +1,536 @@
+#include "Cesium/Systems/ViewStateProvider.h"
+#include <Cesium/EBus/OriginShiftComponentBus.h>
+#include <Atom/RPI.Public/ViewportContext.h>
+#include <Atom/RPI.Public/ViewportContextBus.h>
+#include <Atom/RPI.Public/View.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Cesium
+{
+    ViewStateProvider::ViewStateProvider()
+        : m_nextPrefetchViewsId{ 1 }
+        , m_prefetchViewsVersion{ 0 }
+        , m_viewportDetailVersion{ 0 }
+        , m_inactiveScreenSpaceErrorMultiplier{ DEFAULT_INACTIVE_SCREEN_SPACE_ERROR_MULTIPLIER }
+        , m_inactivePriority{ DEFAULT_INACTIVE_PRIORITY }
+        , m_dropInactiveViewports{ false }
+    {
+    }
+
+    void ViewStateProvider::Update()
+    {
+        UpdatePrefetchReadiness();
+    }
+
+    void ViewStateProvider::SetCameras(AZStd::vector<ViewportCamera> cameras, float deltaTime)
+    {
+        UpdatePrefetchReadiness();
+        UpdateCameras(AZStd::move(cameras), deltaTime);
+    }
+
+    const AZStd::vector<ViewportCamera>& ViewStateProvider::GetCameras()
+    {
+        ReadViewportCameras();
+        return m_cameras;
+    }
+
+    void ViewStateProvider::ReadViewportCameras()
+    {
+        // the tilesets tick in any order with the camera controllers, so the cameras are read on the first use of every tick
+        // instead of at a fixed point of the frame. Without a tick bus, the cameras are only set by SetCameras()
+        if (!AZ::TickRequestBus::HasHandlers())
+        {
+            return;
+        }
+
+        AZ::ScriptTimePoint tickTime;
+        AZ::TickRequestBus::BroadcastResult(tickTime, &AZ::TickRequestBus::Events::GetTimeAtCurrentTick);
+        if (m_lastTickTime && *m_lastTickTime == tickTime.Get())
+        {
+            return;
+        }
+
+        float deltaTime = m_lastTickTime ? AZStd::chrono::duration<float>(tickTime.Get() - *m_lastTickTime).count() : 0.0f;
+        m_lastTickTime = tickTime.Get();
+
+        AZStd::vector<ViewportCamera> cameras;
+        auto viewportManager = AZ::Interface<AZ::RPI::ViewportContextRequestsInterface>::Get();
+        if (!viewportManager)
+        {
+            UpdateCameras(AZStd::move(cameras), deltaTime);
+            return;
+        }
+
+        // the default viewport is the one the user works in. The others, like the secondary viewports and the previews of the
+        // Editor, are in the background
+        AZ::RPI::ViewportContextPtr defaultViewportContext = viewportManager->GetDefaultViewportContext();
+        AzFramework::ViewportId defaultViewportId =
+            defaultViewportContext ? defaultViewportContext->GetId() : AzFramework::InvalidViewportId;
+        viewportManager->EnumerateViewportContexts(
+            [this, &cameras, defaultViewportId](AZ::RPI::ViewportContextPtr viewportContextPtr) mutable
+            {
+                // collapsed and minimized viewports have no size
+                AzFramework::WindowSize windowSize = viewportContextPtr->GetViewportSize();
+                if (windowSize.m_width == 0 || windowSize.m_height == 0)
+                {
+                    return;
+                }
+
+                // Get o3de camera configuration
+                AZ::RPI::ViewPtr view = viewportContextPtr->GetDefaultView();
+                if (!view)
+                {
+                    return;
+                }
+
+                AZ::Transform o3deCameraTransform = view->GetCameraTransform();
+                AZ::Vector3 o3deCameraFwd = o3deCameraTransform.GetBasis(1);
+                AZ::Vector3 o3deCameraUp = o3deCameraTransform.GetBasis(2);
+                AZ::Vector3 o3deCameraPosition = o3deCameraTransform.GetTranslation();
+
+                const auto& projectMatrix = view->GetViewToClipMatrix();
+                glm::dvec2 viewportSize{ windowSize.m_width, windowSize.m_height };
+                double aspect = viewportSize.x / viewportSize.y;
+                double verticalFov = 2.0 * glm::atan(1.0 / projectMatrix.GetElement(1, 1));
+                double horizontalFov = 2.0 * glm::atan(glm::tan(verticalFov * 0.5) * aspect);
+
+                ViewportCamera camera;
+                camera.m_position = glm::dvec3{ o3deCameraPosition.GetX(), o3deCameraPosition.GetY(), o3deCameraPosition.GetZ() };
+                camera.m_direction = glm::dvec3{ o3deCameraFwd.GetX(), o3deCameraFwd.GetY(), o3deCameraFwd.GetZ() };
+                camera.m_up = glm::dvec3{ o3deCameraUp.GetX(), o3deCameraUp.GetY(), o3deCameraUp.GetZ() };
+                camera.m_viewportSize = viewportSize;
+                camera.m_horizontalFieldOfView = horizontalFov;
+                camera.m_verticalFieldOfView = verticalFov;
+                camera.m_detail = GetViewportDetail(viewportContextPtr->GetId());
+                camera.m_active = defaultViewportId == AzFramework::InvalidViewportId || viewportContextPtr->GetId() == defaultViewportId;
+                cameras.emplace_back(camera);
+            });
+
+        UpdateCameras(AZStd::move(cameras), deltaTime);
+    }
+
+    const std::vector<Cesium3DTilesSelection::ViewState>& ViewStateProvider::GetViewStates(const glm::dmat4& transform)
+    {
+        return FindOrCreateViewStates(transform, ViewKind::Current, 0.0f);
+    }
+
+    const std::vector<Cesium3DTilesSelection::ViewState>& ViewStateProvider::GetPredictedViewStates(
+        const glm::dmat4& transform, float lookAhead)
+    {
+        return FindOrCreateViewStates(transform, ViewKind::Predicted, AZStd::max(lookAhead, 0.0f));
+    }
+
+    void ViewStateProvider::SetViewportDetail(AzFramework::ViewportId viewportId, const ViewportDetailConfiguration& configuration)
+    {
+        m_viewportDetails[viewportId] = configuration;
+    }
+
+    ViewportDetailConfiguration ViewStateProvider::GetViewportDetail(AzFramework::ViewportId viewportId) const
+    {
+        auto viewportDetail = m_viewportDetails.find(viewportId);
+        if (viewportDetail == m_viewportDetails.end())
+        {
+            return ViewportDetailConfiguration{};
+        }
+
+        return viewportDetail->second;
+    }
+
+    void ViewStateProvider::ClearViewportDetail(AzFramework::ViewportId viewportId)
+    {
+        m_viewportDetails.erase(viewportId);
+    }
+
+    void ViewStateProvider::SetViewportGazePoint(AzFramework::ViewportId viewportId, const glm::dvec2& gazePoint)
+    {
+        m_viewportDetails[viewportId].m_gazePoint = gazePoint;
+    }
+
+    void ViewStateProvider::SetViewportEnabled(AzFramework::ViewportId viewportId, bool enabled)
+    {
+        m_viewportDetails[viewportId].m_enabled = enabled;
+    }
+
+    void ViewStateProvider::SetInactiveScreenSpaceErrorMultiplier(double screenSpaceErrorMultiplier)
+    {
+        m_inactiveScreenSpaceErrorMultiplier = AZStd::max(screenSpaceErrorMultiplier, MINIMUM_SCREEN_SPACE_ERROR_MULTIPLIER);
+    }
+
+    void ViewStateProvider::SetInactivePriority(double priority)
+    {
+        m_inactivePriority = AZStd::max(priority, 0.0);
+    }
+
+    void ViewStateProvider::SetDropInactiveViewports(bool dropInactiveViewports)
+    {
+        m_dropInactiveViewports = dropInactiveViewports;
+    }
+
+    const std::vector<Cesium3DTilesSelection::ViewState>& ViewStateProvider::GetFovealViewStates(const glm::dmat4& transform)
+    {
+        return FindOrCreateViewStates(transform, ViewKind::Foveal, 0.0f);
+    }
+
+    std::uint32_t ViewStateProvider::GetViewportDetailVersion()
+    {
+        ReadViewportCameras();
+        return m_viewportDetailVersion;
+    }
+
+    double ViewStateProvider::GetViewPriority(std::size_t viewIndex)
+    {
+        ReadViewportCameras();
+        if (viewIndex >= m_cameras.size())
+        {
+            return 1.0;
+        }
+
+        return AZStd::max(m_cameras[viewIndex].m_detail.m_priority, 0.0);
+    }
+
+    ViewStateProvider::PrefetchViewsId ViewStateProvider::AddPrefetchViews(AZStd::vector<ViewportCamera> ecefCameras)
+    {
+        PrefetchViews& prefetchViews = m_prefetchViews.emplace_back();
+        prefetchViews.m_id = m_nextPrefetchViewsId++;
+        prefetchViews.m_ecefCameras = AZStd::move(ecefCameras);
+        prefetchViews.m_pendingBytes = 0;
+        prefetchViews.m_bytes = 0;
+        prefetchViews.m_pending = true;
+        prefetchViews.m_ready = false;
+        ++m_prefetchViewsVersion;
+        m_transformedViewStates.clear();
+        return prefetchViews.m_id;
+    }
+
+    void ViewStateProvider::RemovePrefetchViews(PrefetchViewsId id)
+    {
+        auto prefetchViews = AZStd::find_if(
+            m_prefetchViews.begin(), m_prefetchViews.end(),
+            [id](const PrefetchViews& views)
+            {
+                return views.m_id == id;
+            });
+        if (prefetchViews != m_prefetchViews.end())
+        {
+            m_prefetchViews.erase(prefetchViews);
+            ++m_prefetchViewsVersion;
+            m_transformedViewStates.clear();
+        }
+    }
+
+    bool ViewStateProvider::IsPrefetchReady(PrefetchViewsId id) const
+    {
+        for (const PrefetchViews& prefetchViews : m_prefetchViews)
+        {
+            if (prefetchViews.m_id == id)
+            {
+                return prefetchViews.m_ready;
+            }
+        }
+
+        return false;
+    }
+
+    const std::vector<Cesium3DTilesSelection::ViewState>& ViewStateProvider::GetPrefetchViewStates(const glm::dmat4& transform)
+    {
+        // the tilesets move with the origin in the middle of the frame, so it's read at every call instead of once in Update()
+        glm::dmat4 absToRelWorld{ 1.0 };
+        OriginShiftRequestBus::BroadcastResult(absToRelWorld, &OriginShiftRequestBus::Events::GetAbsToRelWorld);
+        return FindOrCreateViewStates(transform * absToRelWorld, ViewKind::Prefetch, 0.0f);
+    }
+
+    std::uint32_t ViewStateProvider::GetPrefetchViewsVersion() const
+    {
+        return m_prefetchViewsVersion;
+    }
+
+    void ViewStateProvider::ReportPrefetchPending(std::size_t viewIndex)
+    {
+        if (PrefetchViews* prefetchViews = FindPrefetchViewsOfView(viewIndex))
+        {
+            prefetchViews->m_pending = true;
+        }
+    }
+
+    void ViewStateProvider::ReportPrefetchBytes(std::size_t viewIndex, std::uint64_t bytes)
+    {
+        if (PrefetchViews* prefetchViews = FindPrefetchViewsOfView(viewIndex))
+        {
+            prefetchViews->m_pendingBytes += bytes;
+        }
+    }
+
+    std::uint64_t ViewStateProvider::GetPrefetchBytes(PrefetchViewsId id) const
+    {
+        for (const PrefetchViews& prefetchViews : m_prefetchViews)
+        {
+            if (prefetchViews.m_id == id)
+            {
+                return prefetchViews.m_bytes;
+            }
+        }
+
+        return 0;
+    }
+
+    void ViewStateProvider::CreateViewStates(
+        const AZStd::vector<ViewportCamera>& cameras,
+        const glm::dmat4& transform,
+        std::vector<Cesium3DTilesSelection::ViewState>& viewStates)
+    {
+        viewStates.clear();
+        viewStates.reserve(cameras.size());
+        for (const ViewportCamera& camera : cameras)
+        {
+            // Convert o3de coordinate to cesium coordinate
+            glm::dvec3 position = transform * glm::dvec4{ camera.m_position, 1.0 };
+            glm::dvec3 direction = glm::normalize(glm::dvec3(transform * glm::dvec4{ camera.m_direction, 0.0 }));
+            glm::dvec3 up = glm::normalize(glm::dvec3(transform * glm::dvec4{ camera.m_up, 0.0 }));
+
+            // the screen space error is proportional to the viewport height, so a smaller viewport relaxes it by the same factor.
+            // The frustum only depends on the field of view, so the culling is unchanged
+            glm::dvec2 viewportSize = camera.m_viewportSize / GetScreenSpaceErrorMultiplier(camera.m_detail);
+            viewStates.emplace_back(Cesium3DTilesSelection::ViewState::create(
+                position, direction, up, viewportSize, camera.m_horizontalFieldOfView, camera.m_verticalFieldOfView));
+        }
+    }
+
+    double ViewStateProvider::GetScreenSpaceErrorMultiplier(const ViewportDetailConfiguration& detail)
+    {
+        double multiplier = AZStd::max(detail.m_screenSpaceErrorMultiplier, MINIMUM_SCREEN_SPACE_ERROR_MULTIPLIER);
+        if (detail.m_foveated)
+        {
+            multiplier *= AZStd::max(detail.m_peripheralScreenSpaceErrorMultiplier, 1.0);
+        }
+
+        return multiplier;
+    }
+
+    void ViewStateProvider::UpdateCameras(AZStd::vector<ViewportCamera>&& cameras, float deltaTime)
+    {
+        m_transformedViewStates.clear();
+        ThrottleCameras(cameras);
+
+        bool detailChanged = cameras.size() != m_cameras.size();
+        for (std::size_t i = 0; i < cameras.size() && !detailChanged; ++i)
+        {
+            detailChanged = !IsSameDetail(cameras[i].m_detail, m_cameras[i].m_detail);
+        }
+
+        if (detailChanged)
+        {
+            ++m_viewportDetailVersion;
+        }
+
+        if (deltaTime <= 0.0f || cameras.size() != m_cameras.size())
+        {
+            m_motions.assign(cameras.size(), CameraMotion{});
+            m_cameras = AZStd::move(cameras);
+            return;
+        }
+
+        // the velocities are smoothed, since the frame time and the camera controllers are not perfectly regular
+        for (std::size_t i = 0; i < cameras.size(); ++i)
+        {
+            glm::dvec3 velocity = (cameras[i].m_position - m_cameras[i].m_position) / static_cast<double>(deltaTime);
+            glm::dvec3 directionRate = (cameras[i].m_direction - m_cameras[i].m_direction) / static_cast<double>(deltaTime);
+            CameraMotion& motion = m_motions[i];
+            motion.m_velocity = glm::mix(motion.m_velocity, velocity, VELOCITY_SMOOTHING_FACTOR);
+            motion.m_directionRate = glm::mix(motion.m_directionRate, directionRate, VELOCITY_SMOOTHING_FACTOR);
+        }
+
+        m_cameras = AZStd::move(cameras);
+    }
+
+    void ViewStateProvider::ThrottleCameras(AZStd::vector<ViewportCamera>& cameras) const
+    {
+        auto droppedCameras = AZStd::remove_if(
+            cameras.begin(), cameras.end(),
+            [this](const ViewportCamera& camera)
+            {
+                return !camera.m_detail.m_enabled || (!camera.m_active && m_dropInactiveViewports);
+            });
+        cameras.erase(droppedCameras, cameras.end());
+
+        // the throttle adds to the detail set for the viewport, so it's restored as it was when the viewport becomes active
+        for (ViewportCamera& camera : cameras)
+        {
+            if (!camera.m_active)
+            {
+                camera.m_detail.m_screenSpaceErrorMultiplier *= m_inactiveScreenSpaceErrorMultiplier;
+                camera.m_detail.m_priority *= m_inactivePriority;
+            }
+        }
+    }
+
+    void ViewStateProvider::UpdatePrefetchReadiness()
+    {
+        // the tilesets reported the views still missing tiles during the last frame
+        for (PrefetchViews& prefetchViews : m_prefetchViews)
+        {
+            prefetchViews.m_ready = !prefetchViews.m_pending;
+            prefetchViews.m_pending = false;
+            prefetchViews.m_bytes = prefetchViews.m_pendingBytes;
+            prefetchViews.m_pendingBytes = 0;
+        }
+    }
+
+    ViewStateProvider::PrefetchViews* ViewStateProvider::FindPrefetchViewsOfView(std::size_t& viewIndex)
+    {
+        // the view indices of the tilesets span the views of all the ids in the order they were added
+        for (PrefetchViews& prefetchViews : m_prefetchViews)
+        {
+            if (viewIndex < prefetchViews.m_ecefCameras.size())
+            {
+                return &prefetchViews;
+            }
+
+            viewIndex -= prefetchViews.m_ecefCameras.size();
+        }
+
+        return nullptr;
+    }
+
+    const std::vector<Cesium3DTilesSelection::ViewState>& ViewStateProvider::FindOrCreateViewStates(
+        const glm::dmat4& transform, ViewKind kind, float lookAhead)
+    {
+        ReadViewportCameras();
+        for (const TransformedViewStates& transformedViewStates : m_transformedViewStates)
+        {
+            if (transformedViewStates.m_transform == transform && transformedViewStates.m_kind == kind &&
+                transformedViewStates.m_lookAhead == lookAhead)
+            {
+                return transformedViewStates.m_viewStates;
+            }
+        }
+
+        TransformedViewStates& transformedViewStates = m_transformedViewStates.emplace_back();
+        transformedViewStates.m_transform = transform;
+        transformedViewStates.m_kind = kind;
+        transformedViewStates.m_lookAhead = lookAhead;
+        switch (kind)
+        {
+        case ViewKind::Current:
+            CreateViewStates(m_cameras, transform, transformedViewStates.m_viewStates);
+            break;
+        case ViewKind::Predicted:
+            CreatePredictedCameras(lookAhead);
+            CreateViewStates(m_predictedCameras, transform, transformedViewStates.m_viewStates);
+            break;
+        case ViewKind::Prefetch:
+            CreatePrefetchCameras();
+            CreateViewStates(m_prefetchCameras, transform, transformedViewStates.m_viewStates);
+            break;
+        case ViewKind::Foveal:
+            CreateFovealCameras();
+            CreateViewStates(m_fovealCameras, transform, transformedViewStates.m_viewStates);
+            break;
+        default:
+            break;
+        }
+
+        return transformedViewStates.m_viewStates;
+    }
+
+    void ViewStateProvider::CreatePredictedCameras(float lookAhead)
+    {
+        m_predictedCameras.clear();
+        for (std::size_t i = 0; i < m_cameras.size(); ++i)
+        {
+            const CameraMotion& motion = m_motions[i];
+            if (glm::length(motion.m_velocity) < MINIMUM_SPEED && glm::length(motion.m_directionRate) < MINIMUM_TURN_RATE)
+            {
+                continue;
+            }
+
+            // the heading is extrapolated linearly, and the up vector is kept perpendicular to it
+            ViewportCamera camera = m_cameras[i];
+            camera.m_position += motion.m_velocity * static_cast<double>(lookAhead);
+            glm::dvec3 direction = camera.m_direction + motion.m_directionRate * static_cast<double>(lookAhead);
+            if (glm::length(direction) > 0.0)
+            {
+                camera.m_direction = glm::normalize(direction);
+            }
+
+            glm::dvec3 up = camera.m_up - glm::dot(camera.m_up, camera.m_direction) * camera.m_direction;
+            if (glm::length(up) > 0.0)
+            {
+                camera.m_up = glm::normalize(up);
+            }
+
+            m_predictedCameras.emplace_back(camera);
+        }
+    }
+
+    void ViewStateProvider::CreatePrefetchCameras()
+    {
+        // the view indices reported by the tilesets must match the poses, so a pose is never skipped
+        m_prefetchCameras.clear();
+        for (const PrefetchViews& prefetchViews : m_prefetchViews)
+        {
+            for (ViewportCamera camera : prefetchViews.m_ecefCameras)
+            {
+                if (!m_cameras.empty())
+                {
+                    camera.m_viewportSize = m_cameras.front().m_viewportSize;
+                    camera.m_horizontalFieldOfView = m_cameras.front().m_horizontalFieldOfView;
+                    camera.m_verticalFieldOfView = m_cameras.front().m_verticalFieldOfView;
+                }
+
+                m_prefetchCameras.emplace_back(camera);
+            }
+        }
+    }
+
+    void ViewStateProvider::CreateFovealCameras()
+    {
+        m_fovealCameras.clear();
+        for (const ViewportCamera& camera : m_cameras)
+        {
+            const ViewportDetailConfiguration& detail = camera.m_detail;
+            if (!detail.m_foveated || detail.m_fovealRadius <= 0.0)
+            {
+                continue;
+            }
+
+            // the gaze point is projected on the near plane to turn the views toward it
+            glm::dvec2 gazePoint = glm::clamp(detail.m_gazePoint, glm::dvec2{ -1.0 }, glm::dvec2{ 1.0 });
+            double tanHalfHorizontalFov = glm::tan(camera.m_horizontalFieldOfView * 0.5);
+            double tanHalfVerticalFov = glm::tan(camera.m_verticalFieldOfView * 0.5);
+            glm::dvec3 right = glm::normalize(glm::cross(camera.m_direction, camera.m_up));
+            glm::dvec3 gazeDirection = glm::normalize(
+                camera.m_direction + right * (gazePoint.x * tanHalfHorizontalFov) + camera.m_up * (gazePoint.y * tanHalfVerticalFov));
+            glm::dvec3 gazeUp = glm::normalize(camera.m_up - glm::dot(camera.m_up, gazeDirection) * gazeDirection);
+
+            double multiplier = AZStd::max(detail.m_screenSpaceErrorMultiplier, MINIMUM_SCREEN_SPACE_ERROR_MULTIPLIER);
+            double peripheralMultiplier = AZStd::max(detail.m_peripheralScreenSpaceErrorMultiplier, 1.0);
+            double radius = detail.m_fovealRadius;
+            for (std::size_t i = 0; i < FOVEAL_VIEW_COUNT && radius < 1.0; ++i)
+            {
+                // the view covers the area around the gaze point with the pixels of the whole viewport, so its tiles get the same
+                // screen space error as in the viewport
+                ViewportCamera fovealCamera = camera;
+                fovealCamera.m_direction = gazeDirection;
+                fovealCamera.m_up = gazeUp;
+                fovealCamera.m_viewportSize = camera.m_viewportSize * radius;
+                fovealCamera.m_horizontalFieldOfView = 2.0 * glm::atan(tanHalfHorizontalFov * radius);
+                fovealCamera.m_verticalFieldOfView = 2.0 * glm::atan(tanHalfVerticalFov * radius);
+                fovealCamera.m_detail = ViewportDetailConfiguration{};
+                fovealCamera.m_detail.m_screenSpaceErrorMultiplier =
+                    multiplier * glm::pow(peripheralMultiplier, static_cast<double>(i) / static_cast<double>(FOVEAL_VIEW_COUNT));
+                fovealCamera.m_detail.m_priority = detail.m_priority;
+                m_fovealCameras.emplace_back(fovealCamera);
+                radius *= 2.0;
+            }
+        }
+    }
+
+    bool ViewStateProvider::IsSameDetail(const ViewportDetailConfiguration& lhs, const ViewportDetailConfiguration& rhs)
+    {
+        return lhs.m_enabled == rhs.m_enabled && lhs.m_screenSpaceErrorMultiplier == rhs.m_screenSpaceErrorMultiplier &&
+            lhs.m_priority == rhs.m_priority && lhs.m_foveated == rhs.m_foveated && lhs.m_gazePoint == rhs.m_gazePoint &&
+            lhs.m_fovealRadius == rhs.m_fovealRadius && lhs.m_peripheralScreenSpaceErrorMultiplier == rhs.m_peripheralScreenSpaceErrorMultiplier;
+    }
+} // namespace Cesium
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <Cesium/EBus/ViewportDetailBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzFramework/Viewport/ViewportId.h>
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Cesium
+{
+    // camera of a viewport in engine world coordinates
+    struct ViewportCamera
+    {
+        glm::dvec3 m_position;
+        glm::dvec3 m_direction;
+        glm::dvec3 m_up;
+        glm::dvec2 m_viewportSize;
+        double m_horizontalFieldOfView;
+        double m_verticalFieldOfView;
+        ViewportDetailConfiguration m_detail;
+
+        // false for the viewports in the background, like the secondary viewports of the Editor
+        bool m_active{ true };
+    };
+
+    // Enumerates the viewports once per frame for all the tilesets, when the first of them asks for its view states. The view
+    // states of a tileset only depend on its transform, and tilesets with the same transform, like terrain and the buildings on
+    // it, share them for the rest of the frame.
+    // The motion of each viewport camera is tracked across frames to predict where it will be for tile prefetching.
+    // The screen space error multiplier of a viewport scales down the viewport size of its view states, since the screen space
+    // error of a tile is proportional to the viewport height. A foveated viewport also gets narrow foveal views toward its gaze
+    // point, which keep the finer detail around it while the rest of the viewport uses the peripheral multiplier.
+    // Disabled viewports have no view state. Inactive viewports are throttled with a larger screen space error and a lower
+    // priority, or dropped as well.
+    class ViewStateProvider final
+    {
+    public:
+        using PrefetchViewsId = std::uint32_t;
+
+        ViewStateProvider();
+
+        // apply the prefetch readiness reported by the tilesets since the last call. Called once per frame
+        void Update();
+
+        // the camera motion is only estimated when deltaTime is positive and the number of cameras did not change
+        void SetCameras(AZStd::vector<ViewportCamera> cameras, float deltaTime = 0.0f);
+
+        const AZStd::vector<ViewportCamera>& GetCameras();
+
+        // the cameras converted by the transform. The returned reference stays valid until the next tick or SetCameras()
+        const std::vector<Cesium3DTilesSelection::ViewState>& GetViewStates(const glm::dmat4& transform);
+
+        // the moving cameras extrapolated lookAhead seconds ahead. Cameras that do not move have no predicted view state
+        const std::vector<Cesium3DTilesSelection::ViewState>& GetPredictedViewStates(const glm::dmat4& transform, float lookAhead);
+
+        // the level of detail of the viewport, applied to its camera from the next tick
+        void SetViewportDetail(AzFramework::ViewportId viewportId, const ViewportDetailConfiguration& configuration);
+
+        ViewportDetailConfiguration GetViewportDetail(AzFramework::ViewportId viewportId) const;
+
+        void ClearViewportDetail(AzFramework::ViewportId viewportId);
+
+        void SetViewportGazePoint(AzFramework::ViewportId viewportId, const glm::dvec2& gazePoint);
+
+        void SetViewportEnabled(AzFramework::ViewportId viewportId, bool enabled);
+
+        // multiplies the screen space error multiplier of the inactive viewports, applied from the next tick
+        void SetInactiveScreenSpaceErrorMultiplier(double screenSpaceErrorMultiplier);
+
+        // multiplies the priority of the inactive viewports, applied from the next tick
+        void SetInactivePriority(double priority);
+
+        void SetDropInactiveViewports(bool dropInactiveViewports);
+
+        // the views around the gaze point of the foveated cameras, selected along with the current view states. The returned
+        // reference stays valid until the next tick or SetCameras()
+        const std::vector<Cesium3DTilesSelection::ViewState>& GetFovealViewStates(const glm::dmat4& transform);
+
+        // incremented every time the detail of a camera changes, so the tilesets know when the foveal views moved
+        std::uint32_t GetViewportDetailVersion();
+
+        // the priority of the camera of the current view state at viewIndex
+        double GetViewPriority(std::size_t viewIndex);
+
+        // Camera poses in ECEF that the tilesets load ahead of time, like the destination of a camera fly. The ECEF positions stay
+        // valid when the origin shifts. The poses take the viewport size and field of view of the first viewport if there is one
+        PrefetchViewsId AddPrefetchViews(AZStd::vector<ViewportCamera> ecefCameras);
+
+        void RemovePrefetchViews(PrefetchViewsId id);
+
+        // true when every tileset rendered the tiles of the views at their full detail last frame
+        bool IsPrefetchReady(PrefetchViewsId id) const;
+
+        // the prefetch views of all the ids in tileset coordinates. The returned reference stays valid until the next tick
+        const std::vector<Cesium3DTilesSelection::ViewState>& GetPrefetchViewStates(const glm::dmat4& transform);
+
+        // incremented every time the prefetch views are added or removed, so the tilesets know when the view indices change
+        std::uint32_t GetPrefetchViewsVersion() const;
+
+        // called by the tilesets that still miss tiles for the prefetch view at viewIndex
+        void ReportPrefetchPending(std::size_t viewIndex);
+
+        // called by the tilesets with the bytes of the tiles they render for the prefetch view at viewIndex
+        void ReportPrefetchBytes(std::size_t viewIndex, std::uint64_t bytes);
+
+        // the bytes reported by all the tilesets for the views last frame
+        std::uint64_t GetPrefetchBytes(PrefetchViewsId id) const;
+
+        static void CreateViewStates(
+            const AZStd::vector<ViewportCamera>& cameras,
+            const glm::dmat4& transform,
+            std::vector<Cesium3DTilesSelection::ViewState>& viewStates);
+
+        // the screen space error of the camera over the whole viewport, before the foveal views
+        static double GetScreenSpaceErrorMultiplier(const ViewportDetailConfiguration& detail);
+
+        static constexpr double VELOCITY_SMOOTHING_FACTOR = 0.3;
+
+        // foveal views per foveated camera. Each one doubles the radius of the previous one, and its multiplier is a step from
+        // the full detail toward the peripheral multiplier
+        static constexpr std::size_t FOVEAL_VIEW_COUNT = 2;
+
+        static constexpr double MINIMUM_SCREEN_SPACE_ERROR_MULTIPLIER = 0.1;
+
+        static constexpr double DEFAULT_INACTIVE_SCREEN_SPACE_ERROR_MULTIPLIER = 4.0;
+        static constexpr double DEFAULT_INACTIVE_PRIORITY = 0.25;
+
+        // in meters per second and radians per second. Slower cameras are considered parked
+        static constexpr double MINIMUM_SPEED = 0.01;
+        static constexpr double MINIMUM_TURN_RATE = 0.001;
+
+    private:
+        struct CameraMotion
+        {
+            glm::dvec3 m_velocity{ 0.0 };
+            glm::dvec3 m_directionRate{ 0.0 };
+        };
+
+        enum class ViewKind
+        {
+            Current,
+            Predicted,
+            Prefetch,
+            Foveal
+        };
+
+        struct TransformedViewStates
+        {
+            glm::dmat4 m_transform;
+            ViewKind m_kind;
+            float m_lookAhead;
+            std::vector<Cesium3DTilesSelection::ViewState> m_viewStates;
+        };
+
+        struct PrefetchViews
+        {
+            PrefetchViewsId m_id;
+            AZStd::vector<ViewportCamera> m_ecefCameras;
+            std::uint64_t m_pendingBytes;
+            std::uint64_t m_bytes;
+            bool m_pending;
+            bool m_ready;
+        };
+
+        // read the cameras of the viewports if they were not read yet during the current tick
+        void ReadViewportCameras();
+
+        void UpdateCameras(AZStd::vector<ViewportCamera>&& cameras, float deltaTime);
+
+        // remove the disabled cameras and throttle the inactive ones
+        void ThrottleCameras(AZStd::vector<ViewportCamera>& cameras) const;
+
+        void UpdatePrefetchReadiness();
+
+        PrefetchViews* FindPrefetchViewsOfView(std::size_t& viewIndex);
+
+        const std::vector<Cesium3DTilesSelection::ViewState>& FindOrCreateViewStates(
+            const glm::dmat4& transform, ViewKind kind, float lookAhead);
+
+        void CreatePredictedCameras(float lookAhead);
+
+        void CreatePrefetchCameras();
+
+        void CreateFovealCameras();
+
+        static bool IsSameDetail(const ViewportDetailConfiguration& lhs, const ViewportDetailConfiguration& rhs);
+
+        AZStd::vector<ViewportCamera> m_cameras;
+        AZStd::vector<CameraMotion> m_motions;
+        AZStd::vector<ViewportCamera> m_predictedCameras;
+        AZStd::vector<ViewportCamera> m_prefetchCameras;
+        AZStd::vector<ViewportCamera> m_fovealCameras;
+        AZStd::unordered_map<AzFramework::ViewportId, ViewportDetailConfiguration> m_viewportDetails;
+        AZStd::vector<PrefetchViews> m_prefetchViews;
+        PrefetchViewsId m_nextPrefetchViewsId;
+        std::uint32_t m_prefetchViewsVersion;
+        std::uint32_t m_viewportDetailVersion;
+        double m_inactiveScreenSpaceErrorMultiplier;
+        double m_inactivePriority;
+        bool m_dropInactiveViewports;
+        AZStd::optional<AZStd::chrono::system_clock::time_point> m_lastTickTime;
+
+        // a deque, so the references returned to the tilesets stay valid when another transform is added
+        AZStd::deque<TransformedViewStates> m_transformedViewStates;
+    };
+} // namespace Cesium
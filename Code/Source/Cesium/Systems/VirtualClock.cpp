@@ -0,0 +1,43 @@
+#include "Cesium/Systems/VirtualClock.h"
+
+namespace Cesium
+{
+    VirtualClock::VirtualClock()
+        : m_fixedDeltaTime{ DEFAULT_FIXED_DELTA_TIME }
+        , m_elapsedTime{ 0.0 }
+        , m_enabled{ false }
+    {
+    }
+
+    void VirtualClock::Enable(float fixedDeltaTime)
+    {
+        m_fixedDeltaTime = fixedDeltaTime > 0.0f ? fixedDeltaTime : DEFAULT_FIXED_DELTA_TIME;
+        m_elapsedTime = 0.0;
+        m_enabled = true;
+    }
+
+    void VirtualClock::Disable()
+    {
+        m_enabled = false;
+    }
+
+    bool VirtualClock::IsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    float VirtualClock::GetDeltaTime(float realDeltaTime) const
+    {
+        return m_enabled ? m_fixedDeltaTime : realDeltaTime;
+    }
+
+    void VirtualClock::Advance(float realDeltaTime)
+    {
+        m_elapsedTime += static_cast<double>(GetDeltaTime(realDeltaTime));
+    }
+
+    double VirtualClock::GetElapsedTime() const
+    {
+        return m_elapsedTime;
+    }
+} // namespace Cesium
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace Cesium
+{
+    // Replaces the frame delta time with a fixed step when enabled, so camera paths driven by
+    // GeoReferenceInterpolator advance by the same amount every frame regardless of the real frame time.
+    class VirtualClock final
+    {
+    public:
+        VirtualClock();
+
+        void Enable(float fixedDeltaTime = DEFAULT_FIXED_DELTA_TIME);
+
+        void Disable();
+
+        bool IsEnabled() const;
+
+        float GetDeltaTime(float realDeltaTime) const;
+
+        void Advance(float realDeltaTime);
+
+        double GetElapsedTime() const;
+
+        static constexpr float DEFAULT_FIXED_DELTA_TIME = 1.0f / 60.0f;
+
+    private:
+        float m_fixedDeltaTime;
+        double m_elapsedTime;
+        bool m_enabled;
+    };
+} // namespace Cesium
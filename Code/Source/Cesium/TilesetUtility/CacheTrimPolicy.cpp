@@ -0,0 +1,66 @@
+#include "Cesium/TilesetUtility/CacheTrimPolicy.h"
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+
+namespace Cesium
+{
+    CacheTrimPolicy::CacheTrimPolicy()
+        : m_gracePeriod{ 0.0f }
+        , m_trimDuration{ 0.0f }
+        , m_hiddenTime{ 0.0f }
+    {
+    }
+
+    void CacheTrimPolicy::Configure(float gracePeriod, float trimDuration)
+    {
+        m_gracePeriod = AZStd::max(gracePeriod, 0.0f);
+        m_trimDuration = AZStd::max(trimDuration, 0.0f);
+    }
+
+    void CacheTrimPolicy::Reset()
+    {
+        m_hiddenTime = 0.0f;
+    }
+
+    std::uint64_t CacheTrimPolicy::Update(bool visible, float deltaTime, MemoryPressure pressure, std::uint64_t cacheBytes)
+    {
+        if (visible)
+        {
+            m_hiddenTime = 0.0f;
+            return cacheBytes;
+        }
+
+        m_hiddenTime += AZStd::max(deltaTime, 0.0f);
+
+        float gracePeriod = m_gracePeriod;
+        if (pressure == MemoryPressure::High)
+        {
+            gracePeriod *= HIGH_PRESSURE_GRACE_FACTOR;
+        }
+        else if (pressure == MemoryPressure::Critical)
+        {
+            gracePeriod = 0.0f;
+        }
+
+        float trimTime = m_hiddenTime - gracePeriod;
+        if (trimTime <= 0.0f)
+        {
+            return cacheBytes;
+        }
+
+        if (trimTime >= m_trimDuration)
+        {
+            return 0;
+        }
+
+        // the limit only changes a few times, since every change makes the tileset run a full traversal
+        float keptFraction = 1.0f - trimTime / m_trimDuration;
+        float keptSteps = std::floor(keptFraction * static_cast<float>(TRIM_STEPS));
+        return static_cast<std::uint64_t>(static_cast<double>(cacheBytes) * keptSteps / static_cast<double>(TRIM_STEPS));
+    }
+
+    float CacheTrimPolicy::GetHiddenTime() const
+    {
+        return m_hiddenTime;
+    }
+} // namespace Cesium
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Cesium/EBus/MemoryBudgetBus.h>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Decides how much cache a tileset keeps while it is off screen. Nothing is evicted during a grace period, so looking away and
+    // back does not reload the tileset. After it, the cache shrinks in steps until it is empty at the end of the trim duration.
+    // Memory pressure shortens the grace period, and critical pressure starts trimming right away.
+    class CacheTrimPolicy final
+    {
+    public:
+        CacheTrimPolicy();
+
+        // times are in seconds
+        void Configure(float gracePeriod, float trimDuration);
+
+        void Reset();
+
+        // return the cache limit for the next frame
+        std::uint64_t Update(bool visible, float deltaTime, MemoryPressure pressure, std::uint64_t cacheBytes);
+
+        float GetHiddenTime() const;
+
+        static constexpr std::uint32_t TRIM_STEPS = 8;
+        static constexpr float HIGH_PRESSURE_GRACE_FACTOR = 0.5f;
+
+    private:
+        float m_gracePeriod;
+        float m_trimDuration;
+        float m_hiddenTime;
+    };
+} // namespace Cesium
@@ -0,0 +1,119 @@
+#include "Cesium/TilesetUtility/LoadConcurrencyController.h"
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+
+namespace Cesium
+{
+    LoadConcurrencyController::LoadConcurrencyController()
+        : m_minimumLoads{ 1 }
+        , m_maximumLoads{ 1 }
+        , m_limit{ 1 }
+        , m_baselineLatency{ 0.0 }
+        , m_lastThroughput{ 0.0 }
+        , m_windowTime{ 0.0 }
+        , m_windowLatency{ 0.0 }
+        , m_windowMinimumLatency{ 0.0 }
+        , m_windowBytes{ 0 }
+        , m_windowResponses{ 0 }
+        , m_windowFailures{ 0 }
+        , m_windowPeakLoadsInFlight{ 0 }
+    {
+    }
+
+    void LoadConcurrencyController::Configure(std::uint32_t minimumLoads, std::uint32_t maximumLoads)
+    {
+        m_minimumLoads = AZStd::max(AZStd::min(minimumLoads, maximumLoads), 1u);
+        m_maximumLoads = AZStd::max(AZStd::max(minimumLoads, maximumLoads), 1u);
+        m_limit = AZStd::clamp(m_limit, m_minimumLoads, m_maximumLoads);
+    }
+
+    void LoadConcurrencyController::Reset(std::uint32_t loads)
+    {
+        m_limit = AZStd::clamp(loads, m_minimumLoads, m_maximumLoads);
+        m_baselineLatency = 0.0;
+        m_lastThroughput = 0.0;
+        m_windowTime = 0.0;
+        m_windowLatency = 0.0;
+        m_windowMinimumLatency = 0.0;
+        m_windowBytes = 0;
+        m_windowResponses = 0;
+        m_windowFailures = 0;
+        m_windowPeakLoadsInFlight = 0;
+    }
+
+    void LoadConcurrencyController::RecordResponse(double latency, std::uint64_t bytes, bool failed)
+    {
+        latency = AZStd::max(latency, 0.0);
+        m_windowMinimumLatency = m_windowResponses > 0 ? AZStd::min(m_windowMinimumLatency, latency) : latency;
+        m_windowLatency += latency;
+        m_windowBytes += bytes;
+        ++m_windowResponses;
+        m_windowFailures += failed ? 1 : 0;
+    }
+
+    std::uint32_t LoadConcurrencyController::Update(double elapsedTime, std::uint32_t peakLoadsInFlight)
+    {
+        m_windowTime += AZStd::max(elapsedTime, 0.0);
+        m_windowPeakLoadsInFlight = AZStd::max(m_windowPeakLoadsInFlight, peakLoadsInFlight);
+        if (m_windowResponses >= AZStd::max(m_limit, MINIMUM_WINDOW_RESPONSES) ||
+            (m_windowResponses > 0 && m_windowTime >= MAXIMUM_WINDOW_TIME))
+        {
+            CloseWindow();
+        }
+        else if (m_windowResponses == 0 && m_windowTime >= MAXIMUM_WINDOW_TIME)
+        {
+            // nothing was loaded, which says nothing about the link
+            m_windowTime = 0.0;
+            m_windowPeakLoadsInFlight = 0;
+        }
+
+        return m_limit;
+    }
+
+    std::uint32_t LoadConcurrencyController::GetLimit() const
+    {
+        return m_limit;
+    }
+
+    void LoadConcurrencyController::CloseWindow()
+    {
+        if (m_windowFailures > 0)
+        {
+            SetLimit(static_cast<double>(m_limit) * MULTIPLICATIVE_DECREASE);
+        }
+        else
+        {
+            // the fastest responses, like the tileset json requested alone, are the closest to the latency of an idle link
+            m_baselineLatency = m_baselineLatency > 0.0
+                ? AZStd::min(m_baselineLatency * std::pow(BASELINE_DRIFT, m_windowTime), m_windowMinimumLatency)
+                : m_windowMinimumLatency;
+            double latency = m_windowLatency / static_cast<double>(m_windowResponses);
+            double throughput = m_windowTime > 0.0 ? static_cast<double>(m_windowBytes) / m_windowTime : m_lastThroughput;
+            bool queued = latency > m_baselineLatency * LATENCY_TOLERANCE && throughput < m_lastThroughput * THROUGHPUT_GAIN;
+            if (queued)
+            {
+                SetLimit(static_cast<double>(m_limit) * MULTIPLICATIVE_DECREASE);
+            }
+            else if (m_windowPeakLoadsInFlight >= m_limit)
+            {
+                // the limit only grows when it is what holds the loads back
+                SetLimit(static_cast<double>(m_limit + ADDITIVE_INCREASE));
+            }
+
+            m_lastThroughput = throughput;
+        }
+
+        m_windowTime = 0.0;
+        m_windowLatency = 0.0;
+        m_windowMinimumLatency = 0.0;
+        m_windowBytes = 0;
+        m_windowResponses = 0;
+        m_windowFailures = 0;
+        m_windowPeakLoadsInFlight = 0;
+    }
+
+    void LoadConcurrencyController::SetLimit(double limit)
+    {
+        m_limit = AZStd::clamp(static_cast<std::uint32_t>(limit), m_minimumLoads, m_maximumLoads);
+    }
+} // namespace Cesium
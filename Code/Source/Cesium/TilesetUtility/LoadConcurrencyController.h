@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Cesium
+{
+    // Adapts the number of simultaneous tile loads to the link, with additive increase and multiplicative decrease. The responses
+    // are grouped in windows of about one limit worth of responses. A window that saturated the limit without raising the latency
+    // much over the lowest one seen adds a load. A window with failed requests, or whose latency grew without any gain of
+    // throughput, means the loads only wait in queues, so the limit is halved.
+    class LoadConcurrencyController final
+    {
+    public:
+        LoadConcurrencyController();
+
+        void Configure(std::uint32_t minimumLoads, std::uint32_t maximumLoads);
+
+        void Reset(std::uint32_t loads);
+
+        // latency in seconds. A failed request is one without response, throttled by the server or with a server error
+        void RecordResponse(double latency, std::uint64_t bytes, bool failed);
+
+        // the time since the last update in seconds, and the most requests in flight during that time. Return the limit to use
+        std::uint32_t Update(double elapsedTime, std::uint32_t peakLoadsInFlight);
+
+        std::uint32_t GetLimit() const;
+
+        static constexpr std::uint32_t ADDITIVE_INCREASE = 1;
+        static constexpr double MULTIPLICATIVE_DECREASE = 0.5;
+        static constexpr double LATENCY_TOLERANCE = 1.5;
+        static constexpr double THROUGHPUT_GAIN = 1.05;
+        // per second, so a route that became slower for good is accepted after a while
+        static constexpr double BASELINE_DRIFT = 1.01;
+        static constexpr std::uint32_t MINIMUM_WINDOW_RESPONSES = 4;
+        static constexpr double MAXIMUM_WINDOW_TIME = 2.0;
+
+    private:
+        void CloseWindow();
+
+        void SetLimit(double limit);
+
+        std::uint32_t m_minimumLoads;
+        std::uint32_t m_maximumLoads;
+        std::uint32_t m_limit;
+        double m_baselineLatency;
+        double m_lastThroughput;
+        double m_windowTime;
+        double m_windowLatency;
+        double m_windowMinimumLatency;
+        std::uint64_t m_windowBytes;
+        std::uint32_t m_windowResponses;
+        std::uint32_t m_windowFailures;
+        std::uint32_t m_windowPeakLoadsInFlight;
+    };
+} // namespace Cesium
@@ -0,0 +1,95 @@
+#include "Cesium/TilesetUtility/LoadPipelineThrottle.h"
+#include <AzCore/std/algorithm.h>
+
+namespace Cesium
+{
+    LoadPipelineThrottle::LoadPipelineThrottle()
+        : m_maximumPreparedTiles{ 0 }
+        , m_maximumPreparedBytes{ 0 }
+        , m_framesWithoutRelease{ 0 }
+        , m_released{ false }
+    {
+    }
+
+    void LoadPipelineThrottle::SetLimits(std::uint32_t maximumPreparedTiles, std::uint64_t maximumPreparedBytes)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_maximumPreparedTiles = maximumPreparedTiles;
+        m_maximumPreparedBytes = maximumPreparedBytes;
+    }
+
+    void LoadPipelineThrottle::Update()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_released || m_metrics.m_pipelineDepth == m_metrics.m_strandedTiles)
+        {
+            m_framesWithoutRelease = 0;
+        }
+        else if (++m_framesWithoutRelease >= STRANDED_FRAME_COUNT)
+        {
+            m_metrics.m_strandedTiles = m_metrics.m_pipelineDepth;
+            m_framesWithoutRelease = 0;
+        }
+
+        m_released = false;
+    }
+
+    std::uint32_t LoadPipelineThrottle::LimitLoads(std::uint32_t loads)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        std::uint32_t limitedLoads = loads;
+        if (m_maximumPreparedTiles != 0)
+        {
+            std::uint32_t preparedTiles = m_metrics.m_pipelineDepth - m_metrics.m_strandedTiles;
+            std::uint32_t room = m_maximumPreparedTiles - AZStd::min(preparedTiles, m_maximumPreparedTiles);
+            limitedLoads = AZStd::min(limitedLoads, room);
+        }
+
+        if (m_maximumPreparedBytes != 0 && m_metrics.m_bytesInFlight >= m_maximumPreparedBytes)
+        {
+            limitedLoads = 0;
+        }
+
+        if (limitedLoads < loads)
+        {
+            ++m_metrics.m_throttledLoads;
+        }
+
+        return limitedLoads;
+    }
+
+    void LoadPipelineThrottle::Acquire()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        ++m_metrics.m_pipelineDepth;
+        m_metrics.m_peakPipelineDepth = AZStd::max(m_metrics.m_peakPipelineDepth, m_metrics.m_pipelineDepth);
+    }
+
+    void LoadPipelineThrottle::Commit(std::uint64_t bytes)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_metrics.m_bytesInFlight += bytes;
+        m_metrics.m_peakBytesInFlight = AZStd::max(m_metrics.m_peakBytesInFlight, m_metrics.m_bytesInFlight);
+    }
+
+    void LoadPipelineThrottle::Release(std::uint64_t bytes)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_metrics.m_pipelineDepth > 0)
+        {
+            --m_metrics.m_pipelineDepth;
+        }
+
+        // the released tile may be a stranded one, freed by the cache
+        m_metrics.m_strandedTiles = AZStd::min(m_metrics.m_strandedTiles, m_metrics.m_pipelineDepth);
+        m_released = true;
+
+        m_metrics.m_bytesInFlight -= AZStd::min(bytes, m_metrics.m_bytesInFlight);
+    }
+
+    TilesetLoadPipelineMetrics LoadPipelineThrottle::GetMetrics() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_metrics;
+    }
+} // namespace Cesium
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Cesium/EBus/TilesetComponentBus.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <cstdint>
+
+namespace Cesium
+{
+    // Bounds the number of tiles and bytes that are prepared in the load threads but not yet consumed by the main thread.
+    // Load threads never wait on it, since they are shared with the other tilesets. Instead, the main thread starts no more
+    // loads than the room left in the pipeline. Cesium native counts a tile as loading until its load thread work is done, so
+    // the tiles loading and the tiles prepared never exceed the tile limit. The byte limit is only known once the tiles are
+    // built, so the loads in flight can overshoot it once before new loads are held back.
+    // A prepared tile is only consumed when the traversal visits it again. The tiles left behind by a camera that moved away are
+    // counted as stranded once no tile was consumed for a while: they are freed by the cache and don't hold back the loads.
+    class LoadPipelineThrottle final
+    {
+    public:
+        LoadPipelineThrottle();
+
+        void SetLimits(std::uint32_t maximumPreparedTiles, std::uint64_t maximumPreparedBytes);
+
+        // called by the main thread once per frame, after the traversal consumed the prepared tiles
+        void Update();
+
+        // the simultaneous tile loads the tileset can start without overflowing the pipeline
+        std::uint32_t LimitLoads(std::uint32_t loads);
+
+        void Acquire();
+
+        void Commit(std::uint64_t bytes);
+
+        void Release(std::uint64_t bytes);
+
+        TilesetLoadPipelineMetrics GetMetrics() const;
+
+        static constexpr std::uint32_t STRANDED_FRAME_COUNT = 30;
+
+    private:
+        mutable AZStd::mutex m_mutex;
+        TilesetLoadPipelineMetrics m_metrics;
+        std::uint32_t m_maximumPreparedTiles;
+        std::uint64_t m_maximumPreparedBytes;
+        std::uint32_t m_framesWithoutRelease;
+        bool m_released;
+    };
+} // namespace Cesium
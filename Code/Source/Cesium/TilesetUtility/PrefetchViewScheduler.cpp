@@ -0,0 +1,188 @@
+#include "Cesium/TilesetUtility/PrefetchViewScheduler.h"
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+
+// Window 10 wingdi.h header defines OPAQUE macro which mess up with CesiumGltf::Material::AlphaMode::OPAQUE.
+// This only happens with unity build
+#include <AzCore/PlatformDef.h>
+#ifdef AZ_COMPILER_MSVC
+#pragma push_macro("OPAQUE")
+#undef OPAQUE
+#endif
+
+#include <Cesium3DTilesSelection/Tile.h>
+
+#ifdef AZ_COMPILER_MSVC
+#pragma pop_macro("OPAQUE")
+#endif
+
+namespace Cesium
+{
+    PrefetchViewScheduler::PrefetchViewScheduler()
+        : m_exclusiveBytes{ 0 }
+        , m_viewsVersion{ 0 }
+        , m_frameIndex{ 0 }
+        , m_currentViewsLoading{ true }
+    {
+    }
+
+    void PrefetchViewScheduler::Reset()
+    {
+        m_viewsReady.assign(m_viewsReady.size(), false);
+        m_viewBytes.assign(m_viewBytes.size(), 0);
+        m_exclusiveBytes = 0;
+        m_frameIndex = 0;
+        m_currentViewsLoading = true;
+    }
+
+    void PrefetchViewScheduler::SyncViews(std::uint32_t viewsVersion, std::size_t viewCount)
+    {
+        if (m_viewsVersion != viewsVersion || m_viewsReady.size() != viewCount)
+        {
+            m_viewsVersion = viewsVersion;
+            m_viewsReady.assign(viewCount, false);
+            m_viewBytes.assign(viewCount, 0);
+            m_exclusiveBytes = 0;
+        }
+    }
+
+    bool PrefetchViewScheduler::ShouldSelectPrefetchViews()
+    {
+        bool intervalFrame = m_frameIndex % SELECTION_INTERVAL == 0;
+        ++m_frameIndex;
+        return m_currentViewsLoading ? intervalFrame : !intervalFrame;
+    }
+
+    void PrefetchViewScheduler::RecordFrame(bool selectedPrefetchViews, bool hasPendingLoads)
+    {
+        // the loads of the frames with the prefetch views are not only for the current views
+        if (!selectedPrefetchViews)
+        {
+            m_currentViewsLoading = hasPendingLoads;
+        }
+    }
+
+    void PrefetchViewScheduler::UpdateReadiness(
+        const std::vector<Cesium3DTilesSelection::ViewState>& prefetchViewStates,
+        const std::vector<Cesium3DTilesSelection::ViewState>& currentViewStates,
+        const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+        const Cesium3DTilesSelection::Tile* rootTile,
+        double maximumScreenSpaceError)
+    {
+        m_viewsReady.resize(prefetchViewStates.size(), false);
+        for (std::size_t i = 0; i < prefetchViewStates.size(); ++i)
+        {
+            m_viewsReady[i] = rootTile && AreTilesReady(prefetchViewStates[i], renderedTiles, *rootTile, maximumScreenSpaceError);
+        }
+
+        ComputeExclusiveBytes(prefetchViewStates, currentViewStates, renderedTiles);
+    }
+
+    bool PrefetchViewScheduler::IsViewReady(std::size_t viewIndex) const
+    {
+        return viewIndex < m_viewsReady.size() && m_viewsReady[viewIndex];
+    }
+
+    bool PrefetchViewScheduler::AreViewsReady() const
+    {
+        return AZStd::all_of(
+            m_viewsReady.begin(), m_viewsReady.end(),
+            [](bool ready)
+            {
+                return ready;
+            });
+    }
+
+    std::uint64_t PrefetchViewScheduler::GetViewBytes(std::size_t viewIndex) const
+    {
+        return viewIndex < m_viewBytes.size() ? m_viewBytes[viewIndex] : 0;
+    }
+
+    std::uint64_t PrefetchViewScheduler::GetExclusiveBytes() const
+    {
+        return m_exclusiveBytes;
+    }
+
+    bool PrefetchViewScheduler::AreTilesReady(
+        const Cesium3DTilesSelection::ViewState& viewState,
+        const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+        const Cesium3DTilesSelection::Tile& rootTile,
+        double maximumScreenSpaceError)
+    {
+        if (!viewState.isBoundingVolumeVisible(rootTile.getBoundingVolume()))
+        {
+            return true;
+        }
+
+        if (rootTile.getState() != Cesium3DTilesSelection::Tile::LoadState::Done)
+        {
+            return false;
+        }
+
+        // a tile rendered in the view while it should be refined means that its children are still loading
+        for (const Cesium3DTilesSelection::Tile* tile : renderedTiles)
+        {
+            if (!viewState.isBoundingVolumeVisible(tile->getBoundingVolume()))
+            {
+                continue;
+            }
+
+            if (tile->getState() != Cesium3DTilesSelection::Tile::LoadState::Done)
+            {
+                return false;
+            }
+
+            if (!tile->getChildren().empty())
+            {
+                double distance = std::sqrt(viewState.computeDistanceSquaredToBoundingVolume(tile->getBoundingVolume()));
+                if (viewState.computeScreenSpaceError(tile->getGeometricError(), distance) > maximumScreenSpaceError)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool PrefetchViewScheduler::IsVisibleInAny(
+        const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, const Cesium3DTilesSelection::Tile& tile)
+    {
+        return AZStd::any_of(
+            viewStates.begin(), viewStates.end(),
+            [&tile](const Cesium3DTilesSelection::ViewState& viewState)
+            {
+                return viewState.isBoundingVolumeVisible(tile.getBoundingVolume());
+            });
+    }
+
+    void PrefetchViewScheduler::ComputeExclusiveBytes(
+        const std::vector<Cesium3DTilesSelection::ViewState>& prefetchViewStates,
+        const std::vector<Cesium3DTilesSelection::ViewState>& currentViewStates,
+        const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles)
+    {
+        // the tiles visible in a current view are kept for it anyway, so they don't count for the prefetch views
+        m_viewBytes.assign(prefetchViewStates.size(), 0);
+        m_exclusiveBytes = 0;
+        for (const Cesium3DTilesSelection::Tile* tile : renderedTiles)
+        {
+            if (IsVisibleInAny(currentViewStates, *tile))
+            {
+                continue;
+            }
+
+            std::uint64_t tileBytes = static_cast<std::uint64_t>(AZStd::max(tile->computeByteSize(), std::int64_t{ 0 }));
+            bool visible = false;
+            for (std::size_t i = 0; i < prefetchViewStates.size(); ++i)
+            {
+                if (prefetchViewStates[i].isBoundingVolumeVisible(tile->getBoundingVolume()))
+                {
+                    m_viewBytes[i] += tileBytes;
+                    visible = true;
+                }
+            }
+
+            m_exclusiveBytes += visible ? tileBytes : 0;
+        }
+    }
+} // namespace Cesium
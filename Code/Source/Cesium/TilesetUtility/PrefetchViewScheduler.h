@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Cesium3DTilesSelection
+{
+    class Tile;
+}
+
+namespace Cesium
+{
+    // Decides when a tileset selects the prefetch views, like the destination of a camera fly, with its current views. Cesium native
+    // loads the tiles of all the views with the same priority, so the prefetch views only get one frame out of SELECTION_INTERVAL
+    // while the current views are loading, and all but one when they are not. The frames without them measure the current loads
+    // and decide which tiles are rendered, so the prefetch views only drive loads and never change the rendered tiles.
+    // It also tracks which prefetch views have all their tiles rendered at full detail, and how many bytes their tiles hold on top of
+    // the tiles of the current views.
+    class PrefetchViewScheduler final
+    {
+    public:
+        PrefetchViewScheduler();
+
+        void Reset();
+
+        // forget the readiness of the views when they were added or removed
+        void SyncViews(std::uint32_t viewsVersion, std::size_t viewCount);
+
+        bool ShouldSelectPrefetchViews();
+
+        void RecordFrame(bool selectedPrefetchViews, bool hasPendingLoads);
+
+        // called on the frames that selected the prefetch views
+        void UpdateReadiness(
+            const std::vector<Cesium3DTilesSelection::ViewState>& prefetchViewStates,
+            const std::vector<Cesium3DTilesSelection::ViewState>& currentViewStates,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+            const Cesium3DTilesSelection::Tile* rootTile,
+            double maximumScreenSpaceError);
+
+        bool IsViewReady(std::size_t viewIndex) const;
+
+        bool AreViewsReady() const;
+
+        // the bytes of the rendered tiles visible in the view and in none of the current views
+        std::uint64_t GetViewBytes(std::size_t viewIndex) const;
+
+        // the bytes of the rendered tiles visible in any of the prefetch views and in none of the current views. A tile shared by
+        // several prefetch views is counted once
+        std::uint64_t GetExclusiveBytes() const;
+
+        static constexpr std::uint32_t SELECTION_INTERVAL = 4;
+
+    private:
+        static bool AreTilesReady(
+            const Cesium3DTilesSelection::ViewState& viewState,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+            const Cesium3DTilesSelection::Tile& rootTile,
+            double maximumScreenSpaceError);
+
+        static bool IsVisibleInAny(
+            const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, const Cesium3DTilesSelection::Tile& tile);
+
+        void ComputeExclusiveBytes(
+            const std::vector<Cesium3DTilesSelection::ViewState>& prefetchViewStates,
+            const std::vector<Cesium3DTilesSelection::ViewState>& currentViewStates,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles);
+
+        std::vector<bool> m_viewsReady;
+        std::vector<std::uint64_t> m_viewBytes;
+        std::uint64_t m_exclusiveBytes;
+        std::uint32_t m_viewsVersion;
+        std::uint32_t m_frameIndex;
+        bool m_currentViewsLoading;
+    };
+} // namespace Cesium
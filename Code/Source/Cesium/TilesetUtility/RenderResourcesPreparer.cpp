@@ -2,6 +2,7 @@
 #include "Cesium/TilesetUtility/GltfRasterMaterialBuilder.h"
 #include "Cesium/Gltf/GltfModelBuilder.h"
 #include "Cesium/Gltf/GltfLoadContext.h"
+#include "Cesium/Systems/TraceRecorder.h"
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h>
@@ -19,6 +20,7 @@
 
 #include <Cesium3DTilesSelection/Tile.h>
 #include <Cesium3DTilesSelection/Tileset.h>
+#include <Cesium3DTilesSelection/TileIdUtilities.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumUtility/JsonValue.h>
 
@@ -28,9 +30,12 @@
 
 namespace Cesium
 {
-    RenderResourcesPreparer::RenderResourcesPreparer(AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor)
+    RenderResourcesPreparer::RenderResourcesPreparer(
+        AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor, MemoryTracker* memoryTracker)
         : m_meshFeatureProcessor{ meshFeatureProcessor }
+        , m_memoryTracker{ memoryTracker }
         , m_transform{ 1.0 }
+        , m_rayTracingEnabled{ false }
     {
         m_freeRasterLayers.reserve(GltfRasterMaterialBuilder::MAX_RASTER_LAYERS);
         for (std::uint32_t i = 0; i < GltfRasterMaterialBuilder::MAX_RASTER_LAYERS; ++i)
@@ -78,16 +83,83 @@ namespace Cesium
         return m_transform;
     }
 
-    void RenderResourcesPreparer::SetVisible(void* renderResources, bool visible)
+    void RenderResourcesPreparer::SetRayTracingEnabled(bool rayTracingEnabled)
     {
+        if (m_rayTracingEnabled == rayTracingEnabled)
+        {
+            return;
+        }
+
+        m_rayTracingEnabled = rayTracingEnabled;
+        for (auto& intrusiveModel : m_intrusiveModels)
+        {
+            intrusiveModel.m_model.SetRayTracingEnabled(rayTracingEnabled);
+        }
+    }
+
+    bool RenderResourcesPreparer::IsRayTracingEnabled() const
+    {
+        return m_rayTracingEnabled;
+    }
+
+    bool RenderResourcesPreparer::SetVisible(void* renderResources, bool visible)
+    {
+        bool toggled = false;
         if (renderResources)
         {
             IntrusiveGltfModel* intrusiveModel = reinterpret_cast<IntrusiveGltfModel*>(renderResources);
             if (intrusiveModel->m_model.IsVisible() != visible)
             {
                 intrusiveModel->m_model.SetVisible(visible);
+                toggled = true;
+            }
+
+            if (visible && intrusiveModel->m_traceFirstVisible)
+            {
+                intrusiveModel->m_traceFirstVisible = false;
+                if (TraceRecorder* recorder = GetActiveTraceRecorder())
+                {
+                    recorder->RecordInstant("Tile", "TileFirstVisible", intrusiveModel->m_traceTag);
+                }
+            }
+        }
+
+        return toggled;
+    }
+
+    std::uint32_t RenderResourcesPreparer::HideUnselectedModels(const std::vector<Cesium3DTilesSelection::Tile*>& selectedTiles)
+    {
+        for (Cesium3DTilesSelection::Tile* tile : selectedTiles)
+        {
+            if (tile->getState() == Cesium3DTilesSelection::Tile::LoadState::Done && tile->getRendererResources())
+            {
+                reinterpret_cast<IntrusiveGltfModel*>(tile->getRendererResources())->m_selected = true;
+            }
+        }
+
+        std::uint32_t hiddenModels = 0;
+        for (auto& intrusiveModel : m_intrusiveModels)
+        {
+            if (!intrusiveModel.m_selected && intrusiveModel.m_model.IsVisible())
+            {
+                intrusiveModel.m_model.SetVisible(false);
+                ++hiddenModels;
             }
+
+            intrusiveModel.m_selected = false;
         }
+
+        return hiddenModels;
+    }
+
+    LoadPipelineThrottle& RenderResourcesPreparer::GetLoadPipelineThrottle()
+    {
+        return m_loadPipelineThrottle;
+    }
+
+    const LoadPipelineThrottle& RenderResourcesPreparer::GetLoadPipelineThrottle() const
+    {
+        return m_loadPipelineThrottle;
     }
 
     bool RenderResourcesPreparer::AddRasterLayer(const Cesium3DTilesSelection::RasterOverlay* rasterOverlay)
@@ -128,24 +200,63 @@ namespace Cesium
             option.m_transform = glm::translate(transform, rtc.value());
         }
 
+        // the tileset starts no more loads than the room left in the pipeline, so the load thread never waits here
+        m_loadPipelineThrottle.Acquire();
+
         // build model
+        ScopedTraceEvent traceEvent("Tile", "GltfBuild");
         AZStd::unique_ptr<GltfLoadModel> loadModel = AZStd::make_unique<GltfLoadModel>();
         GltfModelBuilder builder(AZStd::make_unique<GltfRasterMaterialBuilder>());
         builder.Create(model, option, *loadModel);
+        std::uint64_t byteSize = loadModel->EstimateByteSize();
+        m_loadPipelineThrottle.Commit(byteSize);
+        if (m_memoryTracker)
+        {
+            m_memoryTracker->Allocate(MemoryCategory::BuiltAssets, byteSize);
+        }
+
         return loadModel.release();
     }
 
-    void* RenderResourcesPreparer::prepareInMainThread([[maybe_unused]] Cesium3DTilesSelection::Tile& tile, void* pLoadThreadResult)
+    void* RenderResourcesPreparer::prepareInMainThread(Cesium3DTilesSelection::Tile& tile, void* pLoadThreadResult)
     {
         if (pLoadThreadResult)
         {
+            TraceRecorder* recorder = GetActiveTraceRecorder();
+            AZStd::string traceTag;
+            if (recorder)
+            {
+                traceTag = Cesium3DTilesSelection::TileIdUtilities::createTileIdString(tile.getTileID()).c_str();
+            }
+
+            ScopedTraceEvent traceEvent("Tile", "MainThreadPrepare", traceTag);
+
             // we destroy loadModel after main thread is done
             AZStd::unique_ptr<GltfLoadModel> loadModel{ reinterpret_cast<GltfLoadModel*>(pLoadThreadResult) };
+            std::uint64_t byteSize = loadModel->EstimateByteSize();
+            m_loadPipelineThrottle.Release(byteSize);
+            if (m_memoryTracker)
+            {
+                m_memoryTracker->Free(MemoryCategory::BuiltAssets, byteSize);
+            }
+
             auto handle = m_intrusiveModels.emplace(GltfModel(m_meshFeatureProcessor, *loadModel));
             IntrusiveGltfModel& intrusiveModel = *handle;
             intrusiveModel.m_self = std::move(handle);
+            intrusiveModel.m_memory = TrackedMemory(m_memoryTracker, MemoryCategory::BuiltAssets, byteSize);
             intrusiveModel.m_model.SetTransform(m_transform);
             intrusiveModel.m_model.SetVisible(false);
+            if (m_rayTracingEnabled)
+            {
+                intrusiveModel.m_model.SetRayTracingEnabled(true);
+            }
+
+            if (recorder)
+            {
+                intrusiveModel.m_traceTag = std::move(traceTag);
+                intrusiveModel.m_traceFirstVisible = true;
+            }
+
             return &intrusiveModel;
         }
 
@@ -158,6 +269,13 @@ namespace Cesium
         if (pLoadThreadResult)
         {
             GltfLoadModel* loadModel = reinterpret_cast<GltfLoadModel*>(pLoadThreadResult);
+            std::uint64_t byteSize = loadModel->EstimateByteSize();
+            m_loadPipelineThrottle.Release(byteSize);
+            if (m_memoryTracker)
+            {
+                m_memoryTracker->Free(MemoryCategory::BuiltAssets, byteSize);
+            }
+
             delete loadModel;
         }
 
@@ -205,6 +323,7 @@ namespace Cesium
             {
                 auto rasterOverlay = new RasterOverlay();
                 rasterOverlay->m_imageAsset = std::move(imageAsset);
+                rasterOverlay->m_memory = TrackedMemory(m_memoryTracker, MemoryCategory::RasterImages, image.pixelData.size());
                 return rasterOverlay;
             }
         }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Cesium/Gltf/GltfModel.h"
+#include "Cesium/TilesetUtility/LoadPipelineThrottle.h"
+#include "Cesium/Systems/MemoryTracker.h"
 #include <Atom/RPI.Public/Material/Material.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
@@ -10,8 +12,10 @@
 #include <AzCore/std/optional.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/string/string.h>
 #include <Cesium3DTilesSelection/IPrepareRendererResources.h>
 #include <glm/glm.hpp>
+#include <vector>
 
 namespace AZ
 {
@@ -37,17 +41,24 @@ namespace Cesium
     {
         AZ::Data::Instance<AZ::RPI::StreamingImage> m_image;
         AZ::Data::Asset<AZ::RPI::StreamingImageAsset> m_imageAsset;
+        TrackedMemory m_memory;
     };
 
     struct IntrusiveGltfModel
     {
         IntrusiveGltfModel(GltfModel&& model)
             : m_model{ std::move(model) }
+            , m_traceFirstVisible{ false }
+            , m_selected{ false }
         {
         }
 
         GltfModel m_model;
         AZ::StableDynamicArrayHandle<IntrusiveGltfModel> m_self;
+        AZStd::string m_traceTag;
+        bool m_traceFirstVisible;
+        bool m_selected;
+        TrackedMemory m_memory;
     };
 
     class RenderResourcesPreparer
@@ -55,7 +66,7 @@ namespace Cesium
         , public AZ::TickBus::Handler
     {
     public:
-        RenderResourcesPreparer(AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor);
+        RenderResourcesPreparer(AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor, MemoryTracker* memoryTracker);
 
         ~RenderResourcesPreparer() noexcept;
 
@@ -65,7 +76,21 @@ namespace Cesium
 
         const glm::dmat4& GetTransform() const;
 
-        void SetVisible(void* renderResources, bool visible);
+        // applied to the models already prepared as well, so the tiles don't have to be loaded again
+        void SetRayTracingEnabled(bool rayTracingEnabled);
+
+        bool IsRayTracingEnabled() const;
+
+        // return true if the visibility of the tile changes
+        bool SetVisible(void* renderResources, bool visible);
+
+        // hide every model that is not one of the selected tiles, for when the visible models did not follow the last selections.
+        // Return the number of models hidden
+        std::uint32_t HideUnselectedModels(const std::vector<Cesium3DTilesSelection::Tile*>& selectedTiles);
+
+        LoadPipelineThrottle& GetLoadPipelineThrottle();
+
+        const LoadPipelineThrottle& GetLoadPipelineThrottle() const;
 
         bool AddRasterLayer(const Cesium3DTilesSelection::RasterOverlay* rasterOverlay);
 
@@ -106,8 +131,11 @@ namespace Cesium
         static constexpr char CESIUM_RTC_CENTER_EXTRA[] = "RTC_CENTER";
 
         AZ::Render::MeshFeatureProcessorInterface* m_meshFeatureProcessor;
+        MemoryTracker* m_memoryTracker;
         AZ::StableDynamicArray<IntrusiveGltfModel> m_intrusiveModels;
         glm::dmat4 m_transform;
+        bool m_rayTracingEnabled;
+        LoadPipelineThrottle m_loadPipelineThrottle;
 
         AZStd::vector<AZ::Data::Instance<AZ::RPI::Material>> m_compileMaterialsQueue;
         AZStd::map<const Cesium3DTilesSelection::RasterOverlay*, std::uint32_t> m_rasterOverlayLayers;
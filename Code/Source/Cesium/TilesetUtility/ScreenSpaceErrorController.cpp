@@ -0,0 +1,101 @@
+#include "Cesium/TilesetUtility/ScreenSpaceErrorController.h"
+#include <AzCore/std/algorithm.h>
+
+namespace Cesium
+{
+    ScreenSpaceErrorController::ScreenSpaceErrorController()
+        : m_minimumScreenSpaceError{ 0.0 }
+        , m_maximumScreenSpaceError{ 0.0 }
+        , m_screenSpaceError{ 0.0 }
+        , m_targetFrameTime{ 0.0f }
+        , m_mainThreadBudget{ 0.0f }
+        , m_smoothedFrameTime{ 0.0f }
+        , m_smoothedMainThreadTime{ 0.0f }
+        , m_framesSinceChange{ 0 }
+        , m_hasSample{ false }
+    {
+    }
+
+    void ScreenSpaceErrorController::Configure(
+        double minimumScreenSpaceError, double maximumScreenSpaceError, float targetFrameTime, float mainThreadBudget)
+    {
+        m_minimumScreenSpaceError = AZStd::min(minimumScreenSpaceError, maximumScreenSpaceError);
+        m_maximumScreenSpaceError = AZStd::max(minimumScreenSpaceError, maximumScreenSpaceError);
+        m_targetFrameTime = AZStd::max(targetFrameTime, 0.0f);
+        m_mainThreadBudget = AZStd::max(mainThreadBudget, 0.0f);
+        m_screenSpaceError = AZStd::clamp(m_screenSpaceError, m_minimumScreenSpaceError, m_maximumScreenSpaceError);
+    }
+
+    void ScreenSpaceErrorController::Reset(double screenSpaceError)
+    {
+        m_screenSpaceError = AZStd::clamp(screenSpaceError, m_minimumScreenSpaceError, m_maximumScreenSpaceError);
+        m_smoothedFrameTime = 0.0f;
+        m_smoothedMainThreadTime = 0.0f;
+        m_framesSinceChange = 0;
+        m_hasSample = false;
+    }
+
+    double ScreenSpaceErrorController::Update(float frameTime, float mainThreadTime)
+    {
+        if (!m_hasSample)
+        {
+            m_smoothedFrameTime = frameTime;
+            m_smoothedMainThreadTime = mainThreadTime;
+            m_hasSample = true;
+        }
+        else
+        {
+            m_smoothedFrameTime += SMOOTHING_FACTOR * (frameTime - m_smoothedFrameTime);
+            m_smoothedMainThreadTime += SMOOTHING_FACTOR * (mainThreadTime - m_smoothedMainThreadTime);
+        }
+
+        // tiles of the new level of detail take a few frames to load, so let the previous change settle first
+        ++m_framesSinceChange;
+        if (m_framesSinceChange < SETTLE_FRAMES)
+        {
+            return m_screenSpaceError;
+        }
+
+        double previousScreenSpaceError = m_screenSpaceError;
+        if (IsOverBudget())
+        {
+            m_screenSpaceError = AZStd::min(m_screenSpaceError * COARSEN_FACTOR, m_maximumScreenSpaceError);
+        }
+        else if (IsUnderBudget())
+        {
+            m_screenSpaceError = AZStd::max(m_screenSpaceError * REFINE_FACTOR, m_minimumScreenSpaceError);
+        }
+
+        if (m_screenSpaceError != previousScreenSpaceError)
+        {
+            m_framesSinceChange = 0;
+        }
+
+        return m_screenSpaceError;
+    }
+
+    double ScreenSpaceErrorController::GetScreenSpaceError() const
+    {
+        return m_screenSpaceError;
+    }
+
+    bool ScreenSpaceErrorController::IsOverBudget() const
+    {
+        bool frameOverBudget = m_targetFrameTime > 0.0f && m_smoothedFrameTime > m_targetFrameTime * OVER_BUDGET_RATIO;
+        bool mainThreadOverBudget = m_mainThreadBudget > 0.0f && m_smoothedMainThreadTime > m_mainThreadBudget * OVER_BUDGET_RATIO;
+        return frameOverBudget || mainThreadOverBudget;
+    }
+
+    bool ScreenSpaceErrorController::IsUnderBudget() const
+    {
+        if (m_targetFrameTime <= 0.0f && m_mainThreadBudget <= 0.0f)
+        {
+            return false;
+        }
+
+        bool frameUnderBudget = m_targetFrameTime <= 0.0f || m_smoothedFrameTime < m_targetFrameTime * UNDER_BUDGET_RATIO;
+        bool mainThreadUnderBudget =
+            m_mainThreadBudget <= 0.0f || m_smoothedMainThreadTime < m_mainThreadBudget * UNDER_BUDGET_RATIO;
+        return frameUnderBudget && mainThreadUnderBudget;
+    }
+} // namespace Cesium
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Cesium
+{
+    // Adjusts the maximum screen space error of a tileset from the frame time and the main thread time spent on the tileset.
+    // The times are smoothed, and the error only changes when they leave a dead band around the targets and the previous change
+    // had some frames to take effect, so the level of detail does not oscillate. Detail is removed faster than it is added back.
+    class ScreenSpaceErrorController final
+    {
+    public:
+        ScreenSpaceErrorController();
+
+        // a target or budget of 0 is ignored
+        void Configure(
+            double minimumScreenSpaceError, double maximumScreenSpaceError, float targetFrameTime, float mainThreadBudget);
+
+        void Reset(double screenSpaceError);
+
+        // times are in milliseconds. Return the screen space error to use for the next frame
+        double Update(float frameTime, float mainThreadTime);
+
+        double GetScreenSpaceError() const;
+
+        static constexpr float SMOOTHING_FACTOR = 0.1f;
+        static constexpr float OVER_BUDGET_RATIO = 1.05f;
+        static constexpr float UNDER_BUDGET_RATIO = 0.8f;
+        static constexpr double COARSEN_FACTOR = 1.25;
+        static constexpr double REFINE_FACTOR = 0.9;
+        static constexpr std::uint32_t SETTLE_FRAMES = 30;
+
+    private:
+        bool IsOverBudget() const;
+
+        bool IsUnderBudget() const;
+
+        double m_minimumScreenSpaceError;
+        double m_maximumScreenSpaceError;
+        double m_screenSpaceError;
+        float m_targetFrameTime;
+        float m_mainThreadBudget;
+        float m_smoothedFrameTime;
+        float m_smoothedMainThreadTime;
+        std::uint32_t m_framesSinceChange;
+        bool m_hasSample;
+    };
+} // namespace Cesium
@@ -0,0 +1,83 @@
+#include "Cesium/TilesetUtility/StreamingStatisticsWindow.h"
+#include <AzCore/std/algorithm.h>
+
+namespace Cesium
+{
+    StreamingStatisticsWindow::StreamingStatisticsWindow(std::size_t windowSize)
+        : m_windowSize{ AZStd::max(windowSize, std::size_t{ 1 }) }
+        , m_nextFrame{ 0 }
+    {
+        m_frames.reserve(m_windowSize);
+    }
+
+    void StreamingStatisticsWindow::Push(const TilesetStreamingStatistics& frameStatistics)
+    {
+        m_latest = frameStatistics;
+        if (m_frames.size() < m_windowSize)
+        {
+            m_frames.emplace_back(frameStatistics);
+        }
+        else
+        {
+            m_frames[m_nextFrame] = frameStatistics;
+        }
+
+        m_nextFrame = (m_nextFrame + 1) % m_windowSize;
+    }
+
+    void StreamingStatisticsWindow::Reset()
+    {
+        m_frames.clear();
+        m_nextFrame = 0;
+        m_latest = TilesetStreamingStatistics{};
+    }
+
+    const TilesetStreamingStatistics& StreamingStatisticsWindow::GetLatest() const
+    {
+        return m_latest;
+    }
+
+    TilesetRollingStreamingStatistics StreamingStatisticsWindow::GetRolling() const
+    {
+        TilesetRollingStreamingStatistics rolling;
+        if (m_frames.empty())
+        {
+            return rolling;
+        }
+
+        double tilesRendered = 0.0;
+        double tilesVisited = 0.0;
+        double tilesCulled = 0.0;
+        double tilesOcclusionCulled = 0.0;
+        double tilesLoading = 0.0;
+        double mainThreadQueueLength = 0.0;
+        double bytesCached = 0.0;
+        double updateViewTime = 0.0;
+        for (const auto& frame : m_frames)
+        {
+            tilesRendered += frame.m_tilesRendered;
+            tilesVisited += frame.m_tilesVisited;
+            tilesCulled += frame.m_tilesCulled;
+            tilesOcclusionCulled += frame.m_tilesHorizonCulled + frame.m_tilesOcclusionCulled;
+            tilesLoading += frame.m_tilesLoadingLowPriority + frame.m_tilesLoadingMediumPriority + frame.m_tilesLoadingHighPriority;
+            mainThreadQueueLength += frame.m_mainThreadQueueLength;
+            bytesCached += static_cast<double>(frame.m_bytesCached);
+            updateViewTime += frame.m_updateViewTime;
+            rolling.m_maxUpdateViewTime = AZStd::max(rolling.m_maxUpdateViewTime, frame.m_updateViewTime);
+            rolling.m_totalVisibilityToggles += frame.m_visibilityToggles;
+            rolling.m_skippedUpdateViews += frame.m_updateViewSkipped ? 1 : 0;
+        }
+
+        double frameCount = static_cast<double>(m_frames.size());
+        rolling.m_frameCount = static_cast<std::uint32_t>(m_frames.size());
+        rolling.m_averageTilesRendered = static_cast<float>(tilesRendered / frameCount);
+        rolling.m_averageTilesVisited = static_cast<float>(tilesVisited / frameCount);
+        rolling.m_averageTilesCulled = static_cast<float>(tilesCulled / frameCount);
+        rolling.m_averageTilesOcclusionCulled = static_cast<float>(tilesOcclusionCulled / frameCount);
+        rolling.m_averageTilesLoading = static_cast<float>(tilesLoading / frameCount);
+        rolling.m_averageMainThreadQueueLength = static_cast<float>(mainThreadQueueLength / frameCount);
+        rolling.m_averageBytesCached = bytesCached / frameCount;
+        rolling.m_averageUpdateViewTime = static_cast<float>(updateViewTime / frameCount);
+        return rolling;
+    }
+} // namespace Cesium
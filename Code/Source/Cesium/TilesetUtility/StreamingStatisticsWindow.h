@@ -0,0 +1,32 @@
+#pragma once
+
+#include <Cesium/EBus/TilesetComponentBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <cstddef>
+
+namespace Cesium
+{
+    // Keeps the streaming statistics of the last frames in a ring buffer, so the rolling values can be computed on request
+    // instead of every frame
+    class StreamingStatisticsWindow final
+    {
+    public:
+        explicit StreamingStatisticsWindow(std::size_t windowSize = DEFAULT_WINDOW_SIZE);
+
+        void Push(const TilesetStreamingStatistics& frameStatistics);
+
+        void Reset();
+
+        const TilesetStreamingStatistics& GetLatest() const;
+
+        TilesetRollingStreamingStatistics GetRolling() const;
+
+        static constexpr std::size_t DEFAULT_WINDOW_SIZE = 120;
+
+    private:
+        AZStd::vector<TilesetStreamingStatistics> m_frames;
+        std::size_t m_windowSize;
+        std::size_t m_nextFrame;
+        TilesetStreamingStatistics m_latest;
+    };
+} // namespace Cesium
@@ -0,0 +1,93 @@
+#include "Cesium/TilesetUtility/TileLoadLatencyTracker.h"
+
+namespace Cesium
+{
+    TileLoadLatencyTracker::TileLoadLatencyTracker()
+        : m_frame{ 0 }
+    {
+    }
+
+    void TileLoadLatencyTracker::BeginFrame()
+    {
+        ++m_frame;
+    }
+
+    void TileLoadLatencyTracker::Update(const void* tile, TileLoadPhase phase, Clock::time_point now)
+    {
+        if (phase == TileLoadPhase::Unloaded)
+        {
+            m_entries.erase(tile);
+            return;
+        }
+
+        auto it = m_entries.find(tile);
+        if (it == m_entries.end())
+        {
+            // tiles already loading in the first frame may have started long before
+            Entry entry;
+            entry.m_loadStart = now;
+            entry.m_loadLatency = -1.0f;
+            entry.m_lastFrame = m_frame;
+            entry.m_loading = phase == TileLoadPhase::Loading;
+            entry.m_loadStartKnown = entry.m_loading && m_frame > 1;
+            m_entries.emplace(tile, entry);
+            return;
+        }
+
+        Entry& entry = it->second;
+        entry.m_lastFrame = m_frame;
+        if (phase == TileLoadPhase::Loading && !entry.m_loading)
+        {
+            entry.m_loadStart = now;
+            entry.m_loadLatency = -1.0f;
+            entry.m_loading = true;
+            entry.m_loadStartKnown = true;
+        }
+        else if (phase == TileLoadPhase::Loaded && entry.m_loading)
+        {
+            if (entry.m_loadStartKnown)
+            {
+                entry.m_loadLatency = std::chrono::duration<float, std::milli>(now - entry.m_loadStart).count();
+            }
+
+            entry.m_loading = false;
+        }
+    }
+
+    void TileLoadLatencyTracker::EndFrame()
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            if (it->second.m_lastFrame != m_frame)
+            {
+                it = m_entries.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void TileLoadLatencyTracker::Reset()
+    {
+        m_entries.clear();
+        m_frame = 0;
+    }
+
+    float TileLoadLatencyTracker::GetLoadLatency(const void* tile) const
+    {
+        auto it = m_entries.find(tile);
+        if (it == m_entries.end())
+        {
+            return -1.0f;
+        }
+
+        return it->second.m_loadLatency;
+    }
+
+    std::size_t TileLoadLatencyTracker::GetTrackedTileCount() const
+    {
+        return m_entries.size();
+    }
+} // namespace Cesium
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Cesium
+{
+    enum class TileLoadPhase
+    {
+        Unloaded,
+        Loading,
+        Loaded
+    };
+
+    // Measures how long tiles take to load by sampling their load phase once per frame. Tiles are identified by address only,
+    // so the tracker does not depend on the tile type. Tiles that are not updated during a frame are forgotten at the end of it.
+    class TileLoadLatencyTracker final
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        TileLoadLatencyTracker();
+
+        void BeginFrame();
+
+        void Update(const void* tile, TileLoadPhase phase, Clock::time_point now);
+
+        void EndFrame();
+
+        void Reset();
+
+        // in milliseconds. Negative if the tile is not loaded yet or its load started before it was tracked
+        float GetLoadLatency(const void* tile) const;
+
+        std::size_t GetTrackedTileCount() const;
+
+    private:
+        struct Entry
+        {
+            Clock::time_point m_loadStart;
+            float m_loadLatency;
+            std::uint64_t m_lastFrame;
+            bool m_loading;
+            bool m_loadStartKnown;
+        };
+
+        AZStd::unordered_map<const void*, Entry> m_entries;
+        std::uint64_t m_frame;
+    };
+} // namespace Cesium
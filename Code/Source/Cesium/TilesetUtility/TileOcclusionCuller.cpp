@@ -0,0 +1,478 @@
+#include "Cesium/TilesetUtility/TileOcclusionCuller.h"
+#include <AzCore/std/algorithm.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <variant>
+
+// Window 10 wingdi.h header defines OPAQUE macro which mess up with CesiumGltf::Material::AlphaMode::OPAQUE.
+// This only happens with unity build
+#include <AzCore/PlatformDef.h>
+#ifdef AZ_COMPILER_MSVC
+#pragma push_macro("OPAQUE")
+#undef OPAQUE
+#endif
+
+#include <Cesium3DTilesSelection/Tile.h>
+
+#ifdef AZ_COMPILER_MSVC
+#pragma pop_macro("OPAQUE")
+#endif
+
+namespace Cesium
+{
+    namespace
+    {
+        // below the smallest radius of curvature of the WGS84 ellipsoid, so the top of an occluder stays under the ground
+        constexpr double MINIMUM_CURVATURE_RADIUS = 6300000.0;
+
+        // the region is not exactly a rectangle in the tangent plane, so the occluder is kept away from its sides
+        constexpr double OCCLUDER_SHRINK_FACTOR = 0.9;
+
+        void SetBoxCorners(const glm::dvec3& center, const glm::dmat3& halfAxes, AZStd::array<glm::dvec3, 8>& corners)
+        {
+            std::size_t corner = 0;
+            for (double i : { -1.0, 1.0 })
+            {
+                for (double j : { -1.0, 1.0 })
+                {
+                    for (double k : { -1.0, 1.0 })
+                    {
+                        corners[corner++] = center + i * halfAxes[0] + j * halfAxes[1] + k * halfAxes[2];
+                    }
+                }
+            }
+        }
+
+        // the geographic bounding volumes are always in earth centered, earth fixed coordinates, so only the others are
+        // transformed. The loose fitting heights may not contain the content, so those tiles are never culled
+        struct BoundingVolumeCorners
+        {
+            bool operator()(const CesiumGeometry::BoundingSphere& sphere)
+            {
+                SetBoxCorners(sphere.getCenter(), glm::dmat3{ sphere.getRadius() }, *m_corners);
+                Transform();
+                return true;
+            }
+
+            bool operator()(const CesiumGeometry::OrientedBoundingBox& box)
+            {
+                SetBoxCorners(box.getCenter(), box.getHalfAxes(), *m_corners);
+                Transform();
+                return true;
+            }
+
+            bool operator()(const CesiumGeospatial::BoundingRegion& region)
+            {
+                const CesiumGeometry::OrientedBoundingBox& box = region.getBoundingBox();
+                SetBoxCorners(box.getCenter(), box.getHalfAxes(), *m_corners);
+                return true;
+            }
+
+            bool operator()([[maybe_unused]] const CesiumGeospatial::BoundingRegionWithLooseFittingHeights& region)
+            {
+                return false;
+            }
+
+            bool operator()(const CesiumGeospatial::S2CellBoundingVolume& s2Volume)
+            {
+                return this->operator()(s2Volume.computeBoundingRegion());
+            }
+
+            void Transform()
+            {
+                for (glm::dvec3& corner : *m_corners)
+                {
+                    corner = glm::dvec3(m_transform * glm::dvec4(corner, 1.0));
+                }
+            }
+
+            glm::dmat4 m_transform;
+            AZStd::array<glm::dvec3, 8>* m_corners;
+        };
+
+        glm::dvec3 ToCartesian(double longitude, double latitude, double height)
+        {
+            return CesiumGeospatial::Ellipsoid::WGS84.cartographicToCartesian(
+                CesiumGeospatial::Cartographic{ longitude, latitude, height });
+        }
+    } // namespace
+
+    TileOcclusionCuller::TileOcclusionCuller()
+        : m_transform{ 1.0 }
+        , m_horizonRadii{ CesiumGeospatial::Ellipsoid::WGS84.getRadii() }
+        , m_horizonCulledTileCount{ 0 }
+        , m_occlusionCulledTileCount{ 0 }
+        , m_cullingTime{ 0.0f }
+        , m_horizonCulling{ false }
+        , m_occlusionCulling{ false }
+        , m_buildOccluders{ false }
+    {
+    }
+
+    void TileOcclusionCuller::Configure(bool horizonCulling, bool occlusionCulling, bool buildOccluders)
+    {
+        m_horizonCulling = horizonCulling;
+        m_occlusionCulling = occlusionCulling;
+        m_buildOccluders = occlusionCulling || buildOccluders;
+    }
+
+    void TileOcclusionCuller::SetViews(const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, const glm::dmat4& transform)
+    {
+        m_transform = transform;
+        m_eyes.clear();
+        for (const Cesium3DTilesSelection::ViewState& viewState : viewStates)
+        {
+            m_eyes.emplace_back(m_transform * glm::dvec4(viewState.getPosition(), 1.0));
+        }
+
+        m_ownOccluders.clear();
+        m_sharedOccluders.clear();
+    }
+
+    void TileOcclusionCuller::SetHorizonHeight(double height)
+    {
+        // the radii stay positive, even when a large tile reaches deep below the ground
+        const glm::dvec3& radii = CesiumGeospatial::Ellipsoid::WGS84.getRadii();
+        double minimumHeight = 1.0 - AZStd::min(radii.x, AZStd::min(radii.y, radii.z));
+        m_horizonRadii = radii + glm::dvec3(AZStd::clamp(height, minimumHeight, 0.0));
+    }
+
+    double TileOcclusionCuller::ComputeLowestHeight(const Cesium3DTilesSelection::BoundingVolume& boundingVolume) const
+    {
+        BoxCorners corners;
+        if (!ComputeCorners(boundingVolume, corners))
+        {
+            // the loose fitting heights may not contain the content, but they are the best guess of its ground
+            const auto looseRegion = std::get_if<CesiumGeospatial::BoundingRegionWithLooseFittingHeights>(&boundingVolume);
+            return looseRegion ? AZStd::min(looseRegion->getBoundingRegion().getMinimumHeight(), 0.0) : 0.0;
+        }
+
+        // the corners are at the earth center for the tilesets that are not georeferenced, which have no height
+        double lowestHeight = 0.0;
+        for (const glm::dvec3& corner : corners)
+        {
+            if (std::optional<CesiumGeospatial::Cartographic> cartographic =
+                    CesiumGeospatial::Ellipsoid::WGS84.cartesianToCartographic(corner))
+            {
+                lowestHeight = AZStd::min(lowestHeight, cartographic->height);
+            }
+        }
+
+        return lowestHeight;
+    }
+
+    bool TileOcclusionCuller::AddOccluder(const Cesium3DTilesSelection::BoundingVolume& boundingVolume)
+    {
+        const CesiumGeospatial::BoundingRegion* region = std::get_if<CesiumGeospatial::BoundingRegion>(&boundingVolume);
+        if (!region)
+        {
+            return false;
+        }
+
+        const CesiumGeospatial::GlobeRectangle& rectangle = region->getRectangle();
+        double west = rectangle.getWest();
+        double south = rectangle.getSouth();
+        double width = rectangle.getEast() - west;
+        if (width < 0.0)
+        {
+            width += glm::two_pi<double>();
+        }
+
+        double height = rectangle.getNorth() - south;
+        if (width > MAXIMUM_OCCLUDER_ANGLE || height > MAXIMUM_OCCLUDER_ANGLE)
+        {
+            return false;
+        }
+
+        // a box in the tangent frame at the center of the region, below its minimum height
+        double longitude = west + 0.5 * width;
+        double latitude = south + 0.5 * height;
+        double minimumHeight = region->getMinimumHeight();
+        glm::dvec3 center = ToCartesian(longitude, latitude, minimumHeight);
+        glm::dvec3 up = CesiumGeospatial::Ellipsoid::WGS84.geodeticSurfaceNormal(CesiumGeospatial::Cartographic{ longitude, latitude });
+        glm::dvec3 east{ -std::sin(longitude), std::cos(longitude), 0.0 };
+        glm::dvec3 north = glm::cross(up, east);
+
+        double halfEast = std::numeric_limits<double>::max();
+        double halfNorth = std::numeric_limits<double>::max();
+        for (double t : { 0.0, 0.5, 1.0 })
+        {
+            double sideLatitude = south + t * height;
+            halfEast = AZStd::min(halfEast, std::abs(glm::dot(ToCartesian(west, sideLatitude, minimumHeight) - center, east)));
+            halfEast = AZStd::min(halfEast, std::abs(glm::dot(ToCartesian(west + width, sideLatitude, minimumHeight) - center, east)));
+
+            double sideLongitude = west + t * width;
+            halfNorth = AZStd::min(halfNorth, std::abs(glm::dot(ToCartesian(sideLongitude, south, minimumHeight) - center, north)));
+            halfNorth =
+                AZStd::min(halfNorth, std::abs(glm::dot(ToCartesian(sideLongitude, south + height, minimumHeight) - center, north)));
+        }
+
+        halfEast *= OCCLUDER_SHRINK_FACTOR;
+        halfNorth *= OCCLUDER_SHRINK_FACTOR;
+        if (halfEast < MINIMUM_OCCLUDER_HALF_EXTENT || halfNorth < MINIMUM_OCCLUDER_HALF_EXTENT)
+        {
+            return false;
+        }
+
+        // the top is lowered by the curvature of the ground, so its corners don't stick out of the minimum height
+        double sagitta = (halfEast * halfEast + halfNorth * halfNorth) / (2.0 * MINIMUM_CURVATURE_RADIUS);
+        double depth = AZStd::min(halfEast, halfNorth);
+        TileOccluder occluder;
+        occluder.m_center = center - up * (sagitta + 0.5 * depth);
+        occluder.m_axes = glm::dmat3{ east, north, up };
+        occluder.m_halfExtents = glm::dvec3{ halfEast, halfNorth, 0.5 * depth };
+        occluder.m_score = ComputeOccluderScore(occluder);
+        InsertOccluder(m_ownOccluders, occluder);
+        return true;
+    }
+
+    void TileOcclusionCuller::AddSharedOccluders(const AZStd::vector<TileOccluder>& occluders)
+    {
+        for (TileOccluder occluder : occluders)
+        {
+            occluder.m_score = ComputeOccluderScore(occluder);
+            InsertOccluder(m_sharedOccluders, occluder);
+        }
+    }
+
+    const AZStd::vector<TileOccluder>& TileOcclusionCuller::GetOwnOccluders() const
+    {
+        return m_ownOccluders;
+    }
+
+    const AZStd::vector<TileOccluder>& TileOcclusionCuller::GetSharedOccluders() const
+    {
+        return m_sharedOccluders;
+    }
+
+    TileOcclusionCuller::CullResult TileOcclusionCuller::Cull(const Cesium3DTilesSelection::BoundingVolume& boundingVolume) const
+    {
+        if ((!m_horizonCulling && !m_occlusionCulling) || m_eyes.empty())
+        {
+            return CullResult::Visible;
+        }
+
+        BoxCorners corners;
+        if (!ComputeCorners(boundingVolume, corners))
+        {
+            return CullResult::Visible;
+        }
+
+        // the tile must be hidden in every view, but not always by the same test
+        bool belowHorizon = true;
+        for (const glm::dvec3& eye : m_eyes)
+        {
+            if (m_horizonCulling && IsBelowHorizon(eye, corners))
+            {
+                continue;
+            }
+
+            belowHorizon = false;
+            if (!m_occlusionCulling || (!IsOccluded(eye, corners, m_ownOccluders) && !IsOccluded(eye, corners, m_sharedOccluders)))
+            {
+                return CullResult::Visible;
+            }
+        }
+
+        return belowHorizon ? CullResult::BelowHorizon : CullResult::Occluded;
+    }
+
+    void TileOcclusionCuller::Update(
+        const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+        const glm::dmat4& transform,
+        const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+        const AZStd::vector<TileOccluder>& sharedOccluders)
+    {
+        auto cullingBegin = std::chrono::steady_clock::now();
+        m_culledTiles.assign(renderedTiles.size(), false);
+        m_horizonCulledTileCount = 0;
+        m_occlusionCulledTileCount = 0;
+        SetViews(viewStates, transform);
+
+        // the horizon is lowered below every corner of the rendered tiles, whatever their bounding volume, so a tile below sea level
+        // is never culled by the ellipsoid. Only the tiles that are drawn hide the others. The empty tiles have no renderer resources
+        double lowestHeight = 0.0;
+        for (const Cesium3DTilesSelection::Tile* tile : renderedTiles)
+        {
+            const Cesium3DTilesSelection::BoundingVolume& boundingVolume = tile->getBoundingVolume();
+            if (m_horizonCulling)
+            {
+                lowestHeight = AZStd::min(lowestHeight, ComputeLowestHeight(boundingVolume));
+            }
+
+            if (m_buildOccluders && tile->getState() == Cesium3DTilesSelection::Tile::LoadState::Done && tile->getRendererResources())
+            {
+                AddOccluder(boundingVolume);
+            }
+        }
+
+        SetHorizonHeight(lowestHeight - HORIZON_HEIGHT_MARGIN);
+        if (m_occlusionCulling)
+        {
+            AddSharedOccluders(sharedOccluders);
+        }
+
+        // the occluders are only built to share them, so no tile is tested
+        if (!m_horizonCulling && !m_occlusionCulling)
+        {
+            m_cullingTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - cullingBegin).count();
+            return;
+        }
+
+        for (std::size_t i = 0; i < renderedTiles.size(); ++i)
+        {
+            CullResult result = Cull(renderedTiles[i]->getBoundingVolume());
+            m_culledTiles[i] = result != CullResult::Visible;
+            m_horizonCulledTileCount += result == CullResult::BelowHorizon ? 1 : 0;
+            m_occlusionCulledTileCount += result == CullResult::Occluded ? 1 : 0;
+        }
+
+        m_cullingTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - cullingBegin).count();
+    }
+
+    bool TileOcclusionCuller::IsCulled(std::size_t renderedTileIndex) const
+    {
+        return renderedTileIndex < m_culledTiles.size() && m_culledTiles[renderedTileIndex];
+    }
+
+    std::uint32_t TileOcclusionCuller::GetHorizonCulledTileCount() const
+    {
+        return m_horizonCulledTileCount;
+    }
+
+    std::uint32_t TileOcclusionCuller::GetOcclusionCulledTileCount() const
+    {
+        return m_occlusionCulledTileCount;
+    }
+
+    float TileOcclusionCuller::GetCullingTime() const
+    {
+        return m_cullingTime;
+    }
+
+    void TileOcclusionCuller::InsertOccluder(AZStd::vector<TileOccluder>& occluders, const TileOccluder& occluder)
+    {
+        auto isLarger = [](const TileOccluder& lhs, const TileOccluder& rhs)
+        {
+            return lhs.m_score > rhs.m_score;
+        };
+
+        if (occluders.size() < MAXIMUM_OCCLUDER_COUNT)
+        {
+            occluders.emplace_back(occluder);
+            std::push_heap(occluders.begin(), occluders.end(), isLarger);
+        }
+        else if (occluder.m_score > occluders.front().m_score)
+        {
+            std::pop_heap(occluders.begin(), occluders.end(), isLarger);
+            occluders.back() = occluder;
+            std::push_heap(occluders.begin(), occluders.end(), isLarger);
+        }
+    }
+
+    double TileOcclusionCuller::ComputeOccluderScore(const TileOccluder& occluder) const
+    {
+        // the area of the top over the squared distance, from the closest camera
+        double area = 4.0 * occluder.m_halfExtents.x * occluder.m_halfExtents.y;
+        double score = 0.0;
+        for (const glm::dvec3& eye : m_eyes)
+        {
+            glm::dvec3 offset = occluder.m_center - eye;
+            score = AZStd::max(score, area / AZStd::max(glm::dot(offset, offset), 1.0));
+        }
+
+        return score;
+    }
+
+    bool TileOcclusionCuller::ComputeCorners(const Cesium3DTilesSelection::BoundingVolume& boundingVolume, BoxCorners& corners) const
+    {
+        return std::visit(BoundingVolumeCorners{ m_transform, &corners }, boundingVolume);
+    }
+
+    bool TileOcclusionCuller::IsBelowHorizon(const glm::dvec3& eye, const BoxCorners& corners) const
+    {
+        // in the space where the ellipsoid is a unit sphere. A point is hidden when it is behind the plane of the horizon and
+        // inside the cone tangent to the sphere. Both are convex, so the hidden corners hide the whole box
+        glm::dvec3 scaledEye = eye / m_horizonRadii;
+        double horizonDistanceSquared = glm::dot(scaledEye, scaledEye) - 1.0;
+        if (horizonDistanceSquared <= 0.0)
+        {
+            return false;
+        }
+
+        for (const glm::dvec3& corner : corners)
+        {
+            glm::dvec3 eyeToCorner = corner / m_horizonRadii - scaledEye;
+            double distanceToEyePlane = -glm::dot(eyeToCorner, scaledEye);
+            bool isHidden = distanceToEyePlane > horizonDistanceSquared &&
+                distanceToEyePlane * distanceToEyePlane / glm::dot(eyeToCorner, eyeToCorner) > horizonDistanceSquared;
+            if (!isHidden)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool TileOcclusionCuller::IsOccluded(const glm::dvec3& eye, const BoxCorners& corners, const TileOccluder& occluder)
+    {
+        glm::dmat3 toOccluder = glm::transpose(occluder.m_axes);
+        glm::dvec3 localEye = toOccluder * (eye - occluder.m_center);
+        const glm::dvec3& halfExtents = occluder.m_halfExtents;
+        if (std::abs(localEye.x) <= halfExtents.x && std::abs(localEye.y) <= halfExtents.y && std::abs(localEye.z) <= halfExtents.z)
+        {
+            return false;
+        }
+
+        // every segment from the eye to a corner must go through the box
+        for (const glm::dvec3& corner : corners)
+        {
+            glm::dvec3 direction = toOccluder * (corner - occluder.m_center) - localEye;
+            double enter = 0.0;
+            double exit = 1.0;
+            for (glm::length_t axis = 0; axis < 3; ++axis)
+            {
+                if (std::abs(direction[axis]) < std::numeric_limits<double>::epsilon())
+                {
+                    if (std::abs(localEye[axis]) > halfExtents[axis])
+                    {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                double lower = (-halfExtents[axis] - localEye[axis]) / direction[axis];
+                double upper = (halfExtents[axis] - localEye[axis]) / direction[axis];
+                enter = AZStd::max(enter, AZStd::min(lower, upper));
+                exit = AZStd::min(exit, AZStd::max(lower, upper));
+                if (enter > exit)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool TileOcclusionCuller::IsOccluded(const glm::dvec3& eye, const BoxCorners& corners, const AZStd::vector<TileOccluder>& occluders)
+    {
+        for (const TileOccluder& occluder : occluders)
+        {
+            if (IsOccluded(eye, corners, occluder))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+} // namespace Cesium
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Cesium/Systems/TileOccluderRegistry.h"
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <Cesium3DTilesSelection/BoundingVolume.h>
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Cesium3DTilesSelection
+{
+    class Tile;
+}
+
+namespace Cesium
+{
+    // Hides the selected tiles that can't be seen from any of the cameras. Cesium native only culls against the view frustums, so
+    // the selected tiles are tested again on the CPU:
+    // - below the horizon: the bounding box is behind the WGS84 ellipsoid, lowered to the lowest corner of the rendered tiles.
+    // - occluded: the bounding box is behind one occluder. The occluders are boxes in the solid ground below the minimum height of
+    //   the loaded region tiles, of this tileset or shared by the others. Only the ones that look the largest from the cameras
+    //   are kept.
+    // A tile is culled when all the corners of its bounding box are hidden in every view. The corners behind one convex occluder
+    // hide the whole box, so the tests never cull a tile that can be seen, as long as the ground of the region tiles is drawn.
+    // Everything is done in earth centered, earth fixed coordinates. The tiles are culled after the selection, since the pinned
+    // cesium native has no tile occlusion proxy to hook into its traversal. The culled tiles are still refined and loaded, so the
+    // tileset gives up the load slots of its culled share instead.
+    class TileOcclusionCuller final
+    {
+    public:
+        enum class CullResult
+        {
+            Visible,
+            BelowHorizon,
+            Occluded
+        };
+
+        TileOcclusionCuller();
+
+        // the occluders can be built without culling, to share them with the other tilesets
+        void Configure(bool horizonCulling, bool occlusionCulling, bool buildOccluders);
+
+        // transform is from the tileset to earth centered, earth fixed coordinates. The occluders are cleared
+        void SetViews(const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, const glm::dmat4& transform);
+
+        // the horizon is lowered to the minimum height, so the tiles below sea level are not culled by mistake
+        void SetHorizonHeight(double height);
+
+        // the lowest height above the WGS84 ellipsoid of the corners of the bounding volume, 0 when it has none
+        double ComputeLowestHeight(const Cesium3DTilesSelection::BoundingVolume& boundingVolume) const;
+
+        // build an occluder from the ground below a region. Returns false for the other bounding volumes, and for the regions that
+        // are too large or too small to make a useful occluder
+        bool AddOccluder(const Cesium3DTilesSelection::BoundingVolume& boundingVolume);
+
+        // the occluders of the other tilesets
+        void AddSharedOccluders(const AZStd::vector<TileOccluder>& occluders);
+
+        // the occluders built from the tiles of this tileset, to share them with the others
+        const AZStd::vector<TileOccluder>& GetOwnOccluders() const;
+
+        const AZStd::vector<TileOccluder>& GetSharedOccluders() const;
+
+        CullResult Cull(const Cesium3DTilesSelection::BoundingVolume& boundingVolume) const;
+
+        // build the occluders from the rendered tiles and cull them
+        void Update(
+            const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+            const glm::dmat4& transform,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+            const AZStd::vector<TileOccluder>& sharedOccluders);
+
+        // index into the rendered tiles of the last update
+        bool IsCulled(std::size_t renderedTileIndex) const;
+
+        std::uint32_t GetHorizonCulledTileCount() const;
+
+        std::uint32_t GetOcclusionCulledTileCount() const;
+
+        // in milliseconds
+        float GetCullingTime() const;
+
+        // kept for this tileset and for the shared occluders each
+        static constexpr std::size_t MAXIMUM_OCCLUDER_COUNT = 64;
+
+        // the horizon is kept this far below the lowest ground of the tileset, in meters
+        static constexpr double HORIZON_HEIGHT_MARGIN = 100.0;
+
+        // regions wider than this, in radians, curve too much under a flat occluder
+        static constexpr double MAXIMUM_OCCLUDER_ANGLE = 0.1;
+
+        // in meters
+        static constexpr double MINIMUM_OCCLUDER_HALF_EXTENT = 1.0;
+
+    private:
+        using BoxCorners = AZStd::array<glm::dvec3, 8>;
+
+        // the occluders are kept in a heap with the smallest score first, so it is replaced by a larger one
+        static void InsertOccluder(AZStd::vector<TileOccluder>& occluders, const TileOccluder& occluder);
+
+        double ComputeOccluderScore(const TileOccluder& occluder) const;
+
+        bool ComputeCorners(const Cesium3DTilesSelection::BoundingVolume& boundingVolume, BoxCorners& corners) const;
+
+        bool IsBelowHorizon(const glm::dvec3& eye, const BoxCorners& corners) const;
+
+        static bool IsOccluded(const glm::dvec3& eye, const BoxCorners& corners, const TileOccluder& occluder);
+
+        static bool IsOccluded(const glm::dvec3& eye, const BoxCorners& corners, const AZStd::vector<TileOccluder>& occluders);
+
+        AZStd::vector<glm::dvec3> m_eyes;
+        AZStd::vector<TileOccluder> m_ownOccluders;
+        AZStd::vector<TileOccluder> m_sharedOccluders;
+        std::vector<bool> m_culledTiles;
+        glm::dmat4 m_transform;
+        glm::dvec3 m_horizonRadii;
+        std::uint32_t m_horizonCulledTileCount;
+        std::uint32_t m_occlusionCulledTileCount;
+        float m_cullingTime;
+        bool m_horizonCulling;
+        bool m_occlusionCulling;
+        bool m_buildOccluders;
+    };
+} // namespace Cesium
@@ -0,0 +1,106 @@
+#include "Cesium/TilesetUtility/TilePrefetcher.h"
+#include <AzCore/std/algorithm.h>
+
+// Window 10 wingdi.h header defines OPAQUE macro which mess up with CesiumGltf::Material::AlphaMode::OPAQUE.
+// This only happens with unity build
+#include <AzCore/PlatformDef.h>
+#ifdef AZ_COMPILER_MSVC
+#pragma push_macro("OPAQUE")
+#undef OPAQUE
+#endif
+
+#include <Cesium3DTilesSelection/Tile.h>
+
+#ifdef AZ_COMPILER_MSVC
+#pragma pop_macro("OPAQUE")
+#endif
+
+namespace Cesium
+{
+    TilePrefetcher::TilePrefetcher()
+        : m_lookAhead{ 0.0f }
+        , m_maximumPrefetchBytes{ 0 }
+        , m_lookAheadScale{ 1.0f }
+        , m_prefetchedTileCount{ 0 }
+        , m_prefetchedBytes{ 0 }
+    {
+    }
+
+    void TilePrefetcher::Configure(float lookAhead, std::uint64_t maximumPrefetchBytes)
+    {
+        m_lookAhead = AZStd::max(lookAhead, 0.0f);
+        m_maximumPrefetchBytes = maximumPrefetchBytes;
+    }
+
+    void TilePrefetcher::Reset()
+    {
+        m_lookAheadScale = 1.0f;
+        m_prefetchedTileCount = 0;
+        m_prefetchedBytes = 0;
+    }
+
+    float TilePrefetcher::GetLookAhead() const
+    {
+        return m_lookAhead * m_lookAheadScale;
+    }
+
+    void TilePrefetcher::Update(
+        const std::vector<Cesium3DTilesSelection::ViewState>& currentViewStates,
+        const std::vector<Cesium3DTilesSelection::ViewState>& predictedViewStates,
+        const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles)
+    {
+        m_prefetchedTileCount = 0;
+        std::uint64_t prefetchedBytes = 0;
+        for (const Cesium3DTilesSelection::Tile* tile : renderedTiles)
+        {
+            if (!IsVisible(currentViewStates, *tile) && IsVisible(predictedViewStates, *tile))
+            {
+                ++m_prefetchedTileCount;
+                prefetchedBytes += static_cast<std::uint64_t>(AZStd::max(tile->computeByteSize(), std::int64_t{ 0 }));
+            }
+        }
+
+        UpdateLookAheadScale(prefetchedBytes);
+    }
+
+    void TilePrefetcher::UpdateLookAheadScale(std::uint64_t prefetchedBytes)
+    {
+        m_prefetchedBytes = prefetchedBytes;
+        if (prefetchedBytes > m_maximumPrefetchBytes)
+        {
+            m_lookAheadScale *= LOOK_AHEAD_DECREASE_FACTOR;
+            if (m_lookAheadScale < MINIMUM_LOOK_AHEAD_SCALE)
+            {
+                m_lookAheadScale = 0.0f;
+            }
+        }
+        else
+        {
+            m_lookAheadScale = AZStd::min(m_lookAheadScale + LOOK_AHEAD_INCREASE_STEP, 1.0f);
+        }
+    }
+
+    bool TilePrefetcher::IsVisible(
+        const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, const Cesium3DTilesSelection::Tile& tile)
+    {
+        for (const Cesium3DTilesSelection::ViewState& viewState : viewStates)
+        {
+            if (viewState.isBoundingVolumeVisible(tile.getBoundingVolume()))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::uint32_t TilePrefetcher::GetPrefetchedTileCount() const
+    {
+        return m_prefetchedTileCount;
+    }
+
+    std::uint64_t TilePrefetcher::GetPrefetchedBytes() const
+    {
+        return m_prefetchedBytes;
+    }
+} // namespace Cesium
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <cstdint>
+#include <vector>
+
+namespace Cesium3DTilesSelection
+{
+    class Tile;
+}
+
+namespace Cesium
+{
+    // Controls how far ahead the tilesets select the tiles of the predicted camera views, so they are loading before the cameras get
+    // there. Cesium native has no load priority per view, so the prefetch is kept in check by its size instead: the look ahead is
+    // halved while the tiles selected only for the predicted views exceed the byte cap, and grows back slowly below it.
+    class TilePrefetcher final
+    {
+    public:
+        TilePrefetcher();
+
+        // the look ahead is in seconds
+        void Configure(float lookAhead, std::uint64_t maximumPrefetchBytes);
+
+        void Reset();
+
+        // the look ahead to predict the cameras with this frame
+        float GetLookAhead() const;
+
+        // measure the tiles that only the predicted views can see, and adjust the look ahead
+        void Update(
+            const std::vector<Cesium3DTilesSelection::ViewState>& currentViewStates,
+            const std::vector<Cesium3DTilesSelection::ViewState>& predictedViewStates,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles);
+
+        // update the look ahead from the bytes of the tiles selected only for the predicted views
+        void UpdateLookAheadScale(std::uint64_t prefetchedBytes);
+
+        std::uint32_t GetPrefetchedTileCount() const;
+
+        std::uint64_t GetPrefetchedBytes() const;
+
+        static constexpr float LOOK_AHEAD_DECREASE_FACTOR = 0.5f;
+        static constexpr float LOOK_AHEAD_INCREASE_STEP = 0.05f;
+
+        // below it, the look ahead is too short to be worth the extra traversal
+        static constexpr float MINIMUM_LOOK_AHEAD_SCALE = 0.05f;
+
+    private:
+        static bool IsVisible(const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, const Cesium3DTilesSelection::Tile& tile);
+
+        float m_lookAhead;
+        std::uint64_t m_maximumPrefetchBytes;
+        float m_lookAheadScale;
+        std::uint32_t m_prefetchedTileCount;
+        std::uint64_t m_prefetchedBytes;
+    };
+} // namespace Cesium
@@ -1,7 +1,5 @@
 #include <Cesium/TilesetUtility/TilesetCameraConfigurations.h>
-#include <Atom/RPI.Public/ViewportContext.h>
-#include <Atom/RPI.Public/ViewportContextBus.h>
-#include <Atom/RPI.Public/View.h>
+#include "Cesium/Systems/CesiumSystem.h"
 
 namespace Cesium
 {
@@ -22,52 +20,83 @@ namespace Cesium
 
     const std::vector<Cesium3DTilesSelection::ViewState>& TilesetCameraConfigurations::UpdateAndGetViewStates()
     {
-        m_viewStates.clear();
-        auto viewportManager = AZ::Interface<AZ::RPI::ViewportContextRequestsInterface>::Get();
-        if (!viewportManager)
+        CesiumSystem* cesiumSystem = CesiumInterface::Get();
+        if (!cesiumSystem)
         {
+            m_viewStates.clear();
             return m_viewStates;
         }
 
-        viewportManager->EnumerateViewportContexts(
-            [this](AZ::RPI::ViewportContextPtr viewportContextPtr) mutable
-            {
-                AzFramework::WindowSize windowSize = viewportContextPtr->GetViewportSize();
-                if (windowSize.m_width == 0 || windowSize.m_height == 0)
-                {
-                    return;
-                }
+        return cesiumSystem->GetViewStateProvider().GetViewStates(m_transform);
+    }
+
+    const std::vector<Cesium3DTilesSelection::ViewState>& TilesetCameraConfigurations::GetPredictedViewStates(float lookAhead)
+    {
+        CesiumSystem* cesiumSystem = CesiumInterface::Get();
+        if (!cesiumSystem)
+        {
+            m_viewStates.clear();
+            return m_viewStates;
+        }
+
+        return cesiumSystem->GetViewStateProvider().GetPredictedViewStates(m_transform, lookAhead);
+    }
+
+    const std::vector<Cesium3DTilesSelection::ViewState>& TilesetCameraConfigurations::GetPrefetchViewStates()
+    {
+        CesiumSystem* cesiumSystem = CesiumInterface::Get();
+        if (!cesiumSystem)
+        {
+            m_viewStates.clear();
+            return m_viewStates;
+        }
 
-                m_viewStates.emplace_back(GetViewState(viewportContextPtr, m_transform));
-            });
+        return cesiumSystem->GetViewStateProvider().GetPrefetchViewStates(m_transform);
+    }
 
-        return m_viewStates;
+    std::uint32_t TilesetCameraConfigurations::GetPrefetchViewsVersion() const
+    {
+        CesiumSystem* cesiumSystem = CesiumInterface::Get();
+        return cesiumSystem ? cesiumSystem->GetViewStateProvider().GetPrefetchViewsVersion() : 0;
     }
 
-    Cesium3DTilesSelection::ViewState TilesetCameraConfigurations::GetViewState(
-        const AZ::RPI::ViewportContextPtr& viewportContextPtr, const glm::dmat4& transform)
+    const std::vector<Cesium3DTilesSelection::ViewState>& TilesetCameraConfigurations::GetFovealViewStates()
     {
-        // Get o3de camera configuration
-        AZ::RPI::ViewPtr view = viewportContextPtr->GetDefaultView();
-        AZ::Transform o3deCameraTransform = view->GetCameraTransform();
-        AZ::Vector3 o3deCameraFwd = o3deCameraTransform.GetBasis(1);
-        AZ::Vector3 o3deCameraUp = o3deCameraTransform.GetBasis(2);
-        AZ::Vector3 o3deCameraPosition = o3deCameraTransform.GetTranslation();
-
-        // Convert o3de coordinate to cesium coordinate
-        glm::dvec3 position =
-            transform * glm::dvec4{ o3deCameraPosition.GetX(), o3deCameraPosition.GetY(), o3deCameraPosition.GetZ(), 1.0 };
-        glm::dvec3 direction = transform * glm::dvec4{ o3deCameraFwd.GetX(), o3deCameraFwd.GetY(), o3deCameraFwd.GetZ(), 0.0 };
-        glm::dvec3 up = transform * glm::dvec4{ o3deCameraUp.GetX(), o3deCameraUp.GetY(), o3deCameraUp.GetZ(), 0.0 };
-        direction = glm::normalize(direction);
-        up = glm::normalize(up);
-
-        const auto& projectMatrix = view->GetViewToClipMatrix();
-        AzFramework::WindowSize windowSize = viewportContextPtr->GetViewportSize();
-        glm::dvec2 viewportSize{ windowSize.m_width, windowSize.m_height };
-        double aspect = viewportSize.x / viewportSize.y;
-        double verticalFov = 2.0 * glm::atan(1.0 / projectMatrix.GetElement(1, 1));
-        double horizontalFov = 2.0 * glm::atan(glm::tan(verticalFov * 0.5) * aspect);
-        return Cesium3DTilesSelection::ViewState::create(position, direction, up, viewportSize, horizontalFov, verticalFov);
+        CesiumSystem* cesiumSystem = CesiumInterface::Get();
+        if (!cesiumSystem)
+        {
+            m_viewStates.clear();
+            return m_viewStates;
+        }
+
+        return cesiumSystem->GetViewStateProvider().GetFovealViewStates(m_transform);
+    }
+
+    std::uint32_t TilesetCameraConfigurations::GetViewportDetailVersion() const
+    {
+        CesiumSystem* cesiumSystem = CesiumInterface::Get();
+        return cesiumSystem ? cesiumSystem->GetViewStateProvider().GetViewportDetailVersion() : 0;
+    }
+
+    double TilesetCameraConfigurations::GetViewPriority(std::size_t viewIndex) const
+    {
+        CesiumSystem* cesiumSystem = CesiumInterface::Get();
+        return cesiumSystem ? cesiumSystem->GetViewStateProvider().GetViewPriority(viewIndex) : 1.0;
+    }
+
+    void TilesetCameraConfigurations::ReportPrefetchPending(std::size_t viewIndex)
+    {
+        if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+        {
+            cesiumSystem->GetViewStateProvider().ReportPrefetchPending(viewIndex);
+        }
+    }
+
+    void TilesetCameraConfigurations::ReportPrefetchBytes(std::size_t viewIndex, std::uint64_t bytes)
+    {
+        if (CesiumSystem* cesiumSystem = CesiumInterface::Get())
+        {
+            cesiumSystem->GetViewStateProvider().ReportPrefetchBytes(viewIndex, bytes);
+        }
     }
-} // namespace Cesium
\ No newline at end of file
+} // namespace Cesium
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <Atom/RPI.Public/Base.h>
 #include <Cesium3DTilesSelection/ViewState.h>
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <vector>
 
 namespace Cesium
@@ -16,14 +16,33 @@ namespace Cesium
 
         const glm::dmat4& GetTransform() const;
 
+        // the view states are computed once per frame by the ViewStateProvider of the Cesium system and shared with the other
+        // tilesets that have the same transform
         const std::vector<Cesium3DTilesSelection::ViewState>& UpdateAndGetViewStates();
 
-    private:
-        static Cesium3DTilesSelection::ViewState GetViewState(
-            const AZ::RPI::ViewportContextPtr& viewportContextPtr, const glm::dmat4& transform);
+        // the view states of the moving cameras lookAhead seconds in the future
+        const std::vector<Cesium3DTilesSelection::ViewState>& GetPredictedViewStates(float lookAhead);
+
+        // the views loaded ahead of time, like the destination of a camera fly
+        const std::vector<Cesium3DTilesSelection::ViewState>& GetPrefetchViewStates();
+
+        std::uint32_t GetPrefetchViewsVersion() const;
+
+        // the views around the gaze points of the foveated viewports
+        const std::vector<Cesium3DTilesSelection::ViewState>& GetFovealViewStates();
+
+        std::uint32_t GetViewportDetailVersion() const;
 
+        // the priority of the viewport of the current view state at viewIndex
+        double GetViewPriority(std::size_t viewIndex) const;
+
+        void ReportPrefetchPending(std::size_t viewIndex);
+
+        void ReportPrefetchBytes(std::size_t viewIndex, std::uint64_t bytes);
+
+    private:
         glm::dmat4 m_transform;
         std::vector<Cesium3DTilesSelection::ViewState> m_viewStates;
     };
 
-} // namespace Cesium
\ No newline at end of file
+} // namespace Cesium
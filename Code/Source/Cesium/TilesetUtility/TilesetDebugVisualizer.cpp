@@ -0,0 +1,138 @@
+#include "Cesium/TilesetUtility/TilesetDebugVisualizer.h"
+#include "Cesium/Math/BoundingVolumeConverters.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <cmath>
+#include <variant>
+
+// Window 10 wingdi.h header defines OPAQUE macro which mess up with CesiumGltf::Material::AlphaMode::OPAQUE.
+// This only happens with unity build
+#include <AzCore/PlatformDef.h>
+#ifdef AZ_COMPILER_MSVC
+#pragma push_macro("OPAQUE")
+#undef OPAQUE
+#endif
+
+#include <Cesium3DTilesSelection/Tile.h>
+
+#ifdef AZ_COMPILER_MSVC
+#pragma pop_macro("OPAQUE")
+#endif
+
+namespace Cesium
+{
+    void TilesetDebugVisualizer::Update(
+        const Cesium3DTilesSelection::Tile& rootTile,
+        const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+        const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+        const glm::dmat4& worldTransform,
+        TileLoadLatencyTracker::Clock::time_point now)
+    {
+        UpdateLoadLatencies(rootTile, now);
+
+        m_tileInfos.clear();
+        m_tileInfos.reserve(renderedTiles.size());
+        for (const Cesium3DTilesSelection::Tile* tile : renderedTiles)
+        {
+            TilesetDebugTileInfo info;
+            info.m_worldBounds = std::visit(BoundingVolumeToAABB{ worldTransform }, tile->getBoundingVolume());
+            info.m_geometricError = tile->getGeometricError();
+            for (const auto& viewState : viewStates)
+            {
+                double distance = std::sqrt(viewState.computeDistanceSquaredToBoundingVolume(tile->getBoundingVolume()));
+                info.m_screenSpaceError =
+                    AZStd::max(info.m_screenSpaceError, viewState.computeScreenSpaceError(info.m_geometricError, distance));
+            }
+
+            for (const Cesium3DTilesSelection::Tile* parent = tile->getParent(); parent; parent = parent->getParent())
+            {
+                ++info.m_depth;
+            }
+
+            info.m_loadLatency = m_loadLatencyTracker.GetLoadLatency(tile);
+            m_tileInfos.emplace_back(info);
+        }
+    }
+
+    void TilesetDebugVisualizer::Draw(AZ::RPI::AuxGeomDraw& auxGeom, const TilesetDebugConfiguration& configuration) const
+    {
+        for (const TilesetDebugTileInfo& info : m_tileInfos)
+        {
+            AZ::Color color = configuration.m_drawMode == TilesetDebugDrawMode::Depth
+                ? GetDepthColor(info.m_depth)
+                : GetLoadLatencyColor(info.m_loadLatency, configuration.m_maximumLoadLatency);
+            auxGeom.DrawAabb(info.m_worldBounds, color, AZ::RPI::AuxGeomDraw::DrawStyle::Line);
+        }
+    }
+
+    void TilesetDebugVisualizer::Reset()
+    {
+        m_loadLatencyTracker.Reset();
+        m_tileInfos = AZStd::vector<TilesetDebugTileInfo>{};
+        m_traversalStack = std::vector<const Cesium3DTilesSelection::Tile*>{};
+    }
+
+    const AZStd::vector<TilesetDebugTileInfo>& TilesetDebugVisualizer::GetTileInfos() const
+    {
+        return m_tileInfos;
+    }
+
+    AZ::Color TilesetDebugVisualizer::GetLoadLatencyColor(float loadLatency, float maximumLoadLatency)
+    {
+        if (loadLatency < 0.0f)
+        {
+            return AZ::Color(0.5f, 0.5f, 0.5f, 1.0f);
+        }
+
+        // green to yellow for the first half of the range, then yellow to red
+        float t = maximumLoadLatency > 0.0f ? AZStd::clamp(loadLatency / maximumLoadLatency, 0.0f, 1.0f) : 1.0f;
+        return AZ::Color(AZStd::min(2.0f * t, 1.0f), AZStd::min(2.0f * (1.0f - t), 1.0f), 0.0f, 1.0f);
+    }
+
+    AZ::Color TilesetDebugVisualizer::GetDepthColor(std::uint32_t depth)
+    {
+        static const AZStd::array<AZ::Color, 8> palette{
+            AZ::Color(1.0f, 0.0f, 0.0f, 1.0f), AZ::Color(1.0f, 0.5f, 0.0f, 1.0f), AZ::Color(1.0f, 1.0f, 0.0f, 1.0f),
+            AZ::Color(0.0f, 1.0f, 0.0f, 1.0f), AZ::Color(0.0f, 1.0f, 1.0f, 1.0f), AZ::Color(0.0f, 0.0f, 1.0f, 1.0f),
+            AZ::Color(0.5f, 0.0f, 1.0f, 1.0f), AZ::Color(1.0f, 0.0f, 1.0f, 1.0f),
+        };
+
+        return palette[depth % palette.size()];
+    }
+
+    void TilesetDebugVisualizer::UpdateLoadLatencies(
+        const Cesium3DTilesSelection::Tile& rootTile, TileLoadLatencyTracker::Clock::time_point now)
+    {
+        m_loadLatencyTracker.BeginFrame();
+
+        m_traversalStack.clear();
+        m_traversalStack.emplace_back(&rootTile);
+        while (!m_traversalStack.empty())
+        {
+            const Cesium3DTilesSelection::Tile* tile = m_traversalStack.back();
+            m_traversalStack.pop_back();
+
+            TileLoadPhase phase = TileLoadPhase::Unloaded;
+            switch (tile->getState())
+            {
+            case Cesium3DTilesSelection::Tile::LoadState::ContentLoading:
+            case Cesium3DTilesSelection::Tile::LoadState::ContentLoaded:
+                phase = TileLoadPhase::Loading;
+                break;
+            case Cesium3DTilesSelection::Tile::LoadState::Done:
+                phase = TileLoadPhase::Loaded;
+                break;
+            default:
+                break;
+            }
+
+            m_loadLatencyTracker.Update(tile, phase, now);
+            for (const Cesium3DTilesSelection::Tile& child : tile->getChildren())
+            {
+                m_traversalStack.emplace_back(&child);
+            }
+        }
+
+        m_loadLatencyTracker.EndFrame();
+    }
+} // namespace Cesium
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Cesium/TilesetUtility/TileLoadLatencyTracker.h"
+#include <Cesium/EBus/TilesetComponentBus.h>
+#include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/std/containers/vector.h>
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Cesium3DTilesSelection
+{
+    class Tile;
+}
+
+namespace Cesium
+{
+    // Collects the bounds, screen space error, depth and load latency of the rendered tiles, and draws their bounds with AuxGeom.
+    // The whole loaded tile tree is walked every frame to catch load transitions, so it is only meant to run while debugging.
+    class TilesetDebugVisualizer final
+    {
+    public:
+        void Update(
+            const Cesium3DTilesSelection::Tile& rootTile,
+            const std::vector<Cesium3DTilesSelection::Tile*>& renderedTiles,
+            const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+            const glm::dmat4& worldTransform,
+            TileLoadLatencyTracker::Clock::time_point now);
+
+        void Draw(AZ::RPI::AuxGeomDraw& auxGeom, const TilesetDebugConfiguration& configuration) const;
+
+        void Reset();
+
+        const AZStd::vector<TilesetDebugTileInfo>& GetTileInfos() const;
+
+        // green for fast loads, red for loads at or above the maximum latency, and grey when the latency is unknown
+        static AZ::Color GetLoadLatencyColor(float loadLatency, float maximumLoadLatency);
+
+        static AZ::Color GetDepthColor(std::uint32_t depth);
+
+    private:
+        void UpdateLoadLatencies(const Cesium3DTilesSelection::Tile& rootTile, TileLoadLatencyTracker::Clock::time_point now);
+
+        TileLoadLatencyTracker m_loadLatencyTracker;
+        AZStd::vector<TilesetDebugTileInfo> m_tileInfos;
+        std::vector<const Cesium3DTilesSelection::Tile*> m_traversalStack;
+    };
+} // namespace Cesium
@@ -0,0 +1,47 @@
+#include "Cesium/TilesetUtility/ViewUpdateCache.h"
+
+namespace Cesium
+{
+    ViewUpdateCache::ViewUpdateCache()
+        : m_valid{ false }
+    {
+    }
+
+    void ViewUpdateCache::Invalidate()
+    {
+        m_valid = false;
+    }
+
+    bool ViewUpdateCache::CanSkipUpdate(const std::vector<Cesium3DTilesSelection::ViewState>& viewStates) const
+    {
+        if (!m_valid || viewStates.empty() || viewStates.size() != m_viewStates.size())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < viewStates.size(); ++i)
+        {
+            if (!IsSameViewState(viewStates[i], m_viewStates[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void ViewUpdateCache::RecordUpdate(const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, bool loadsPending)
+    {
+        m_viewStates = viewStates;
+        m_valid = !loadsPending;
+    }
+
+    bool ViewUpdateCache::IsSameViewState(const Cesium3DTilesSelection::ViewState& lhs, const Cesium3DTilesSelection::ViewState& rhs)
+    {
+        // a parked camera produces exactly the same values every frame, so no tolerance is needed. Any tolerance would also
+        // hide a camera that moves slowly enough
+        return lhs.getPosition() == rhs.getPosition() && lhs.getDirection() == rhs.getDirection() && lhs.getUp() == rhs.getUp() &&
+            lhs.getViewportSize() == rhs.getViewportSize() && lhs.getHorizontalFieldOfView() == rhs.getHorizontalFieldOfView() &&
+            lhs.getVerticalFieldOfView() == rhs.getVerticalFieldOfView();
+    }
+} // namespace Cesium
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <vector>
+
+namespace Cesium
+{
+    // Remembers the view states of the last full tileset update and whether loads were still pending after it. When the cameras
+    // have not moved and nothing is loading, the next traversal would select the same tiles, so it can be skipped.
+    // Anything else that changes the selection, like the tileset options or transform, must call Invalidate().
+    class ViewUpdateCache final
+    {
+    public:
+        ViewUpdateCache();
+
+        void Invalidate();
+
+        bool CanSkipUpdate(const std::vector<Cesium3DTilesSelection::ViewState>& viewStates) const;
+
+        void RecordUpdate(const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, bool loadsPending);
+
+    private:
+        static bool IsSameViewState(const Cesium3DTilesSelection::ViewState& lhs, const Cesium3DTilesSelection::ViewState& rhs);
+
+        std::vector<Cesium3DTilesSelection::ViewState> m_viewStates;
+        bool m_valid;
+    };
+} // namespace Cesium
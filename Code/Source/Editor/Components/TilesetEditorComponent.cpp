@@ -97,7 +97,61 @@ namespace Cesium
                         AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_loadingDescendantLimit, "Loading Descendant Limit", "")
                     ->DataElement(AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_preloadAncestors, "Preload Ancestors", "")
                     ->DataElement(AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_preloadSiblings, "Preload Siblings", "")
-                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_forbidHole, "Forbid Hole", "");
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_forbidHole, "Forbid Hole", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_maximumPreparedTiles, "Maximum Prepared Tiles",
+                        "Maximum number of tiles prepared in the load threads and waiting for the main thread. 0 means unlimited")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_maximumPreparedBytes, "Maximum Prepared Bytes",
+                        "Maximum bytes of tiles prepared in the load threads and waiting for the main thread. 0 means unlimited")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_adaptiveScreenSpaceError, "Adaptive Screen Space Error",
+                        "Adjust the screen space error to keep the frame time and the main thread time of the tileset within budget")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_minimumAdaptiveScreenSpaceError,
+                        "Minimum Adaptive Screen Space Error", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_maximumAdaptiveScreenSpaceError,
+                        "Maximum Adaptive Screen Space Error", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_targetFrameTime, "Target Frame Time",
+                        "Frame time in milliseconds. 0 ignores the frame time")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_mainThreadBudget, "Main Thread Budget",
+                        "Main thread time in milliseconds spent on the tileset per frame. 0 ignores the main thread time")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_cacheTrimGracePeriod, "Cache Trim Grace Period",
+                        "Seconds the cache is kept after the tileset leaves the screen")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_cacheTrimDuration, "Cache Trim Duration",
+                        "Seconds over which the cache is emptied after the grace period")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_predictivePrefetch, "Predictive Prefetch",
+                        "Load the tiles where the moving cameras are heading")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_prefetchLookAhead, "Prefetch Look Ahead",
+                        "Seconds ahead the camera positions are predicted")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_maximumPrefetchBytes, "Maximum Prefetch Bytes",
+                        "Bytes of tiles selected only for the predicted camera positions")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_adaptiveTileLoads, "Adaptive Tile Loads",
+                        "Adjust the simultaneous tile loads to the latency and the throughput of the responses")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_minimumAdaptiveTileLoads,
+                        "Minimum Adaptive Tile Loads", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetConfiguration::m_maximumAdaptiveTileLoads,
+                        "Maximum Adaptive Tile Loads", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_horizonCulling, "Horizon Culling",
+                        "Hide the tiles behind the horizon of the globe, and lower the tile loads by their share")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_occlusionCulling, "Occlusion Culling",
+                        "Hide the tiles behind the ground of the loaded terrain tiles, and lower the tile loads by their share")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &TilesetConfiguration::m_shareOccluders, "Share Occluders",
+                        "The ground of the loaded terrain tiles also hides the tiles of the other tilesets");
 
                 editContext->Class<TilesetRenderConfiguration>("Render", "")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
@@ -105,7 +159,16 @@ namespace Cesium
                     ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                     ->DataElement(
                         AZ::Edit::UIHandlers::CheckBox, &TilesetRenderConfiguration::m_generateMissingNormalAsSmooth,
-                        "Generate Missing Normal As Smooth", "");
+                        "Generate Missing Normal As Smooth", "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &TilesetRenderConfiguration::m_startupSnapshot, "Startup Snapshot",
+                        "Restore the tileset json and the tiles visible when the tileset was last unloaded")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &TilesetRenderConfiguration::m_maximumSnapshotBytes, "Maximum Snapshot Bytes",
+                        "Bytes of tile contents kept for the snapshot")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &TilesetRenderConfiguration::m_rayTracingEnabled, "Ray Tracing Enabled",
+                        "Include the tiles in the ray tracing scene");
             }
         }
     }
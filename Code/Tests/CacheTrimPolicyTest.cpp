@@ -0,0 +1,85 @@
+#include "Cesium/TilesetUtility/CacheTrimPolicy.h"
+#include <AzCore/UnitTest/TestTypes.h>
+
+class CacheTrimPolicyTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static constexpr std::uint64_t CACHE_BYTES = 512ull * 1024ull * 1024ull;
+    static constexpr float FRAME_TIME = 1.0f / 60.0f;
+
+    // return the cache limit of the last frame
+    static std::uint64_t RunFrames(
+        Cesium::CacheTrimPolicy& policy, bool visible, float seconds, Cesium::MemoryPressure pressure = Cesium::MemoryPressure::Normal)
+    {
+        std::uint64_t cacheBytes = CACHE_BYTES;
+        for (float time = 0.0f; time < seconds; time += FRAME_TIME)
+        {
+            cacheBytes = policy.Update(visible, FRAME_TIME, pressure, CACHE_BYTES);
+        }
+
+        return cacheBytes;
+    }
+};
+
+TEST_F(CacheTrimPolicyTest, LookingAwayAndBackKeepsCache)
+{
+    Cesium::CacheTrimPolicy policy;
+    policy.Configure(10.0f, 5.0f);
+
+    ASSERT_EQ(RunFrames(policy, true, 1.0f), CACHE_BYTES);
+
+    // a single frame and a few seconds away are both within the grace period
+    ASSERT_EQ(policy.Update(false, FRAME_TIME, Cesium::MemoryPressure::Normal, CACHE_BYTES), CACHE_BYTES);
+    ASSERT_EQ(RunFrames(policy, true, 1.0f), CACHE_BYTES);
+    ASSERT_EQ(RunFrames(policy, false, 8.0f), CACHE_BYTES);
+    ASSERT_EQ(RunFrames(policy, true, 0.1f), CACHE_BYTES);
+
+    // coming back restarts the grace period
+    ASSERT_EQ(RunFrames(policy, false, 8.0f), CACHE_BYTES);
+    ASSERT_LT(policy.GetHiddenTime(), 10.0f);
+}
+
+TEST_F(CacheTrimPolicyTest, CacheIsTrimmedGraduallyAfterGracePeriod)
+{
+    Cesium::CacheTrimPolicy policy;
+    policy.Configure(10.0f, 5.0f);
+    ASSERT_EQ(RunFrames(policy, false, 9.9f), CACHE_BYTES);
+
+    std::uint64_t previousCacheBytes = CACHE_BYTES;
+    std::uint32_t changes = 0;
+    for (float time = 0.0f; time < 6.0f; time += FRAME_TIME)
+    {
+        std::uint64_t cacheBytes = policy.Update(false, FRAME_TIME, Cesium::MemoryPressure::Normal, CACHE_BYTES);
+        ASSERT_LE(cacheBytes, previousCacheBytes);
+        changes += cacheBytes != previousCacheBytes ? 1 : 0;
+        previousCacheBytes = cacheBytes;
+    }
+
+    ASSERT_EQ(previousCacheBytes, 0u);
+    ASSERT_EQ(changes, Cesium::CacheTrimPolicy::TRIM_STEPS);
+
+    // looking back gives the whole cache again
+    ASSERT_EQ(policy.Update(true, FRAME_TIME, Cesium::MemoryPressure::Normal, CACHE_BYTES), CACHE_BYTES);
+    ASSERT_EQ(policy.GetHiddenTime(), 0.0f);
+}
+
+TEST_F(CacheTrimPolicyTest, PressureShortensGracePeriod)
+{
+    Cesium::CacheTrimPolicy policy;
+    policy.Configure(10.0f, 5.0f);
+    ASSERT_LT(RunFrames(policy, false, 6.0f, Cesium::MemoryPressure::High), CACHE_BYTES);
+
+    policy.Reset();
+    ASSERT_LT(policy.Update(false, FRAME_TIME, Cesium::MemoryPressure::Critical, CACHE_BYTES), CACHE_BYTES);
+
+    // the budget still applies while the tileset is visible
+    ASSERT_EQ(policy.Update(true, FRAME_TIME, Cesium::MemoryPressure::Critical, CACHE_BYTES / 2), CACHE_BYTES / 2);
+}
+
+TEST_F(CacheTrimPolicyTest, ZeroDurationsTrimImmediately)
+{
+    Cesium::CacheTrimPolicy policy;
+    policy.Configure(0.0f, 0.0f);
+    ASSERT_EQ(policy.Update(false, FRAME_TIME, Cesium::MemoryPressure::Normal, CACHE_BYTES), 0u);
+    ASSERT_EQ(policy.Update(true, FRAME_TIME, Cesium::MemoryPressure::Normal, CACHE_BYTES), CACHE_BYTES);
+}
@@ -0,0 +1,96 @@
+#include "Cesium/Systems/CameraBookmarks.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <glm/glm.hpp>
+
+class CameraBookmarksTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static void AddBookmark(Cesium::CameraBookmarks& bookmarks, const char* name, std::uint64_t memoryBudgetBytes, bool keepWarm)
+    {
+        bookmarks.Add(
+            name, glm::dvec3{ 6378137.0, 0.0, 0.0 }, glm::dvec3{ -1.0, 0.0, 0.0 }, glm::dvec3{ 0.0, 0.0, 1.0 }, memoryBudgetBytes,
+            keepWarm);
+    }
+
+    // the provider finalizes the reports of the tilesets of the last frame, then the bookmarks read them
+    static AZStd::vector<AZStd::string> NextFrame(Cesium::ViewStateProvider& provider, Cesium::CameraBookmarks& bookmarks)
+    {
+        provider.SetCameras({});
+        AZStd::vector<AZStd::string> readyBookmarks;
+        bookmarks.Update(readyBookmarks);
+        return readyBookmarks;
+    }
+};
+
+TEST_F(CameraBookmarksTest, WarmBookmarkIsReadyAfterAFrameWithoutPendingReports)
+{
+    Cesium::ViewStateProvider provider;
+    Cesium::CameraBookmarks bookmarks{ provider };
+    AddBookmark(bookmarks, "Harbor", 0, true);
+    ASSERT_EQ(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).size(), 1u);
+
+    ASSERT_TRUE(NextFrame(provider, bookmarks).empty());
+    ASSERT_EQ(bookmarks.GetStatus("Harbor").m_state, Cesium::CameraBookmarkState::Preloading);
+
+    provider.ReportPrefetchPending(0);
+    ASSERT_TRUE(NextFrame(provider, bookmarks).empty());
+    ASSERT_FALSE(bookmarks.IsReady("Harbor"));
+
+    AZStd::vector<AZStd::string> readyBookmarks = NextFrame(provider, bookmarks);
+    ASSERT_EQ(readyBookmarks.size(), 1u);
+    ASSERT_EQ(readyBookmarks.front(), "Harbor");
+    ASSERT_TRUE(bookmarks.IsReady("Harbor"));
+
+    // the ready notification is only sent once, and the views are kept
+    ASSERT_TRUE(NextFrame(provider, bookmarks).empty());
+    ASSERT_EQ(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).size(), 1u);
+}
+
+TEST_F(CameraBookmarksTest, BookmarkOverItsBudgetDropsItsViews)
+{
+    Cesium::ViewStateProvider provider;
+    Cesium::CameraBookmarks bookmarks{ provider };
+    AddBookmark(bookmarks, "Airport", 1024, true);
+    AddBookmark(bookmarks, "Stadium", 0, true);
+    NextFrame(provider, bookmarks);
+
+    // two tilesets report the tiles of the first bookmark
+    provider.ReportPrefetchBytes(0, 600);
+    provider.ReportPrefetchBytes(0, 600);
+    provider.ReportPrefetchBytes(1, 4096);
+    NextFrame(provider, bookmarks);
+
+    Cesium::CameraBookmarkStatus airport = bookmarks.GetStatus("Airport");
+    ASSERT_EQ(airport.m_state, Cesium::CameraBookmarkState::OverBudget);
+    ASSERT_EQ(airport.m_loadedBytes, 1200u);
+    Cesium::CameraBookmarkStatus stadium = bookmarks.GetStatus("Stadium");
+    ASSERT_EQ(stadium.m_state, Cesium::CameraBookmarkState::Ready);
+    ASSERT_EQ(stadium.m_loadedBytes, 4096u);
+    ASSERT_EQ(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).size(), 1u);
+
+    // preloading again gives it another chance, since the tiles of the other views may have been evicted since
+    ASSERT_TRUE(bookmarks.Preload("Airport"));
+    ASSERT_EQ(bookmarks.GetStatus("Airport").m_state, Cesium::CameraBookmarkState::Preloading);
+}
+
+TEST_F(CameraBookmarksTest, ColdBookmarkIsOnlyLoadedOnRequest)
+{
+    Cesium::ViewStateProvider provider;
+    Cesium::CameraBookmarks bookmarks{ provider };
+    AddBookmark(bookmarks, "Bridge", 0, false);
+    ASSERT_EQ(bookmarks.GetStatus("Bridge").m_state, Cesium::CameraBookmarkState::Cold);
+    ASSERT_TRUE(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).empty());
+
+    ASSERT_TRUE(bookmarks.Preload("Bridge"));
+    ASSERT_EQ(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).size(), 1u);
+    NextFrame(provider, bookmarks);
+    ASSERT_EQ(NextFrame(provider, bookmarks).size(), 1u);
+
+    ASSERT_TRUE(bookmarks.Release("Bridge"));
+    ASSERT_EQ(bookmarks.GetStatus("Bridge").m_state, Cesium::CameraBookmarkState::Cold);
+    ASSERT_TRUE(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).empty());
+
+    ASSERT_FALSE(bookmarks.Preload("Unknown"));
+    ASSERT_TRUE(bookmarks.Remove("Bridge"));
+    ASSERT_TRUE(bookmarks.GetNames().empty());
+}
@@ -0,0 +1,101 @@
+#include "Cesium/Systems/DestinationPrefetch.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <glm/glm.hpp>
+
+class DestinationPrefetchTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static AZStd::vector<Cesium::ViewportCamera> CreateEcefCameras(std::size_t count)
+    {
+        AZStd::vector<Cesium::ViewportCamera> cameras;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Cesium::ViewportCamera camera;
+            camera.m_position = glm::dvec3{ 6378137.0 + 100.0 * static_cast<double>(i), 0.0, 0.0 };
+            camera.m_direction = glm::dvec3{ -1.0, 0.0, 0.0 };
+            camera.m_up = glm::dvec3{ 0.0, 0.0, 1.0 };
+            camera.m_viewportSize = glm::dvec2{ 1920.0, 1080.0 };
+            camera.m_horizontalFieldOfView = glm::radians(90.0);
+            camera.m_verticalFieldOfView = glm::radians(60.0);
+            cameras.emplace_back(camera);
+        }
+
+        return cameras;
+    }
+
+    // the provider finalizes the reports of the tilesets of the last frame, then the destination reads them
+    static void NextFrame(Cesium::ViewStateProvider& provider, Cesium::DestinationPrefetch& prefetch)
+    {
+        provider.SetCameras({});
+        prefetch.Update(provider);
+    }
+
+    const glm::dvec3 m_destination{ 6378137.0, 0.0, 0.0 };
+};
+
+TEST_F(DestinationPrefetchTest, DestinationIsReadyOnceTheTilesetsStopReportingPending)
+{
+    Cesium::ViewStateProvider provider;
+    Cesium::DestinationPrefetch prefetch;
+    std::uint32_t readyCount = 0;
+    glm::dvec3 readyDestination{ 0.0 };
+    Cesium::CameraDestinationReadyEvent::Handler handler(
+        [&readyCount, &readyDestination](const glm::dvec3& destination)
+        {
+            ++readyCount;
+            readyDestination = destination;
+        });
+    prefetch.BindReadyEventHandler(handler);
+
+    prefetch.Start(provider, m_destination, CreateEcefCameras(2));
+    ASSERT_TRUE(prefetch.IsPending());
+    ASSERT_EQ(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).size(), 2u);
+
+    // a tileset still misses the tiles of the last waypoint
+    NextFrame(provider, prefetch);
+    provider.ReportPrefetchPending(1);
+    NextFrame(provider, prefetch);
+    ASSERT_FALSE(prefetch.IsReady());
+    ASSERT_EQ(readyCount, 0u);
+
+    NextFrame(provider, prefetch);
+    ASSERT_TRUE(prefetch.IsReady());
+    ASSERT_FALSE(prefetch.IsPending());
+    ASSERT_EQ(readyCount, 1u);
+    ASSERT_EQ(readyDestination, m_destination);
+
+    // the views are removed with the ready event, so it's only signaled once
+    ASSERT_TRUE(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).empty());
+    NextFrame(provider, prefetch);
+    ASSERT_EQ(readyCount, 1u);
+}
+
+TEST_F(DestinationPrefetchTest, NewDestinationReplacesTheViewsOfTheLastOne)
+{
+    Cesium::ViewStateProvider provider;
+    Cesium::DestinationPrefetch prefetch;
+    std::uint32_t readyCount = 0;
+    Cesium::CameraDestinationReadyEvent::Handler handler(
+        [&readyCount](const glm::dvec3&)
+        {
+            ++readyCount;
+        });
+    prefetch.BindReadyEventHandler(handler);
+
+    prefetch.Start(provider, m_destination, CreateEcefCameras(1));
+    NextFrame(provider, prefetch);
+    NextFrame(provider, prefetch);
+    ASSERT_TRUE(prefetch.IsReady());
+
+    // a new fly forgets the readiness of the last destination
+    prefetch.Start(provider, m_destination * 2.0, CreateEcefCameras(3));
+    ASSERT_FALSE(prefetch.IsReady());
+    ASSERT_EQ(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).size(), 3u);
+
+    prefetch.Stop(provider);
+    ASSERT_FALSE(prefetch.IsPending());
+    ASSERT_TRUE(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).empty());
+    NextFrame(provider, prefetch);
+    ASSERT_FALSE(prefetch.IsReady());
+    ASSERT_EQ(readyCount, 1u);
+}
@@ -0,0 +1,131 @@
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/TaskProcessor.h"
+#include "Cesium/Systems/VirtualClock.h"
+#include "Cesium/TilesetUtility/LoadPipelineThrottle.h"
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <CesiumAsync/AsyncSystem.h>
+#include <chrono>
+#include <memory>
+
+class DeterministicExecutionTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static AZStd::vector<int> RunNestedTasks()
+    {
+        Cesium::DeterministicTaskQueue queue;
+        CesiumAsync::AsyncSystem asyncSystem{ std::make_shared<Cesium::TaskProcessor>(&queue) };
+
+        AZStd::vector<int> order;
+        for (int i = 0; i < 4; ++i)
+        {
+            asyncSystem
+                .runInWorkerThread(
+                    [i, &order]()
+                    {
+                        order.emplace_back(i);
+                        return i;
+                    })
+                .thenInWorkerThread(
+                    [&order](int value)
+                    {
+                        order.emplace_back(value + 10);
+                    });
+        }
+
+        queue.RunPending();
+        return order;
+    }
+};
+
+TEST_F(DeterministicExecutionTest, RunTasksInSubmissionOrder)
+{
+    Cesium::DeterministicTaskQueue queue;
+    AZStd::vector<int> order;
+    queue.Push(
+        [&queue, &order]()
+        {
+            order.emplace_back(0);
+            queue.Push(
+                [&order]()
+                {
+                    order.emplace_back(2);
+                });
+        });
+    queue.Push(
+        [&order]()
+        {
+            order.emplace_back(1);
+        });
+
+    ASSERT_TRUE(order.empty());
+    ASSERT_EQ(queue.GetPendingCount(), 2u);
+    ASSERT_EQ(queue.RunPending(), 3u);
+    ASSERT_EQ(queue.GetPendingCount(), 0u);
+    ASSERT_EQ(order, AZStd::vector<int>({ 0, 1, 2 }));
+}
+
+TEST_F(DeterministicExecutionTest, TaskProcessorRunsOnCallingThread)
+{
+    Cesium::DeterministicTaskQueue queue;
+    Cesium::TaskProcessor processor(&queue);
+
+    AZStd::thread::id taskThread;
+    processor.startTask(
+        [&taskThread]()
+        {
+            taskThread = AZStd::this_thread::get_id();
+        });
+
+    queue.RunPending();
+    ASSERT_EQ(taskThread, AZStd::this_thread::get_id());
+}
+
+TEST_F(DeterministicExecutionTest, AsyncContinuationsHaveIdenticalOrderAcrossRuns)
+{
+    AZStd::vector<int> firstRun = RunNestedTasks();
+    AZStd::vector<int> secondRun = RunNestedTasks();
+    ASSERT_EQ(firstRun.size(), 8u);
+    ASSERT_EQ(firstRun, secondRun);
+}
+
+TEST_F(DeterministicExecutionTest, FullLoadPipelineDoesNotStallMainThread)
+{
+    // the load tasks run on the main thread, which is also the only one that can consume the prepared tiles
+    Cesium::DeterministicTaskQueue queue;
+    Cesium::LoadPipelineThrottle throttle;
+    throttle.SetLimits(1, 0);
+    for (int i = 0; i < 8; ++i)
+    {
+        queue.Push(
+            [&throttle]()
+            {
+                throttle.Acquire();
+                throttle.Commit(10);
+            });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    queue.RunPending();
+    ASSERT_LT(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(500));
+    ASSERT_EQ(throttle.GetMetrics().m_pipelineDepth, 8u);
+
+    // the next loads wait for the main thread to consume the tiles instead
+    ASSERT_EQ(throttle.LimitLoads(4), 0u);
+}
+
+TEST_F(DeterministicExecutionTest, VirtualClockUsesFixedStep)
+{
+    Cesium::VirtualClock clock;
+    ASSERT_FLOAT_EQ(clock.GetDeltaTime(0.3f), 0.3f);
+
+    clock.Enable(0.1f);
+    ASSERT_FLOAT_EQ(clock.GetDeltaTime(0.3f), 0.1f);
+    clock.Advance(0.3f);
+    clock.Advance(0.05f);
+    ASSERT_NEAR(clock.GetElapsedTime(), 0.2, 1e-6);
+
+    clock.Disable();
+    ASSERT_FLOAT_EQ(clock.GetDeltaTime(0.3f), 0.3f);
+}
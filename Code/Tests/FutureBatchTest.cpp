@@ -0,0 +1,206 @@
+#include "Cesium/Systems/FutureBatch.h"
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/GenericAssetAccessor.h"
+#include "Cesium/Systems/TaskProcessor.h"
+#include "SyntheticTileset.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+class FutureBatchTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    void SetUp() override
+    {
+        UnitTest::AllocatorsTestFixture::SetUp();
+        m_asyncSystem = std::make_unique<CesiumAsync::AsyncSystem>(std::make_shared<Cesium::TaskProcessor>(&m_taskQueue));
+    }
+
+    void TearDown() override
+    {
+        m_asyncSystem.reset();
+        UnitTest::AllocatorsTestFixture::TearDown();
+    }
+
+    Cesium::DeterministicTaskQueue m_taskQueue;
+    std::unique_ptr<CesiumAsync::AsyncSystem> m_asyncSystem;
+};
+
+TEST_F(FutureBatchTest, ResultsKeepTheOrderOfTheFutures)
+{
+    std::vector<CesiumAsync::Promise<int>> promises;
+    Cesium::FutureBatch<int> batch{ *m_asyncSystem };
+    for (int i = 0; i < 4; ++i)
+    {
+        promises.emplace_back(m_asyncSystem->createPromise<int>());
+        batch.Add(promises.back().getFuture());
+    }
+
+    ASSERT_EQ(batch.GetSize(), 4u);
+    CesiumAsync::Future<std::vector<int>> future = std::move(batch).WhenAll();
+    for (int i = 3; i >= 0; --i)
+    {
+        promises[i].resolve(i * 10);
+    }
+
+    m_taskQueue.RunPending();
+    std::vector<int> results = std::move(future).wait();
+    ASSERT_EQ(results, (std::vector<int>{ 0, 10, 20, 30 }));
+}
+
+TEST_F(FutureBatchTest, EmptyBatchResolvesImmediately)
+{
+    Cesium::FutureBatch<int> batch{ *m_asyncSystem };
+    std::vector<int> results = std::move(batch).WhenAll().wait();
+    ASSERT_TRUE(results.empty());
+}
+
+TEST_F(FutureBatchTest, RejectedFutureRejectsTheBatch)
+{
+    Cesium::FutureBatch<int> batch{ *m_asyncSystem };
+    batch.Add(m_asyncSystem->createResolvedFuture(1));
+    CesiumAsync::Promise<int> rejected = m_asyncSystem->createPromise<int>();
+    batch.Add(rejected.getFuture());
+    CesiumAsync::Future<std::vector<int>> future = std::move(batch).WhenAll();
+    rejected.reject(std::runtime_error("missing"));
+
+    m_taskQueue.RunPending();
+    ASSERT_THROW(std::move(future).wait(), std::exception);
+}
+
+TEST_F(FutureBatchTest, AccessorBatchMatchesSingleRequests)
+{
+    CesiumTests::InMemoryIOManager ioManager;
+    ioManager.AddFile("a.glb", "a", 1);
+    ioManager.AddFile("b.glb", "bb", 2);
+    ioManager.SetLatency(1);
+    Cesium::GenericAssetAccessor accessor{ &ioManager, "application/octet-stream" };
+
+    auto future = accessor.RequestAssets(*m_asyncSystem, { "o3de:a.glb", "b.glb", "o3de:missing.glb" });
+    ioManager.AdvanceFrame();
+    m_taskQueue.RunPending();
+    std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>> requests = std::move(future).wait();
+
+    // the urls get the prefix back, like the ones of requestAsset, so cesium native can resolve the relative urls against them
+    ASSERT_EQ(requests.size(), 3u);
+    ASSERT_EQ(requests[0]->url(), "o3de:a.glb");
+    ASSERT_EQ(requests[0]->response()->statusCode(), 200);
+    ASSERT_EQ(requests[0]->response()->data().size(), 1u);
+    ASSERT_EQ(requests[1]->url(), "o3de:b.glb");
+    ASSERT_EQ(requests[1]->response()->data().size(), 2u);
+    ASSERT_EQ(requests[2]->response()->statusCode(), 404);
+
+    auto single = accessor.requestAsset(*m_asyncSystem, "o3de:b.glb");
+    ioManager.AdvanceFrame();
+    m_taskQueue.RunPending();
+    std::shared_ptr<CesiumAsync::IAssetRequest> request = std::move(single).wait();
+    ASSERT_EQ(request->url(), requests[1]->url());
+    ASSERT_EQ(request->response()->data().size(), requests[1]->response()->data().size());
+}
+
+#if defined(HAVE_BENCHMARK)
+// A batch of asset requests answered one frame later, either with a continuation per request like cesium native issues them, or
+// joined with a FutureBatch and handed to one continuation. The argument is the number of requests
+class FutureBatchBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+protected:
+    static std::vector<std::string> CreateUrls(std::size_t count)
+    {
+        std::vector<std::string> urls;
+        urls.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            urls.emplace_back("o3de:tiles/" + std::to_string(i) + ".glb");
+        }
+
+        return urls;
+    }
+
+    static constexpr char TILE_CONTENT[] = "glTF";
+};
+
+BENCHMARK_DEFINE_F(FutureBatchBenchmark, LambdaChain)(benchmark::State& state)
+{
+    Cesium::DeterministicTaskQueue taskQueue;
+    CesiumAsync::AsyncSystem asyncSystem{ std::make_shared<Cesium::TaskProcessor>(&taskQueue) };
+    CesiumTests::InMemoryIOManager ioManager;
+    ioManager.SetDefaultFile(TILE_CONTENT, sizeof(TILE_CONTENT));
+    ioManager.SetLatency(1);
+    Cesium::GenericAssetAccessor accessor{ &ioManager, "application/octet-stream" };
+    std::vector<std::string> urls = CreateUrls(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t responseBytes = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::vector<CesiumAsync::Future<std::size_t>> futures;
+        futures.reserve(urls.size());
+        for (const std::string& url : urls)
+        {
+            auto countBytes = [](std::shared_ptr<CesiumAsync::IAssetRequest>&& request)
+            {
+                return request->response()->data().size();
+            };
+
+            futures.emplace_back(accessor.requestAsset(asyncSystem, url).thenImmediately(countBytes));
+        }
+
+        ioManager.AdvanceFrame();
+        taskQueue.RunPending();
+        responseBytes = 0;
+        for (CesiumAsync::Future<std::size_t>& future : futures)
+        {
+            responseBytes += std::move(future).wait();
+        }
+
+        benchmark::DoNotOptimize(responseBytes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * urls.size());
+    state.counters["ResponseBytes"] = static_cast<double>(responseBytes);
+}
+
+BENCHMARK_DEFINE_F(FutureBatchBenchmark, Batch)(benchmark::State& state)
+{
+    Cesium::DeterministicTaskQueue taskQueue;
+    CesiumAsync::AsyncSystem asyncSystem{ std::make_shared<Cesium::TaskProcessor>(&taskQueue) };
+    CesiumTests::InMemoryIOManager ioManager;
+    ioManager.SetDefaultFile(TILE_CONTENT, sizeof(TILE_CONTENT));
+    ioManager.SetLatency(1);
+    Cesium::GenericAssetAccessor accessor{ &ioManager, "application/octet-stream" };
+    std::vector<std::string> urls = CreateUrls(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t responseBytes = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        auto countBytes = [](std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>>&& requests)
+        {
+            std::size_t bytes = 0;
+            for (const auto& request : requests)
+            {
+                bytes += request->response()->data().size();
+            }
+
+            return bytes;
+        };
+
+        CesiumAsync::Future<std::size_t> future = accessor.RequestAssets(asyncSystem, urls).thenImmediately(countBytes);
+        ioManager.AdvanceFrame();
+        taskQueue.RunPending();
+        responseBytes = std::move(future).wait();
+        benchmark::DoNotOptimize(responseBytes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * urls.size());
+    state.counters["ResponseBytes"] = static_cast<double>(responseBytes);
+}
+
+BENCHMARK_REGISTER_F(FutureBatchBenchmark, LambdaChain)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(FutureBatchBenchmark, Batch)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+#endif
@@ -0,0 +1,118 @@
+#include "Cesium/Systems/HttpMetrics.h"
+#include <AzCore/UnitTest/TestTypes.h>
+
+class HttpMetricsTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static const Cesium::HttpHostMetrics* FindHost(const Cesium::HttpMetricsSnapshot& snapshot, const AZStd::string& host)
+    {
+        for (const auto& hostMetrics : snapshot.m_hosts)
+        {
+            if (hostMetrics.m_host == host)
+            {
+                return &hostMetrics;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+TEST_F(HttpMetricsTest, HistogramPercentilesUsePowerOfTwoBuckets)
+{
+    Cesium::HttpHistogram histogram;
+    ASSERT_EQ(histogram.GetPercentile(0.5), 0u);
+
+    histogram.Add(0);
+    histogram.Add(3);
+    histogram.Add(100);
+    histogram.Add(1000);
+
+    ASSERT_EQ(histogram.m_count, 4u);
+    ASSERT_EQ(histogram.m_max, 1000u);
+    ASSERT_EQ(histogram.m_buckets[0], 1u);
+    ASSERT_EQ(histogram.m_buckets[2], 1u);
+    ASSERT_EQ(histogram.m_buckets[7], 1u);
+    ASSERT_EQ(histogram.m_buckets[10], 1u);
+    ASSERT_DOUBLE_EQ(histogram.GetMean(), 275.75);
+    ASSERT_EQ(histogram.GetPercentile(0.25), 0u);
+    ASSERT_EQ(histogram.GetPercentile(0.5), 3u);
+    ASSERT_EQ(histogram.GetPercentile(0.75), 127u);
+    ASSERT_EQ(histogram.GetPercentile(1.0), 1000u);
+}
+
+TEST_F(HttpMetricsTest, RecordRequestsPerHost)
+{
+    Cesium::HttpMetrics metrics;
+    metrics.RecordEnqueue();
+    metrics.RecordEnqueue();
+    metrics.RecordStart("a.com", 10);
+
+    Cesium::HttpMetricsSnapshot snapshot = metrics.GetSnapshot();
+    ASSERT_EQ(snapshot.m_queuedRequests, 1u);
+    ASSERT_EQ(snapshot.m_activeRequests, 1u);
+    ASSERT_EQ(FindHost(snapshot, "a.com")->m_activeRequests, 1u);
+
+    metrics.RecordStart("b.com", 20);
+    metrics.RecordFinish("a.com", 200, 50, 80, 4096);
+    metrics.RecordFinish("b.com", 503, 5, 6, 0);
+    metrics.RecordDecompression("a.com", 1000, 4000);
+
+    snapshot = metrics.GetSnapshot();
+    ASSERT_EQ(snapshot.m_hosts.size(), 2u);
+    ASSERT_EQ(snapshot.m_queuedRequests, 0u);
+    ASSERT_EQ(snapshot.m_activeRequests, 0u);
+    ASSERT_EQ(snapshot.m_peakActiveRequests, 2u);
+
+    const Cesium::HttpHostMetrics* hostA = FindHost(snapshot, "a.com");
+    ASSERT_NE(hostA, nullptr);
+    ASSERT_EQ(hostA->m_requestCount, 1u);
+    ASSERT_EQ(hostA->m_successfulResponses, 1u);
+    ASSERT_EQ(hostA->m_queueWait.m_sum, 10u);
+    ASSERT_EQ(hostA->m_timeToFirstByte.m_sum, 50u);
+    ASSERT_EQ(hostA->m_latency.m_sum, 80u);
+    ASSERT_EQ(hostA->m_bytes.m_sum, 4096u);
+    ASSERT_EQ(hostA->m_compressedBytes, 1000u);
+    ASSERT_EQ(hostA->m_decompressedBytes, 4000u);
+
+    const Cesium::HttpHostMetrics* hostB = FindHost(snapshot, "b.com");
+    ASSERT_NE(hostB, nullptr);
+    ASSERT_EQ(hostB->m_serverErrorResponses, 1u);
+    ASSERT_EQ(hostB->m_successfulResponses, 0u);
+}
+
+TEST_F(HttpMetricsTest, FailedRequestsAreNotInLatencyHistograms)
+{
+    Cesium::HttpMetrics metrics;
+    metrics.RecordEnqueue();
+    metrics.RecordStart("a.com", 0);
+    metrics.RecordFinish("a.com", 0, 0, 30000000, 0);
+
+    Cesium::HttpMetricsSnapshot snapshot = metrics.GetSnapshot();
+    const Cesium::HttpHostMetrics* host = FindHost(snapshot, "a.com");
+    ASSERT_EQ(host->m_failedRequests, 1u);
+    ASSERT_EQ(host->m_latency.m_count, 0u);
+}
+
+TEST_F(HttpMetricsTest, ResetKeepsRequestsInFlight)
+{
+    Cesium::HttpMetrics metrics;
+    metrics.RecordEnqueue();
+    metrics.RecordEnqueue();
+    metrics.RecordStart("a.com", 10);
+    metrics.RecordFinish("a.com", 200, 1, 2, 3);
+    metrics.RecordStart("a.com", 10);
+    metrics.Reset();
+
+    Cesium::HttpMetricsSnapshot snapshot = metrics.GetSnapshot();
+    const Cesium::HttpHostMetrics* host = FindHost(snapshot, "a.com");
+    ASSERT_EQ(host->m_requestCount, 0u);
+    ASSERT_EQ(host->m_queueWait.m_count, 0u);
+    ASSERT_EQ(host->m_activeRequests, 1u);
+    ASSERT_EQ(snapshot.m_activeRequests, 1u);
+
+    metrics.RecordFinish("a.com", 404, 1, 2, 3);
+    snapshot = metrics.GetSnapshot();
+    ASSERT_EQ(snapshot.m_activeRequests, 0u);
+    ASSERT_EQ(FindHost(snapshot, "a.com")->m_clientErrorResponses, 1u);
+}
@@ -0,0 +1,183 @@
+#include "Cesium/TilesetUtility/LoadConcurrencyController.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+class LoadConcurrencyControllerTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    // A throttled HTTP server stand-in. Every request waits for the round trip, then the requests share the bandwidth equally.
+    // The tileset json is requested alone, then the loader always has more tiles to request than the limit allows
+    struct ThrottledLink
+    {
+        struct Request
+        {
+            double m_begin;
+            double m_remainingBytes;
+        };
+
+        double m_roundTripTime;
+        double m_bandwidth;
+        double m_responseBytes;
+        std::uint32_t m_failureLoads;
+        double m_time{ 0.0 };
+        std::uint32_t m_responses{ 0 };
+        std::vector<Request> m_requests;
+
+        ThrottledLink(double roundTripTime, double bandwidth, double responseBytes, std::uint32_t failureLoads = UINT32_MAX)
+            : m_roundTripTime{ roundTripTime }
+            , m_bandwidth{ bandwidth }
+            , m_responseBytes{ responseBytes }
+            , m_failureLoads{ failureLoads }
+        {
+        }
+
+        std::uint32_t Step(Cesium::LoadConcurrencyController& controller, double frameTime)
+        {
+            std::uint32_t loads = m_responses > 0 ? controller.GetLimit() : 1;
+            while (m_requests.size() < loads)
+            {
+                m_requests.push_back(Request{ m_time, m_responseBytes });
+            }
+
+            // the server rejects the requests over its own limit
+            bool failed = m_requests.size() > m_failureLoads;
+            std::uint32_t peakLoadsInFlight = static_cast<std::uint32_t>(m_requests.size());
+            m_time += frameTime;
+            std::size_t transferring = std::count_if(
+                m_requests.begin(), m_requests.end(),
+                [this](const Request& request)
+                {
+                    return m_time - request.m_begin >= m_roundTripTime;
+                });
+
+            for (auto it = m_requests.begin(); it != m_requests.end();)
+            {
+                if (m_time - it->m_begin >= m_roundTripTime)
+                {
+                    it->m_remainingBytes -= m_bandwidth * frameTime / static_cast<double>(transferring);
+                }
+
+                if (it->m_remainingBytes <= 0.0)
+                {
+                    controller.RecordResponse(m_time - it->m_begin, static_cast<std::uint64_t>(m_responseBytes), failed);
+                    it = m_requests.erase(it);
+                    ++m_responses;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            return controller.Update(frameTime, peakLoadsInFlight);
+        }
+
+        std::uint32_t Run(Cesium::LoadConcurrencyController& controller, double seconds)
+        {
+            std::uint32_t limit = controller.GetLimit();
+            for (double time = 0.0; time < seconds; time += FRAME_TIME)
+            {
+                limit = Step(controller, FRAME_TIME);
+            }
+
+            return limit;
+        }
+    };
+
+    void SetUp() override
+    {
+        UnitTest::AllocatorsTestFixture::SetUp();
+        m_controller.Configure(1, 100);
+        m_controller.Reset(20);
+    }
+
+    static constexpr double FRAME_TIME = 1.0 / 60.0;
+
+    Cesium::LoadConcurrencyController m_controller;
+};
+
+TEST_F(LoadConcurrencyControllerTest, FastLinkGrowsToMaximum)
+{
+    ThrottledLink link{ 0.002, 1000.0 * 1024.0 * 1024.0, 64.0 * 1024.0 };
+    ASSERT_EQ(link.Run(m_controller, 120.0), 100u);
+}
+
+TEST_F(LoadConcurrencyControllerTest, ThrottledLinkSettlesNearItsKnee)
+{
+    // the round trip takes as long as the transfer of a tile, so two loads fill the link
+    ThrottledLink link{ 0.2, 256.0 * 1024.0, 51.2 * 1024.0 };
+    link.Run(m_controller, 60.0);
+    std::uint32_t highest = 0;
+    for (double time = 0.0; time < 60.0; time += FRAME_TIME)
+    {
+        highest = std::max(highest, link.Step(m_controller, FRAME_TIME));
+    }
+
+    ASSERT_LE(highest, 6u);
+}
+
+TEST_F(LoadConcurrencyControllerTest, BandwidthBoundLinkStaysBelowMaximum)
+{
+    ThrottledLink link{ 0.1, 5.0 * 1024.0 * 1024.0, 128.0 * 1024.0 };
+    std::uint32_t limit = link.Run(m_controller, 120.0);
+    ASSERT_GE(limit, 4u);
+    ASSERT_LE(limit, 20u);
+}
+
+TEST_F(LoadConcurrencyControllerTest, FailuresKeepLimitUnderServerLimit)
+{
+    ThrottledLink link{ 0.002, 1000.0 * 1024.0 * 1024.0, 64.0 * 1024.0, 30 };
+    link.Run(m_controller, 60.0);
+    std::uint32_t highest = 0;
+    for (double time = 0.0; time < 60.0; time += FRAME_TIME)
+    {
+        highest = std::max(highest, link.Step(m_controller, FRAME_TIME));
+    }
+
+    ASSERT_LE(highest, 31u);
+}
+
+TEST_F(LoadConcurrencyControllerTest, FailedWindowHalvesLimit)
+{
+    for (std::uint32_t i = 0; i < 20; ++i)
+    {
+        m_controller.RecordResponse(0.1, 1024, i == 0);
+    }
+
+    ASSERT_EQ(m_controller.Update(0.1, 20), 10u);
+}
+
+TEST_F(LoadConcurrencyControllerTest, IdleLinkKeepsLimit)
+{
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(m_controller.Update(FRAME_TIME, 0), 20u);
+    }
+}
+
+TEST_F(LoadConcurrencyControllerTest, UnsaturatedLimitDoesNotGrow)
+{
+    // a handful of tiles left to load never needs more loads, however fast they come back
+    for (std::uint32_t i = 0; i < 100; ++i)
+    {
+        for (std::uint32_t j = 0; j < 20; ++j)
+        {
+            m_controller.RecordResponse(0.01, 1024, false);
+        }
+
+        m_controller.Update(0.1, 5);
+    }
+
+    ASSERT_EQ(m_controller.GetLimit(), 20u);
+}
+
+TEST_F(LoadConcurrencyControllerTest, ResetClampsToBounds)
+{
+    m_controller.Configure(4, 50);
+    m_controller.Reset(200);
+    ASSERT_EQ(m_controller.GetLimit(), 50u);
+    m_controller.Reset(0);
+    ASSERT_EQ(m_controller.GetLimit(), 4u);
+}
@@ -0,0 +1,96 @@
+#include "Cesium/TilesetUtility/LoadPipelineThrottle.h"
+#include <AzCore/UnitTest/TestTypes.h>
+
+class LoadPipelineThrottleTest : public UnitTest::AllocatorsTestFixture
+{
+};
+
+TEST_F(LoadPipelineThrottleTest, TrackDepthAndBytesInFlight)
+{
+    Cesium::LoadPipelineThrottle throttle;
+    throttle.Acquire();
+    throttle.Commit(100);
+    throttle.Acquire();
+    throttle.Commit(50);
+
+    auto metrics = throttle.GetMetrics();
+    ASSERT_EQ(metrics.m_pipelineDepth, 2u);
+    ASSERT_EQ(metrics.m_bytesInFlight, 150u);
+
+    throttle.Release(100);
+    metrics = throttle.GetMetrics();
+    ASSERT_EQ(metrics.m_pipelineDepth, 1u);
+    ASSERT_EQ(metrics.m_bytesInFlight, 50u);
+    ASSERT_EQ(metrics.m_peakPipelineDepth, 2u);
+    ASSERT_EQ(metrics.m_peakBytesInFlight, 150u);
+    ASSERT_EQ(metrics.m_throttledLoads, 0u);
+}
+
+TEST_F(LoadPipelineThrottleTest, LoadsAreHeldBackWhilePipelineIsFull)
+{
+    Cesium::LoadPipelineThrottle throttle;
+    throttle.SetLimits(4, 0);
+    ASSERT_EQ(throttle.LimitLoads(20), 4u);
+    ASSERT_EQ(throttle.GetMetrics().m_throttledLoads, 1u);
+
+    // the load thread never waits, the room is taken from the next loads
+    throttle.Acquire();
+    throttle.Acquire();
+    throttle.Acquire();
+    ASSERT_EQ(throttle.LimitLoads(20), 1u);
+    throttle.Acquire();
+    ASSERT_EQ(throttle.LimitLoads(20), 0u);
+    ASSERT_EQ(throttle.LimitLoads(0), 0u);
+
+    throttle.Release(0);
+    throttle.Release(0);
+    ASSERT_EQ(throttle.LimitLoads(20), 2u);
+    ASSERT_EQ(throttle.LimitLoads(1), 1u);
+    ASSERT_EQ(throttle.GetMetrics().m_throttledLoads, 4u);
+}
+
+TEST_F(LoadPipelineThrottleTest, ByteLimitHoldsBackLoads)
+{
+    Cesium::LoadPipelineThrottle throttle;
+    throttle.SetLimits(0, 100);
+    ASSERT_EQ(throttle.LimitLoads(8), 8u);
+
+    throttle.Acquire();
+    throttle.Commit(200);
+    ASSERT_EQ(throttle.LimitLoads(8), 0u);
+
+    throttle.Release(200);
+    ASSERT_EQ(throttle.LimitLoads(8), 8u);
+}
+
+TEST_F(LoadPipelineThrottleTest, StrandedTilesDoNotHoldBackLoads)
+{
+    Cesium::LoadPipelineThrottle throttle;
+    throttle.SetLimits(2, 0);
+    throttle.Acquire();
+    throttle.Acquire();
+    ASSERT_EQ(throttle.LimitLoads(4), 0u);
+
+    // the tiles are consumed every frame at first, then the camera moves away from the last ones
+    throttle.Release(0);
+    throttle.Acquire();
+    throttle.Update();
+    for (std::uint32_t frame = 1; frame < Cesium::LoadPipelineThrottle::STRANDED_FRAME_COUNT; ++frame)
+    {
+        throttle.Update();
+    }
+
+    ASSERT_EQ(throttle.GetMetrics().m_strandedTiles, 0u);
+    throttle.Update();
+    ASSERT_EQ(throttle.GetMetrics().m_strandedTiles, 2u);
+    ASSERT_EQ(throttle.LimitLoads(4), 2u);
+
+    // the new tiles count again, and a stranded tile freed by the cache leaves the pipeline
+    throttle.Acquire();
+    ASSERT_EQ(throttle.LimitLoads(4), 1u);
+    throttle.Release(0);
+    throttle.Release(0);
+    auto metrics = throttle.GetMetrics();
+    ASSERT_EQ(metrics.m_pipelineDepth, 1u);
+    ASSERT_EQ(metrics.m_strandedTiles, 1u);
+}
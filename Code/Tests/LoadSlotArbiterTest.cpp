@@ -0,0 +1,112 @@
+#include "Cesium/Systems/LoadSlotArbiter.h"
+#include <AzCore/UnitTest/TestTypes.h>
+
+class LoadSlotArbiterTest : public UnitTest::AllocatorsTestFixture
+{
+};
+
+TEST_F(LoadSlotArbiterTest, SlotsAreSharedByScreenContribution)
+{
+    Cesium::LoadSlotArbiter arbiter{ 40, 2 };
+    Cesium::LoadSlotArbiter::ConsumerId terrain = arbiter.AddConsumer();
+    Cesium::LoadSlotArbiter::ConsumerId background = arbiter.AddConsumer();
+
+    // consumers keep their own loads until the first rebalance
+    arbiter.ReportDemand(terrain, 40, 500, 0.75);
+    arbiter.ReportDemand(background, 40, 500, 0.25);
+    ASSERT_EQ(arbiter.GetAllocation(terrain), 40u);
+
+    // both get the minimum, then the 36 slots left are shared 27 / 9
+    arbiter.Rebalance();
+    ASSERT_EQ(arbiter.GetAllocation(terrain), 29u);
+    ASSERT_EQ(arbiter.GetAllocation(background), 11u);
+    ASSERT_EQ(arbiter.GetStatus().m_allocatedLoadSlots, 40u);
+    ASSERT_EQ(arbiter.GetStatus().m_throttledConsumerCount, 2u);
+}
+
+TEST_F(LoadSlotArbiterTest, EightTilesetsStayWithinGlobalSlots)
+{
+    Cesium::LoadSlotArbiter arbiter{ 64, 2 };
+    Cesium::LoadSlotArbiter::ConsumerId consumers[8];
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        consumers[i] = arbiter.AddConsumer();
+        arbiter.ReportDemand(consumers[i], 20, 100, i == 0 ? 0.9 : 0.01);
+    }
+
+    arbiter.Rebalance();
+    ASSERT_EQ(arbiter.GetStatus().m_allocatedLoadSlots, 64u);
+    ASSERT_EQ(arbiter.GetAllocation(consumers[0]), 20u);
+    for (std::size_t i = 1; i < 8; ++i)
+    {
+        ASSERT_GE(arbiter.GetAllocation(consumers[i]), 2u);
+    }
+}
+
+TEST_F(LoadSlotArbiterTest, UnusedShareIsGivenToOtherConsumers)
+{
+    Cesium::LoadSlotArbiter arbiter{ 40, 2 };
+    Cesium::LoadSlotArbiter::ConsumerId idle = arbiter.AddConsumer();
+    Cesium::LoadSlotArbiter::ConsumerId loading = arbiter.AddConsumer();
+    Cesium::LoadSlotArbiter::ConsumerId hiddenLarge = arbiter.AddConsumer();
+    Cesium::LoadSlotArbiter::ConsumerId hiddenSmall = arbiter.AddConsumer();
+    arbiter.ReportDemand(idle, 20, 0, 0.9);
+    arbiter.ReportDemand(loading, 20, 10, 0.1);
+    arbiter.ReportDemand(hiddenLarge, 20, 100, 0.0);
+    arbiter.ReportDemand(hiddenSmall, 20, 8, 0.0);
+    arbiter.Rebalance();
+
+    // the idle consumer keeps its minimum, the visible one gets what it waits for, and the hidden ones share the rest by demand
+    ASSERT_EQ(arbiter.GetAllocation(idle), 2u);
+    ASSERT_EQ(arbiter.GetAllocation(loading), 10u);
+    ASSERT_EQ(arbiter.GetAllocation(hiddenLarge), 20u);
+    ASSERT_EQ(arbiter.GetAllocation(hiddenSmall), 8u);
+    ASSERT_EQ(arbiter.GetStatus().m_throttledConsumerCount, 0u);
+}
+
+TEST_F(LoadSlotArbiterTest, FairShareShrinksWithManyConsumers)
+{
+    Cesium::LoadSlotArbiter arbiter{ 4, 2 };
+    Cesium::LoadSlotArbiter::ConsumerId consumers[6];
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        consumers[i] = arbiter.AddConsumer();
+        arbiter.ReportDemand(consumers[i], 20, 100, 0.1);
+    }
+
+    // no consumer starves, even when there are more consumers than slots
+    arbiter.Rebalance();
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        ASSERT_EQ(arbiter.GetAllocation(consumers[i]), 1u);
+    }
+}
+
+TEST_F(LoadSlotArbiterTest, ZeroGlobalSlotsKeepConsumerLoads)
+{
+    Cesium::LoadSlotArbiter arbiter{ 0, 2 };
+    Cesium::LoadSlotArbiter::ConsumerId first = arbiter.AddConsumer();
+    Cesium::LoadSlotArbiter::ConsumerId second = arbiter.AddConsumer();
+    arbiter.ReportDemand(first, 20, 100, 1.0);
+    arbiter.ReportDemand(second, 30, 0, 0.0);
+    arbiter.Rebalance();
+    ASSERT_EQ(arbiter.GetAllocation(first), 20u);
+    ASSERT_EQ(arbiter.GetAllocation(second), 30u);
+}
+
+TEST_F(LoadSlotArbiterTest, RemovedConsumerReleasesSlots)
+{
+    Cesium::LoadSlotArbiter arbiter{ 20, 2 };
+    Cesium::LoadSlotArbiter::ConsumerId first = arbiter.AddConsumer();
+    Cesium::LoadSlotArbiter::ConsumerId second = arbiter.AddConsumer();
+    arbiter.ReportDemand(first, 20, 100, 0.5);
+    arbiter.ReportDemand(second, 20, 100, 0.5);
+    arbiter.Rebalance();
+    ASSERT_EQ(arbiter.GetAllocation(first), 10u);
+
+    arbiter.RemoveConsumer(second);
+    arbiter.Rebalance();
+    ASSERT_EQ(arbiter.GetAllocation(first), 20u);
+    ASSERT_EQ(arbiter.GetAllocation(second), 0u);
+    ASSERT_EQ(arbiter.GetStatus().m_consumerCount, 1u);
+}
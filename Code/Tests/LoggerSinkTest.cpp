@@ -0,0 +1,215 @@
+#include "Cesium/Systems/LoggerSink.h"
+#include "Cesium/Systems/LogMessageQueue.h"
+#include "Cesium/Systems/LogRateLimiter.h"
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <spdlog/logger.h>
+#include <spdlog/sinks/base_sink.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+class LoggerSinkTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static AZStd::string_view GetText(const Cesium::LogMessage& message)
+    {
+        return AZStd::string_view(message.m_text, message.m_length);
+    }
+};
+
+TEST_F(LoggerSinkTest, QueuePopsInPushOrderUntilFull)
+{
+    Cesium::LogMessageQueue queue(3);
+    ASSERT_EQ(queue.GetCapacity(), 4u);
+    ASSERT_TRUE(queue.IsEmpty());
+
+    auto now = spdlog::log_clock::now();
+    ASSERT_TRUE(queue.TryPush(spdlog::level::info, now, "first", 0));
+    ASSERT_TRUE(queue.TryPush(spdlog::level::warn, now, "second", 2));
+    ASSERT_TRUE(queue.TryPush(spdlog::level::info, now, "third", 0));
+    ASSERT_TRUE(queue.TryPush(spdlog::level::info, now, "fourth", 0));
+    ASSERT_FALSE(queue.TryPush(spdlog::level::info, now, "fifth", 0));
+
+    Cesium::LogMessage message;
+    ASSERT_TRUE(queue.TryPop(message));
+    ASSERT_EQ(GetText(message), "first");
+    ASSERT_TRUE(queue.TryPop(message));
+    ASSERT_EQ(GetText(message), "second");
+    ASSERT_EQ(message.m_level, spdlog::level::warn);
+    ASSERT_EQ(message.m_suppressedCount, 2u);
+
+    // the freed slots are reused by the next lap
+    ASSERT_TRUE(queue.TryPush(spdlog::level::info, now, "fifth", 0));
+    ASSERT_TRUE(queue.TryPop(message));
+    ASSERT_TRUE(queue.TryPop(message));
+    ASSERT_TRUE(queue.TryPop(message));
+    ASSERT_EQ(GetText(message), "fifth");
+    ASSERT_FALSE(queue.TryPop(message));
+}
+
+TEST_F(LoggerSinkTest, QueueTruncatesLongMessages)
+{
+    Cesium::LogMessageQueue queue;
+    std::string longText(Cesium::LogMessage::MAX_LENGTH * 2, 'a');
+    ASSERT_TRUE(queue.TryPush(spdlog::level::info, spdlog::log_clock::now(), AZStd::string_view(longText.data(), longText.size()), 0));
+
+    Cesium::LogMessage message;
+    ASSERT_TRUE(queue.TryPop(message));
+    ASSERT_EQ(message.m_length, Cesium::LogMessage::MAX_LENGTH);
+}
+
+TEST_F(LoggerSinkTest, QueueKeepsEveryMessageOfConcurrentProducers)
+{
+    constexpr std::size_t PRODUCER_COUNT = 4;
+    constexpr std::size_t MESSAGES_PER_PRODUCER = 1000;
+    Cesium::LogMessageQueue queue(PRODUCER_COUNT * MESSAGES_PER_PRODUCER);
+
+    AZStd::vector<AZStd::thread> producers;
+    for (std::size_t i = 0; i < PRODUCER_COUNT; ++i)
+    {
+        producers.emplace_back(
+            [&queue]()
+            {
+                for (std::size_t j = 0; j < MESSAGES_PER_PRODUCER; ++j)
+                {
+                    queue.TryPush(spdlog::level::info, spdlog::log_clock::now(), "message", 0);
+                }
+            });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    std::size_t popped = 0;
+    Cesium::LogMessage message;
+    while (queue.TryPop(message))
+    {
+        ASSERT_EQ(GetText(message), "message");
+        ++popped;
+    }
+
+    ASSERT_EQ(popped, PRODUCER_COUNT * MESSAGES_PER_PRODUCER);
+}
+
+TEST_F(LoggerSinkTest, RateLimiterReportsSuppressedMessagesInTheNextWindow)
+{
+    Cesium::LogRateLimiter rateLimiter(2, 1000);
+    std::uint32_t suppressedCount = 0;
+    ASSERT_TRUE(rateLimiter.Allow("failed", 0, suppressedCount));
+    ASSERT_TRUE(rateLimiter.Allow("failed", 10, suppressedCount));
+    ASSERT_FALSE(rateLimiter.Allow("failed", 20, suppressedCount));
+    ASSERT_FALSE(rateLimiter.Allow("failed", 30, suppressedCount));
+    ASSERT_EQ(rateLimiter.GetSuppressedCount(), 2u);
+
+    ASSERT_TRUE(rateLimiter.Allow("failed", 1000, suppressedCount));
+    ASSERT_EQ(suppressedCount, 2u);
+    ASSERT_TRUE(rateLimiter.Allow("failed", 1010, suppressedCount));
+    ASSERT_EQ(suppressedCount, 0u);
+}
+
+TEST_F(LoggerSinkTest, FlushWaitsUntilMessagesAreWritten)
+{
+    auto sink = std::make_shared<Cesium::LoggerSink>(64, 100);
+    spdlog::logger logger("flush", sink);
+    for (int i = 0; i < 16; ++i)
+    {
+        logger.info("tile {} loaded", i);
+    }
+
+    logger.flush();
+    ASSERT_EQ(sink->GetWrittenCount(), 16u);
+    ASSERT_EQ(sink->GetDroppedCount(), 0u);
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace
+{
+    // the previous sink: every logging thread formats the message while holding one lock
+    class LockedFormatSink final : public spdlog::sinks::base_sink<std::mutex>
+    {
+    protected:
+        void sink_it_(const spdlog::details::log_msg& msg) override
+        {
+            spdlog::memory_buf_t formatted;
+            formatter_->format(msg, formatted);
+            benchmark::DoNotOptimize(formatted.data());
+        }
+
+        void flush_() override
+        {
+        }
+    };
+} // namespace
+
+// Workers simulate tile work and log the same warning for every tile, like when a CDN fails. The argument is the worker count
+class LoggerSinkBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+protected:
+    static void RunWorkers(spdlog::logger& logger, std::size_t workerCount)
+    {
+        AZStd::vector<AZStd::thread> workers;
+        for (std::size_t i = 0; i < workerCount; ++i)
+        {
+            workers.emplace_back(
+                [&logger]()
+                {
+                    for (std::size_t tile = 0; tile < TILES_PER_WORKER; ++tile)
+                    {
+                        auto end = std::chrono::steady_clock::now() + TILE_WORK;
+                        while (std::chrono::steady_clock::now() < end)
+                        {
+                        }
+
+                        logger.warn("Failed to load tile {}: HTTP status 503", "https://cdn.example.com/tileset.json");
+                    }
+                });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    static constexpr std::size_t TILES_PER_WORKER = 2000;
+    static constexpr std::chrono::microseconds TILE_WORK{ 5 };
+};
+
+BENCHMARK_DEFINE_F(LoggerSinkBenchmark, LockedFormatSink)(benchmark::State& state)
+{
+    spdlog::logger logger("benchmark", std::make_shared<LockedFormatSink>());
+    std::size_t workerCount = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        RunWorkers(logger, workerCount);
+    }
+
+    state.SetItemsProcessed(state.iterations() * workerCount * TILES_PER_WORKER);
+}
+
+BENCHMARK_DEFINE_F(LoggerSinkBenchmark, AsyncSink)(benchmark::State& state)
+{
+    auto sink = std::make_shared<Cesium::LoggerSink>();
+    spdlog::logger logger("benchmark", sink);
+    std::size_t workerCount = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        RunWorkers(logger, workerCount);
+    }
+
+    state.SetItemsProcessed(state.iterations() * workerCount * TILES_PER_WORKER);
+    state.counters["Suppressed"] = static_cast<double>(sink->GetSuppressedCount());
+}
+
+BENCHMARK_REGISTER_F(LoggerSinkBenchmark, LockedFormatSink)->Arg(1)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LoggerSinkBenchmark, AsyncSink)->Arg(1)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,114 @@
+#include "Cesium/Systems/MemoryBudget.h"
+#include <AzCore/UnitTest/TestTypes.h>
+
+class MemoryBudgetTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static constexpr std::uint64_t MB = 1024ull * 1024ull;
+};
+
+TEST_F(MemoryBudgetTest, BudgetIsSharedByScreenContribution)
+{
+    Cesium::MemoryBudget budget{ 100 * MB, 0 };
+    Cesium::MemoryBudget::ConsumerId foreground = budget.AddConsumer();
+    Cesium::MemoryBudget::ConsumerId background = budget.AddConsumer();
+
+    // consumers keep their own limit until the first rebalance
+    budget.ReportUsage(foreground, 0, 512 * MB, 0.75);
+    budget.ReportUsage(background, 0, 512 * MB, 0.25);
+    ASSERT_EQ(budget.GetAllocation(foreground), 512 * MB);
+
+    budget.Rebalance();
+    ASSERT_EQ(budget.GetAllocation(foreground), 75 * MB);
+    ASSERT_EQ(budget.GetAllocation(background), 25 * MB);
+    ASSERT_EQ(budget.GetStatus().m_allocatedBytes, 100 * MB);
+    ASSERT_EQ(budget.GetStatus().m_consumerCount, 2u);
+}
+
+TEST_F(MemoryBudgetTest, UnusedShareIsGivenToOtherConsumers)
+{
+    Cesium::MemoryBudget budget{ 100 * MB, 0 };
+    Cesium::MemoryBudget::ConsumerId small = budget.AddConsumer();
+    Cesium::MemoryBudget::ConsumerId large = budget.AddConsumer();
+    Cesium::MemoryBudget::ConsumerId hiddenLarge = budget.AddConsumer();
+    Cesium::MemoryBudget::ConsumerId hiddenSmall = budget.AddConsumer();
+    budget.ReportUsage(small, 10 * MB, 10 * MB, 0.9);
+    budget.ReportUsage(large, 20 * MB, 40 * MB, 0.1);
+    budget.ReportUsage(hiddenLarge, 30 * MB, 512 * MB, 0.0);
+    budget.ReportUsage(hiddenSmall, 10 * MB, 512 * MB, 0.0);
+    budget.Rebalance();
+
+    // the visible consumers reach their maximum, and the hidden ones keep the rest in proportion to what they cache
+    ASSERT_EQ(budget.GetAllocation(small), 10 * MB);
+    ASSERT_EQ(budget.GetAllocation(large), 40 * MB);
+    ASSERT_EQ(budget.GetAllocation(hiddenLarge), 37 * MB);
+    ASSERT_EQ(budget.GetAllocation(hiddenSmall), 12 * MB);
+}
+
+TEST_F(MemoryBudgetTest, PressureFollowsUsedBytes)
+{
+    Cesium::MemoryBudget budget{ 100 * MB };
+    Cesium::MemoryBudget::ConsumerId first = budget.AddConsumer();
+    Cesium::MemoryBudget::ConsumerId second = budget.AddConsumer();
+
+    budget.ReportUsage(first, 30 * MB, 512 * MB, 0.5);
+    budget.ReportUsage(second, 30 * MB, 512 * MB, 0.5);
+    budget.Rebalance();
+    ASSERT_EQ(budget.GetStatus().m_pressure, Cesium::MemoryPressure::Normal);
+    ASSERT_EQ(budget.GetStatus().m_evictingConsumerCount, 0u);
+
+    budget.ReportUsage(first, 70 * MB, 512 * MB, 0.5);
+    budget.Rebalance();
+    ASSERT_EQ(budget.GetStatus().m_pressure, Cesium::MemoryPressure::High);
+    ASSERT_EQ(budget.GetStatus().m_evictingConsumerCount, 1u);
+
+    budget.ReportUsage(second, 50 * MB, 512 * MB, 0.5);
+    budget.Rebalance();
+    ASSERT_EQ(budget.GetStatus().m_pressure, Cesium::MemoryPressure::Critical);
+    ASSERT_EQ(budget.GetStatus().m_usedBytes, 120 * MB);
+
+    budget.RemoveConsumer(first);
+    budget.Rebalance();
+    ASSERT_EQ(budget.GetStatus().m_pressure, Cesium::MemoryPressure::Normal);
+    ASSERT_EQ(budget.GetAllocation(first), 0u);
+    ASSERT_EQ(budget.GetAllocation(second), 100 * MB);
+}
+
+TEST_F(MemoryBudgetTest, ConsumersKeepMinimumBytesWithoutUsage)
+{
+    Cesium::MemoryBudget budget{ 100 * MB, 16 * MB };
+    Cesium::MemoryBudget::ConsumerId foreground = budget.AddConsumer();
+    Cesium::MemoryBudget::ConsumerId hidden = budget.AddConsumer();
+    budget.ReportUsage(foreground, 200 * MB, 512 * MB, 1.0);
+    budget.ReportUsage(hidden, 0, 512 * MB, 0.0);
+    budget.Rebalance();
+
+    // the hidden consumer caches nothing yet, and still keeps the minimum for the tiles it starts loading
+    ASSERT_EQ(budget.GetAllocation(foreground), 84 * MB);
+    ASSERT_EQ(budget.GetAllocation(hidden), 16 * MB);
+
+    // the minimum never exceeds an equal split of the budget
+    for (int i = 0; i < 8; ++i)
+    {
+        budget.ReportUsage(budget.AddConsumer(), 0, 512 * MB, 0.0);
+    }
+
+    budget.Rebalance();
+    ASSERT_EQ(budget.GetAllocation(hidden), 10 * MB);
+    ASSERT_EQ(budget.GetAllocation(foreground), 10 * MB);
+    ASSERT_LE(budget.GetStatus().m_allocatedBytes, 100 * MB);
+}
+
+TEST_F(MemoryBudgetTest, ZeroBudgetKeepsConsumerLimits)
+{
+    Cesium::MemoryBudget budget{ 0 };
+    Cesium::MemoryBudget::ConsumerId first = budget.AddConsumer();
+    Cesium::MemoryBudget::ConsumerId second = budget.AddConsumer();
+    budget.ReportUsage(first, 600 * MB, 512 * MB, 1.0);
+    budget.ReportUsage(second, 0, 256 * MB, 0.0);
+    budget.Rebalance();
+
+    ASSERT_EQ(budget.GetAllocation(first), 512 * MB);
+    ASSERT_EQ(budget.GetAllocation(second), 256 * MB);
+    ASSERT_EQ(budget.GetStatus().m_pressure, Cesium::MemoryPressure::Normal);
+}
@@ -0,0 +1,74 @@
+#include "Cesium/Systems/MemoryTracker.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <utility>
+
+class MemoryTrackerTest : public UnitTest::AllocatorsTestFixture
+{
+};
+
+TEST_F(MemoryTrackerTest, TrackLiveAndPeakBytesPerCategory)
+{
+    Cesium::MemoryTracker tracker;
+    tracker.Allocate(Cesium::MemoryCategory::BuiltAssets, 100);
+    tracker.Allocate(Cesium::MemoryCategory::RasterImages, 50);
+    tracker.Free(Cesium::MemoryCategory::BuiltAssets, 60);
+
+    ASSERT_EQ(tracker.GetLiveBytes(Cesium::MemoryCategory::BuiltAssets), 40u);
+    ASSERT_EQ(tracker.GetPeakBytes(Cesium::MemoryCategory::BuiltAssets), 100u);
+    ASSERT_EQ(tracker.GetLiveBytes(Cesium::MemoryCategory::RasterImages), 50u);
+    ASSERT_EQ(tracker.GetTotalLiveBytes(), 90u);
+    ASSERT_EQ(tracker.GetTotalPeakBytes(), 150u);
+
+    tracker.ResetPeaks();
+    ASSERT_EQ(tracker.GetPeakBytes(Cesium::MemoryCategory::BuiltAssets), 40u);
+    ASSERT_EQ(tracker.GetTotalPeakBytes(), 90u);
+}
+
+TEST_F(MemoryTrackerTest, SetLiveBytesAppliesTheDifference)
+{
+    Cesium::MemoryTracker tracker;
+    tracker.SetLiveBytes(Cesium::MemoryCategory::DecodedTiles, 300);
+    tracker.SetLiveBytes(Cesium::MemoryCategory::DecodedTiles, 120);
+
+    ASSERT_EQ(tracker.GetLiveBytes(Cesium::MemoryCategory::DecodedTiles), 120u);
+    ASSERT_EQ(tracker.GetPeakBytes(Cesium::MemoryCategory::DecodedTiles), 300u);
+    ASSERT_EQ(tracker.GetTotalLiveBytes(), 120u);
+}
+
+TEST_F(MemoryTrackerTest, ChildForwardsToParentUntilDestroyed)
+{
+    Cesium::MemoryTracker parent;
+    {
+        Cesium::MemoryTracker child(&parent);
+        child.Allocate(Cesium::MemoryCategory::BuiltAssets, 70);
+        child.SetLiveBytes(Cesium::MemoryCategory::DecodedTiles, 30);
+        parent.Allocate(Cesium::MemoryCategory::HttpBodies, 10);
+
+        ASSERT_EQ(child.GetTotalLiveBytes(), 100u);
+        ASSERT_EQ(parent.GetLiveBytes(Cesium::MemoryCategory::BuiltAssets), 70u);
+        ASSERT_EQ(parent.GetTotalLiveBytes(), 110u);
+    }
+
+    ASSERT_EQ(parent.GetLiveBytes(Cesium::MemoryCategory::BuiltAssets), 0u);
+    ASSERT_EQ(parent.GetLiveBytes(Cesium::MemoryCategory::DecodedTiles), 0u);
+    ASSERT_EQ(parent.GetTotalLiveBytes(), 10u);
+    ASSERT_EQ(parent.GetTotalPeakBytes(), 110u);
+}
+
+TEST_F(MemoryTrackerTest, TrackedMemoryReleasesOnceWhenMoved)
+{
+    Cesium::MemoryTracker tracker;
+    {
+        Cesium::TrackedMemory memory(&tracker, Cesium::MemoryCategory::RasterImages, 64);
+        Cesium::TrackedMemory movedMemory = std::move(memory);
+        ASSERT_EQ(memory.GetBytes(), 0u);
+        ASSERT_EQ(movedMemory.GetBytes(), 64u);
+        ASSERT_EQ(tracker.GetLiveBytes(Cesium::MemoryCategory::RasterImages), 64u);
+
+        movedMemory = Cesium::TrackedMemory(&tracker, Cesium::MemoryCategory::RasterImages, 16);
+        ASSERT_EQ(tracker.GetLiveBytes(Cesium::MemoryCategory::RasterImages), 16u);
+    }
+
+    ASSERT_EQ(tracker.GetLiveBytes(Cesium::MemoryCategory::RasterImages), 0u);
+    ASSERT_EQ(tracker.GetPeakBytes(Cesium::MemoryCategory::RasterImages), 80u);
+}
@@ -0,0 +1,55 @@
+#include "Cesium/TilesetUtility/PrefetchViewScheduler.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+class PrefetchViewSchedulerTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    // return the number of frames that selected the prefetch views
+    static std::uint32_t RunFrames(Cesium::PrefetchViewScheduler& scheduler, std::uint32_t frameCount, bool hasPendingLoads)
+    {
+        std::uint32_t selectedFrames = 0;
+        for (std::uint32_t i = 0; i < frameCount; ++i)
+        {
+            bool selected = scheduler.ShouldSelectPrefetchViews();
+            scheduler.RecordFrame(selected, hasPendingLoads);
+            selectedFrames += selected ? 1 : 0;
+        }
+
+        return selectedFrames;
+    }
+
+    static constexpr std::uint32_t INTERVAL = Cesium::PrefetchViewScheduler::SELECTION_INTERVAL;
+};
+
+TEST_F(PrefetchViewSchedulerTest, PrefetchViewsYieldToLoadingCurrentViews)
+{
+    Cesium::PrefetchViewScheduler scheduler;
+    ASSERT_EQ(RunFrames(scheduler, INTERVAL * 10, true), 10u);
+}
+
+TEST_F(PrefetchViewSchedulerTest, PrefetchViewsTakeOverSettledCurrentViews)
+{
+    Cesium::PrefetchViewScheduler scheduler;
+    RunFrames(scheduler, INTERVAL, false);
+    ASSERT_EQ(RunFrames(scheduler, INTERVAL * 10, false), (INTERVAL - 1) * 10);
+
+    // the next frame without the prefetch views sees the current views loading again
+    RunFrames(scheduler, INTERVAL, true);
+    ASSERT_EQ(RunFrames(scheduler, INTERVAL * 10, true), 10u);
+}
+
+TEST_F(PrefetchViewSchedulerTest, ViewsAreNotReadyBeforeTheRootLoads)
+{
+    Cesium::PrefetchViewScheduler scheduler;
+    scheduler.SyncViews(1, 1);
+    ASSERT_FALSE(scheduler.IsViewReady(0));
+
+    std::vector<Cesium3DTilesSelection::ViewState> prefetchViewStates{ Cesium3DTilesSelection::ViewState::create(
+        glm::dvec3{ 0.0, 0.0, 100.0 }, glm::dvec3{ 0.0, 0.0, -1.0 }, glm::dvec3{ 0.0, 1.0, 0.0 }, glm::dvec2{ 1920.0, 1080.0 },
+        glm::radians(90.0), glm::radians(60.0)) };
+    scheduler.UpdateReadiness(prefetchViewStates, {}, {}, nullptr, 16.0);
+    ASSERT_FALSE(scheduler.IsViewReady(0));
+    ASSERT_FALSE(scheduler.IsViewReady(1));
+}
@@ -0,0 +1,213 @@
+#include "Cesium/Systems/ResponseSamplingAssetAccessor.h"
+#include "Cesium/Systems/SnapshotAssetAccessor.h"
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/GenericAssetAccessor.h"
+#include "Cesium/Systems/TaskProcessor.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Answers the requests when Respond() is called, so they stay in flight until then. The status of a request is the end of its
+    // url, like o3de:tile.glb?status=503, and 0 answers without a response
+    class StubAssetAccessor final : public CesiumAsync::IAssetAccessor
+    {
+    public:
+        CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> requestAsset(
+            const CesiumAsync::AsyncSystem& asyncSystem,
+            const std::string& url,
+            [[maybe_unused]] const std::vector<THeader>& headers = {}) override
+        {
+            auto promise = asyncSystem.createPromise<std::shared_ptr<CesiumAsync::IAssetRequest>>();
+            auto future = promise.getFuture();
+            m_pendingRequests.emplace_back(url, std::move(promise));
+            return future;
+        }
+
+        CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> post(
+            const CesiumAsync::AsyncSystem& asyncSystem,
+            [[maybe_unused]] const std::string& url,
+            [[maybe_unused]] const std::vector<THeader>& headers = std::vector<THeader>(),
+            [[maybe_unused]] const gsl::span<const std::byte>& contentPayload = {}) override
+        {
+            return asyncSystem.createResolvedFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>(nullptr);
+        }
+
+        void tick() noexcept override
+        {
+        }
+
+        void Respond()
+        {
+            for (auto& [url, promise] : m_pendingRequests)
+            {
+                std::uint16_t statusCode = static_cast<std::uint16_t>(std::stoi(url.substr(url.find("status=") + 7)));
+                std::unique_ptr<Cesium::GenericAssetResponse> response;
+                if (statusCode != 0)
+                {
+                    response = std::make_unique<Cesium::GenericAssetResponse>(
+                        statusCode, "application/octet-stream", Cesium::IOContent(RESPONSE_BYTES));
+                }
+
+                promise.resolve(
+                    std::make_shared<Cesium::GenericAssetRequest>(std::string(url), CesiumAsync::HttpHeaders{}, std::move(response)));
+            }
+
+            m_pendingRequests.clear();
+        }
+
+        static constexpr std::size_t RESPONSE_BYTES = 64;
+
+    private:
+        std::vector<std::pair<std::string, CesiumAsync::Promise<std::shared_ptr<CesiumAsync::IAssetRequest>>>> m_pendingRequests;
+    };
+} // namespace
+
+class ResponseSamplingAssetAccessorTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    void SetUp() override
+    {
+        UnitTest::AllocatorsTestFixture::SetUp();
+        m_asyncSystem = std::make_unique<CesiumAsync::AsyncSystem>(std::make_shared<Cesium::TaskProcessor>(&m_taskQueue));
+        m_stubAccessor = std::make_shared<StubAssetAccessor>();
+        m_sampler = std::make_shared<Cesium::ResponseSamplingAssetAccessor>(m_stubAccessor);
+    }
+
+    void TearDown() override
+    {
+        m_sampler.reset();
+        m_stubAccessor.reset();
+        m_asyncSystem.reset();
+        UnitTest::AllocatorsTestFixture::TearDown();
+    }
+
+    void Request(CesiumAsync::IAssetAccessor& accessor, const std::string& url)
+    {
+        m_futures.emplace_back(accessor.requestAsset(*m_asyncSystem, url));
+    }
+
+    void Respond()
+    {
+        m_stubAccessor->Respond();
+        m_taskQueue.RunPending();
+        for (auto& future : m_futures)
+        {
+            std::move(future).wait();
+        }
+
+        m_futures.clear();
+    }
+
+    static std::shared_ptr<CesiumAsync::IAssetRequest> CreateRequest(std::uint16_t statusCode)
+    {
+        std::unique_ptr<Cesium::GenericAssetResponse> response;
+        if (statusCode != 0)
+        {
+            response = std::make_unique<Cesium::GenericAssetResponse>(statusCode, "application/octet-stream", Cesium::IOContent{});
+        }
+
+        return std::make_shared<Cesium::GenericAssetRequest>("o3de:tile.glb", CesiumAsync::HttpHeaders{}, std::move(response));
+    }
+
+    Cesium::DeterministicTaskQueue m_taskQueue;
+    std::unique_ptr<CesiumAsync::AsyncSystem> m_asyncSystem;
+    std::shared_ptr<StubAssetAccessor> m_stubAccessor;
+    std::shared_ptr<Cesium::ResponseSamplingAssetAccessor> m_sampler;
+    std::vector<CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>> m_futures;
+};
+
+TEST_F(ResponseSamplingAssetAccessorTest, ThrottledAndServerErrorsAreFailures)
+{
+    ASSERT_TRUE(Cesium::ResponseSamplingAssetAccessor::IsFailure(nullptr));
+    ASSERT_TRUE(Cesium::ResponseSamplingAssetAccessor::IsFailure(CreateRequest(0).get()));
+    ASSERT_TRUE(Cesium::ResponseSamplingAssetAccessor::IsFailure(CreateRequest(429).get()));
+    ASSERT_TRUE(Cesium::ResponseSamplingAssetAccessor::IsFailure(CreateRequest(500).get()));
+    ASSERT_TRUE(Cesium::ResponseSamplingAssetAccessor::IsFailure(CreateRequest(503).get()));
+
+    // a missing file or a forbidden request says nothing about the link
+    ASSERT_FALSE(Cesium::ResponseSamplingAssetAccessor::IsFailure(CreateRequest(200).get()));
+    ASSERT_FALSE(Cesium::ResponseSamplingAssetAccessor::IsFailure(CreateRequest(304).get()));
+    ASSERT_FALSE(Cesium::ResponseSamplingAssetAccessor::IsFailure(CreateRequest(403).get()));
+    ASSERT_FALSE(Cesium::ResponseSamplingAssetAccessor::IsFailure(CreateRequest(404).get()));
+}
+
+TEST_F(ResponseSamplingAssetAccessorTest, SamplesRecordThrottledAndFailedResponses)
+{
+    Request(*m_sampler, "o3de:a.glb?status=200");
+    Request(*m_sampler, "o3de:b.glb?status=429");
+    Request(*m_sampler, "o3de:c.glb?status=503");
+    Request(*m_sampler, "o3de:d.glb?status=0");
+    Respond();
+
+    std::vector<Cesium::ResponseSample> samples;
+    m_sampler->TakeSamples(samples);
+    ASSERT_EQ(samples.size(), 4u);
+    ASSERT_FALSE(samples[0].m_failed);
+    ASSERT_EQ(samples[0].m_bytes, StubAssetAccessor::RESPONSE_BYTES);
+    ASSERT_TRUE(samples[1].m_failed);
+    ASSERT_TRUE(samples[2].m_failed);
+    ASSERT_TRUE(samples[3].m_failed);
+    ASSERT_EQ(samples[3].m_bytes, 0u);
+    for (const Cesium::ResponseSample& sample : samples)
+    {
+        ASSERT_GE(sample.m_latency, 0.0);
+    }
+
+    // the samples are moved out, so the next call only gets the new ones
+    m_sampler->TakeSamples(samples);
+    ASSERT_TRUE(samples.empty());
+}
+
+TEST_F(ResponseSamplingAssetAccessorTest, PeakRequestsInFlightLastUntilTheSamplesAreTaken)
+{
+    Request(*m_sampler, "o3de:a.glb?status=200");
+    Request(*m_sampler, "o3de:b.glb?status=200");
+    Request(*m_sampler, "o3de:c.glb?status=200");
+    ASSERT_EQ(m_sampler->GetRequestsInFlight(), 3u);
+    Respond();
+    ASSERT_EQ(m_sampler->GetRequestsInFlight(), 0u);
+
+    // the peak is the most requests in flight since the last call, even when they are all answered
+    std::vector<Cesium::ResponseSample> samples;
+    ASSERT_EQ(m_sampler->TakeSamples(samples), 3u);
+    ASSERT_EQ(m_sampler->TakeSamples(samples), 0u);
+
+    // the next peak starts from the requests still in flight
+    Request(*m_sampler, "o3de:d.glb?status=200");
+    ASSERT_EQ(m_sampler->TakeSamples(samples), 1u);
+    ASSERT_EQ(m_sampler->TakeSamples(samples), 1u);
+    Respond();
+    ASSERT_EQ(m_sampler->TakeSamples(samples), 1u);
+    ASSERT_EQ(samples.size(), 1u);
+    ASSERT_EQ(m_sampler->TakeSamples(samples), 0u);
+}
+
+TEST_F(ResponseSamplingAssetAccessorTest, ResponsesRestoredFromTheSnapshotAreNotSampled)
+{
+    // the tileset wraps the sampler in the snapshot accessor, so only the requests that reach the link are sampled
+    auto recordingAccessor = std::make_shared<Cesium::SnapshotAssetAccessor>(m_sampler, 1024);
+    Request(*recordingAccessor, "o3de:a.glb?status=200");
+    Respond();
+    Cesium::IOContent snapshot = recordingAccessor->CreateSnapshot({ "a.glb" });
+
+    std::vector<Cesium::ResponseSample> samples;
+    m_sampler->TakeSamples(samples);
+    ASSERT_EQ(samples.size(), 1u);
+
+    auto restoringAccessor = std::make_shared<Cesium::SnapshotAssetAccessor>(m_sampler, 1024);
+    ASSERT_TRUE(restoringAccessor->Restore(snapshot));
+    Request(*restoringAccessor, "o3de:a.glb?status=200");
+    Request(*restoringAccessor, "o3de:b.glb?status=503");
+    ASSERT_EQ(m_sampler->GetRequestsInFlight(), 1u);
+    Respond();
+
+    ASSERT_EQ(m_sampler->TakeSamples(samples), 1u);
+    ASSERT_EQ(samples.size(), 1u);
+    ASSERT_TRUE(samples[0].m_failed);
+    ASSERT_EQ(restoringAccessor->GetRestoredRequestCount(), 1u);
+}
@@ -0,0 +1,80 @@
+#include "Cesium/TilesetUtility/ScreenSpaceErrorController.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <cstdint>
+
+class ScreenSpaceErrorControllerTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static double RunFrames(Cesium::ScreenSpaceErrorController& controller, std::uint32_t frames, float frameTime, float mainThreadTime)
+    {
+        double screenSpaceError = controller.GetScreenSpaceError();
+        for (std::uint32_t i = 0; i < frames; ++i)
+        {
+            screenSpaceError = controller.Update(frameTime, mainThreadTime);
+        }
+
+        return screenSpaceError;
+    }
+
+    void SetUp() override
+    {
+        UnitTest::AllocatorsTestFixture::SetUp();
+        m_controller.Configure(4.0, 64.0, 16.0f, 4.0f);
+        m_controller.Reset(16.0);
+    }
+
+    Cesium::ScreenSpaceErrorController m_controller;
+};
+
+TEST_F(ScreenSpaceErrorControllerTest, SlowFramesCoarsenUpToMaximum)
+{
+    double screenSpaceError = RunFrames(m_controller, Cesium::ScreenSpaceErrorController::SETTLE_FRAMES, 33.0f, 1.0f);
+    ASSERT_GT(screenSpaceError, 16.0);
+
+    screenSpaceError = RunFrames(m_controller, 1000, 33.0f, 1.0f);
+    ASSERT_DOUBLE_EQ(screenSpaceError, 64.0);
+}
+
+TEST_F(ScreenSpaceErrorControllerTest, MainThreadOverBudgetCoarsens)
+{
+    double screenSpaceError = RunFrames(m_controller, Cesium::ScreenSpaceErrorController::SETTLE_FRAMES, 10.0f, 8.0f);
+    ASSERT_GT(screenSpaceError, 16.0);
+}
+
+TEST_F(ScreenSpaceErrorControllerTest, FastFramesRefineDownToMinimum)
+{
+    double screenSpaceError = RunFrames(m_controller, Cesium::ScreenSpaceErrorController::SETTLE_FRAMES, 8.0f, 1.0f);
+    ASSERT_LT(screenSpaceError, 16.0);
+
+    screenSpaceError = RunFrames(m_controller, 1000, 8.0f, 1.0f);
+    ASSERT_DOUBLE_EQ(screenSpaceError, 4.0);
+}
+
+TEST_F(ScreenSpaceErrorControllerTest, FramesInsideDeadBandKeepScreenSpaceError)
+{
+    double screenSpaceError = RunFrames(m_controller, 1000, 15.0f, 3.5f);
+    ASSERT_DOUBLE_EQ(screenSpaceError, 16.0);
+}
+
+TEST_F(ScreenSpaceErrorControllerTest, SingleSpikeDoesNotChangeScreenSpaceError)
+{
+    RunFrames(m_controller, Cesium::ScreenSpaceErrorController::SETTLE_FRAMES, 15.0f, 3.5f);
+    double screenSpaceError = m_controller.Update(30.0f, 3.5f);
+    ASSERT_DOUBLE_EQ(screenSpaceError, 16.0);
+}
+
+TEST_F(ScreenSpaceErrorControllerTest, ChangesWaitForPreviousChangeToSettle)
+{
+    RunFrames(m_controller, Cesium::ScreenSpaceErrorController::SETTLE_FRAMES, 33.0f, 1.0f);
+    double coarsened = m_controller.GetScreenSpaceError();
+    double screenSpaceError = RunFrames(m_controller, Cesium::ScreenSpaceErrorController::SETTLE_FRAMES - 1, 33.0f, 1.0f);
+    ASSERT_DOUBLE_EQ(screenSpaceError, coarsened);
+}
+
+TEST_F(ScreenSpaceErrorControllerTest, ResetClampsToBounds)
+{
+    m_controller.Reset(200.0);
+    ASSERT_DOUBLE_EQ(m_controller.GetScreenSpaceError(), 64.0);
+    m_controller.Reset(1.0);
+    ASSERT_DOUBLE_EQ(m_controller.GetScreenSpaceError(), 4.0);
+}
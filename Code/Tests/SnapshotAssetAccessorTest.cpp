@@ -0,0 +1,325 @@
+#include "Cesium/Systems/SnapshotAssetAccessor.h"
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/GenericAssetAccessor.h"
+#include "Cesium/Systems/TaskProcessor.h"
+#include "SyntheticTileset.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <memory>
+#include <string>
+
+#if defined(HAVE_BENCHMARK)
+#include "Cesium/Systems/ViewStateProvider.h"
+#include <AzCore/Memory/PoolAllocator.h>
+#include <Cesium3DTilesSelection/TileIdUtilities.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+#endif
+
+class SnapshotAssetAccessorTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    void SetUp() override
+    {
+        UnitTest::AllocatorsTestFixture::SetUp();
+        m_asyncSystem = std::make_unique<CesiumAsync::AsyncSystem>(std::make_shared<Cesium::TaskProcessor>(&m_taskQueue));
+    }
+
+    void TearDown() override
+    {
+        m_asyncSystem.reset();
+        UnitTest::AllocatorsTestFixture::TearDown();
+    }
+
+    std::shared_ptr<Cesium::SnapshotAssetAccessor> CreateAccessor(CesiumTests::InMemoryIOManager& ioManager, std::uint64_t maximumBytes)
+    {
+        return std::make_shared<Cesium::SnapshotAssetAccessor>(
+            std::make_shared<Cesium::GenericAssetAccessor>(&ioManager, "application/octet-stream"), maximumBytes);
+    }
+
+    // the status of the response, 0 when there is none
+    std::uint16_t Request(Cesium::SnapshotAssetAccessor& accessor, const std::string& url)
+    {
+        auto future = accessor.requestAsset(*m_asyncSystem, url);
+        m_taskQueue.RunPending();
+        std::shared_ptr<CesiumAsync::IAssetRequest> request = std::move(future).wait();
+        return request && request->response() ? request->response()->statusCode() : 0;
+    }
+
+    static void AddFile(CesiumTests::InMemoryIOManager& ioManager, const std::string& path, std::size_t size)
+    {
+        std::string content(size, 'x');
+        ioManager.AddFile(path, content.data(), content.size());
+    }
+
+    Cesium::DeterministicTaskQueue m_taskQueue;
+    std::unique_ptr<CesiumAsync::AsyncSystem> m_asyncSystem;
+};
+
+TEST_F(SnapshotAssetAccessorTest, SnapshotRestoresTreeFilesAndVisibleContents)
+{
+    CesiumTests::InMemoryIOManager ioManager{ "{\"asset\":{\"version\":\"1.0\"}}" };
+    AddFile(ioManager, "tiles/0/0.glb", 64);
+    AddFile(ioManager, "tiles/1/1.glb", 64);
+    auto recordingAccessor = CreateAccessor(ioManager, 1024);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:tileset.json?key=session1"), 200);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:tiles/0/0.glb"), 200);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:tiles/1/1.glb"), 200);
+    Cesium::IOContent snapshot = recordingAccessor->CreateSnapshot({ "./tiles/0/0.glb" });
+
+    // nothing can be loaded from the wrapped accessor, so every response comes from the snapshot
+    CesiumTests::InMemoryIOManager emptyIOManager;
+    auto restoringAccessor = CreateAccessor(emptyIOManager, 1024);
+    ASSERT_TRUE(restoringAccessor->Restore(snapshot));
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:tileset.json?key=session2"), 200);
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:tiles/0/0.glb"), 200);
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:tiles/1/1.glb"), 404);
+    ASSERT_EQ(restoringAccessor->GetRestoredRequestCount(), 2u);
+
+    // the restored responses are recorded again, so they are kept in the next snapshot after being released
+    restoringAccessor->ReleaseRestoredResponses();
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:tileset.json"), 404);
+    auto nextAccessor = CreateAccessor(emptyIOManager, 1024);
+    ASSERT_TRUE(nextAccessor->Restore(restoringAccessor->CreateSnapshot({ "tiles/0/0.glb" })));
+    ASSERT_EQ(Request(*nextAccessor, "o3de:tileset.json"), 200);
+    ASSERT_EQ(Request(*nextAccessor, "o3de:tiles/0/0.glb"), 200);
+}
+
+TEST_F(SnapshotAssetAccessorTest, ContentsOverTheMaximumBytesAreDropped)
+{
+    CesiumTests::InMemoryIOManager ioManager{ "{\"asset\":{\"version\":\"1.0\"}}" };
+    AddFile(ioManager, "a.b3dm", 600);
+    AddFile(ioManager, "b.b3dm", 600);
+    auto recordingAccessor = CreateAccessor(ioManager, 1024);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:tileset.json"), 200);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:a.b3dm"), 200);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:b.b3dm"), 200);
+
+    // the tileset json is kept regardless of the maximum, and the contents loaded first are dropped
+    CesiumTests::InMemoryIOManager emptyIOManager;
+    auto restoringAccessor = CreateAccessor(emptyIOManager, 1024);
+    ASSERT_TRUE(restoringAccessor->Restore(recordingAccessor->CreateSnapshot({ "a.b3dm", "b.b3dm" })));
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:tileset.json"), 200);
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:a.b3dm"), 404);
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:b.b3dm"), 200);
+}
+
+TEST_F(SnapshotAssetAccessorTest, ImplicitTileIdsMatchTheirContents)
+{
+    CesiumTests::InMemoryIOManager ioManager{ "{\"asset\":{\"version\":\"1.0\"}}" };
+    AddFile(ioManager, "terrain/2/1/3.terrain", 64);
+    AddFile(ioManager, "terrain/2/3/1.terrain", 64);
+    AddFile(ioManager, "terrain/12/1/3.terrain", 64);
+    auto recordingAccessor = CreateAccessor(ioManager, 1024);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:terrain/2/1/3.terrain?v=1.2.0"), 200);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:terrain/2/3/1.terrain?v=1.2.0"), 200);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:terrain/12/1/3.terrain?v=1.2.0"), 200);
+
+    // the contents are named after the level and the coordinates of the implicit tiles
+    CesiumTests::InMemoryIOManager emptyIOManager;
+    auto restoringAccessor = CreateAccessor(emptyIOManager, 1024);
+    ASSERT_TRUE(restoringAccessor->Restore(recordingAccessor->CreateSnapshot({ "L2-X1-Y3" })));
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:terrain/2/1/3.terrain?v=1.2.0"), 200);
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:terrain/2/3/1.terrain?v=1.2.0"), 404);
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:terrain/12/1/3.terrain?v=1.2.0"), 404);
+}
+
+TEST_F(SnapshotAssetAccessorTest, OnlyCredentialParametersAreIgnored)
+{
+    CesiumTests::InMemoryIOManager ioManager{ "{\"asset\":{\"version\":\"1.0\"}}" };
+    AddFile(ioManager, "tile?x=1&y=2", 64);
+    AddFile(ioManager, "tile?x=1&y=3", 32);
+    auto recordingAccessor = CreateAccessor(ioManager, 1024);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:tile?x=1&y=2"), 200);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:tile?x=1&y=3"), 200);
+
+    // the urls that only differ by a query parameter other than a credential get their own contents back
+    CesiumTests::InMemoryIOManager emptyIOManager;
+    auto restoringAccessor = CreateAccessor(emptyIOManager, 1024);
+    ASSERT_TRUE(restoringAccessor->Restore(recordingAccessor->CreateSnapshot({ "tile?x=1&y=2", "tile?x=1&y=3" })));
+    auto contentSize = [this, &restoringAccessor](const std::string& url)
+    {
+        auto future = restoringAccessor->requestAsset(*m_asyncSystem, url);
+        m_taskQueue.RunPending();
+        std::shared_ptr<CesiumAsync::IAssetRequest> request = std::move(future).wait();
+        return request && request->response() && request->response()->statusCode() == 200 ? request->response()->data().size() : 0;
+    };
+
+    ASSERT_EQ(contentSize("o3de:tile?x=1&y=2&key=session2"), 64u);
+    ASSERT_EQ(contentSize("o3de:tile?access_token=session2&x=1&y=3"), 32u);
+    ASSERT_EQ(contentSize("o3de:tile?x=1&y=4"), 0u);
+    ASSERT_EQ(restoringAccessor->GetRestoredRequestCount(), 2u);
+}
+
+TEST_F(SnapshotAssetAccessorTest, InvalidSnapshotIsRejected)
+{
+    CesiumTests::InMemoryIOManager ioManager{ "{\"asset\":{\"version\":\"1.0\"}}" };
+    auto recordingAccessor = CreateAccessor(ioManager, 1024);
+    ASSERT_EQ(Request(*recordingAccessor, "o3de:tileset.json"), 200);
+    Cesium::IOContent snapshot = recordingAccessor->CreateSnapshot({});
+
+    CesiumTests::InMemoryIOManager emptyIOManager;
+    auto restoringAccessor = CreateAccessor(emptyIOManager, 1024);
+    Cesium::IOContent truncatedSnapshot(snapshot.begin(), snapshot.end() - 1);
+    ASSERT_FALSE(restoringAccessor->Restore(truncatedSnapshot));
+    ASSERT_FALSE(restoringAccessor->Restore({}));
+
+    Cesium::IOContent otherVersionSnapshot = snapshot;
+    otherVersionSnapshot[4] = static_cast<std::byte>(Cesium::SnapshotAssetAccessor::SNAPSHOT_VERSION + 1);
+    ASSERT_FALSE(restoringAccessor->Restore(otherVersionSnapshot));
+    ASSERT_EQ(Request(*restoringAccessor, "o3de:tileset.json"), 404);
+}
+
+#if defined(HAVE_BENCHMARK)
+// A tileset opened above a synthetic city whose tiles take several frames to load. The argument selects a cold start, or a start
+// restored from the snapshot of the previous session. The counter is the frames until the first frame without pending loads
+class SnapshotAssetAccessorBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+public:
+    void SetUp(const ::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+    }
+
+    void SetUp(::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+    }
+
+    void TearDown(const ::benchmark::State& state) override
+    {
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+    void TearDown(::benchmark::State& state) override
+    {
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+protected:
+    void CreateTileset(const Cesium::IOContent* snapshot)
+    {
+        std::string tilesetJson = CesiumTests::CreateQuadtreeTilesetJson(TILESET_DEPTH, "tiles/{level}/{x}/{y}.glb");
+        std::string tileGlb = CesiumTests::CreateBufferOnlyGlb(TILE_BYTES);
+        auto ioManager = std::make_unique<CesiumTests::InMemoryIOManager>(tilesetJson);
+
+        // every tile has its own content, so the snapshot only holds the visible ones
+        ioManager->SetDefaultFile(tileGlb.data(), tileGlb.size());
+        ioManager->SetLatency(IO_LATENCY_FRAMES);
+        m_tileset = std::make_unique<CesiumTests::SyntheticTileset>(
+            std::move(ioManager), "application/octet-stream",
+            [this, snapshot](std::shared_ptr<CesiumAsync::IAssetAccessor> assetAccessor)
+            {
+                m_snapshotAccessor = std::make_shared<Cesium::SnapshotAssetAccessor>(std::move(assetAccessor), MAXIMUM_SNAPSHOT_BYTES);
+                if (snapshot)
+                {
+                    m_snapshotAccessor->Restore(*snapshot);
+                }
+
+                return m_snapshotAccessor;
+            });
+    }
+
+    void DestroyTileset()
+    {
+        m_tileset.reset();
+        m_snapshotAccessor.reset();
+    }
+
+    // the frames until the first frame that renders the view without pending loads
+    std::size_t LoadUntilFullDetail(std::vector<std::string>& visibleTileIds)
+    {
+        m_viewStateProvider.SetCameras({ GetCamera() });
+        const auto& viewStates = m_viewStateProvider.GetViewStates(glm::dmat4{ 1.0 });
+        for (std::size_t frame = 0; frame < MAXIMUM_FRAMES; ++frame)
+        {
+            m_tileset->AdvanceFrame();
+
+            const auto& viewUpdate = m_tileset->GetTileset().updateView(viewStates);
+            bool hasPendingLoads = viewUpdate.tilesLoadingLowPriority > 0 || viewUpdate.tilesLoadingMediumPriority > 0 ||
+                viewUpdate.tilesLoadingHighPriority > 0 || m_tileset->GetTileset().computeLoadProgress() < 100.0f;
+            if (!hasPendingLoads && !viewUpdate.tilesToRenderThisFrame.empty())
+            {
+                visibleTileIds.clear();
+                for (const Cesium3DTilesSelection::Tile* tile : viewUpdate.tilesToRenderThisFrame)
+                {
+                    visibleTileIds.emplace_back(Cesium3DTilesSelection::TileIdUtilities::createTileIdString(tile->getTileID()));
+                }
+
+                return frame + 1;
+            }
+        }
+
+        return MAXIMUM_FRAMES;
+    }
+
+    static Cesium::ViewportCamera GetCamera()
+    {
+        // above the tileset, looking 30 degrees down
+        glm::dvec3 direction = glm::normalize(glm::dvec3{ 1.0, 0.0, -0.577 });
+        glm::dvec3 up = glm::normalize(glm::dvec3{ 0.0, 0.0, 1.0 } - direction.z * direction);
+
+        Cesium::ViewportCamera camera;
+        camera.m_position = glm::dvec3{ -2000.0, 0.0, CAMERA_ALTITUDE };
+        camera.m_direction = direction;
+        camera.m_up = up;
+        camera.m_viewportSize = glm::dvec2{ 1920.0, 1080.0 };
+        camera.m_horizontalFieldOfView = glm::radians(90.0);
+        camera.m_verticalFieldOfView = glm::radians(60.0);
+        return camera;
+    }
+
+    static constexpr int TILESET_DEPTH = 6;
+    static constexpr std::uint32_t TILE_BYTES = 64 * 1024;
+    static constexpr std::uint32_t IO_LATENCY_FRAMES = 6;
+    static constexpr std::size_t MAXIMUM_FRAMES = 1000;
+    static constexpr double CAMERA_ALTITUDE = 500.0;
+    static constexpr std::uint64_t MAXIMUM_SNAPSHOT_BYTES = 256ull * 1024ull * 1024ull;
+
+    std::shared_ptr<Cesium::SnapshotAssetAccessor> m_snapshotAccessor;
+    std::unique_ptr<CesiumTests::SyntheticTileset> m_tileset;
+    Cesium::ViewStateProvider m_viewStateProvider;
+};
+
+BENCHMARK_DEFINE_F(SnapshotAssetAccessorBenchmark, TimeToFirstFullDetail)(benchmark::State& state)
+{
+    bool restoreSnapshot = state.range(0) != 0;
+    std::size_t framesToFullDetail = 0;
+    std::vector<std::string> visibleTileIds;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        // the previous session records the snapshot
+        state.PauseTiming();
+        Cesium::IOContent snapshot;
+        if (restoreSnapshot)
+        {
+            CreateTileset(nullptr);
+            LoadUntilFullDetail(visibleTileIds);
+            snapshot = m_snapshotAccessor->CreateSnapshot(visibleTileIds);
+            DestroyTileset();
+        }
+
+        CreateTileset(restoreSnapshot ? &snapshot : nullptr);
+        state.ResumeTiming();
+
+        framesToFullDetail += LoadUntilFullDetail(visibleTileIds);
+
+        state.PauseTiming();
+        DestroyTileset();
+        state.ResumeTiming();
+    }
+
+    state.counters["FramesToFullDetail"] =
+        benchmark::Counter(static_cast<double>(framesToFullDetail), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_REGISTER_F(SnapshotAssetAccessorBenchmark, TimeToFirstFullDetail)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+#endif
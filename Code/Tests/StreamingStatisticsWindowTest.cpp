@@ -0,0 +1,74 @@
+#include "Cesium/TilesetUtility/StreamingStatisticsWindow.h"
+#include <AzCore/UnitTest/TestTypes.h>
+
+class StreamingStatisticsWindowTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static Cesium::TilesetStreamingStatistics CreateFrame(std::uint32_t tilesVisited, float updateViewTime, std::uint32_t toggles)
+    {
+        Cesium::TilesetStreamingStatistics frame;
+        frame.m_tilesVisited = tilesVisited;
+        frame.m_tilesLoadingHighPriority = tilesVisited / 2;
+        frame.m_bytesCached = tilesVisited * 1000;
+        frame.m_updateViewTime = updateViewTime;
+        frame.m_visibilityToggles = toggles;
+        return frame;
+    }
+};
+
+TEST_F(StreamingStatisticsWindowTest, EmptyWindowReportsNoFrames)
+{
+    Cesium::StreamingStatisticsWindow window;
+    ASSERT_EQ(window.GetRolling().m_frameCount, 0u);
+    ASSERT_EQ(window.GetLatest().m_tilesVisited, 0u);
+}
+
+TEST_F(StreamingStatisticsWindowTest, AverageOverPushedFrames)
+{
+    Cesium::StreamingStatisticsWindow window;
+    window.Push(CreateFrame(10, 1.0f, 3));
+    window.Push(CreateFrame(30, 3.0f, 1));
+
+    ASSERT_EQ(window.GetLatest().m_tilesVisited, 30u);
+
+    Cesium::TilesetRollingStreamingStatistics rolling = window.GetRolling();
+    ASSERT_EQ(rolling.m_frameCount, 2u);
+    ASSERT_FLOAT_EQ(rolling.m_averageTilesVisited, 20.0f);
+    ASSERT_FLOAT_EQ(rolling.m_averageTilesLoading, 10.0f);
+    ASSERT_DOUBLE_EQ(rolling.m_averageBytesCached, 20000.0);
+    ASSERT_FLOAT_EQ(rolling.m_averageUpdateViewTime, 2.0f);
+    ASSERT_FLOAT_EQ(rolling.m_maxUpdateViewTime, 3.0f);
+    ASSERT_EQ(rolling.m_totalVisibilityToggles, 4u);
+}
+
+TEST_F(StreamingStatisticsWindowTest, OldFramesLeaveTheWindow)
+{
+    Cesium::StreamingStatisticsWindow window(2);
+    window.Push(CreateFrame(100, 50.0f, 10));
+    window.Push(CreateFrame(10, 1.0f, 1));
+    window.Push(CreateFrame(20, 2.0f, 1));
+
+    Cesium::TilesetRollingStreamingStatistics rolling = window.GetRolling();
+    ASSERT_EQ(rolling.m_frameCount, 2u);
+    ASSERT_FLOAT_EQ(rolling.m_averageTilesVisited, 15.0f);
+    ASSERT_FLOAT_EQ(rolling.m_maxUpdateViewTime, 2.0f);
+    ASSERT_EQ(rolling.m_totalVisibilityToggles, 2u);
+
+    window.Reset();
+    ASSERT_EQ(window.GetRolling().m_frameCount, 0u);
+}
+
+TEST_F(StreamingStatisticsWindowTest, SkippedUpdateViewsAreCounted)
+{
+    Cesium::StreamingStatisticsWindow window;
+    window.Push(CreateFrame(10, 1.0f, 3));
+
+    Cesium::TilesetStreamingStatistics skipped = CreateFrame(10, 0.0f, 0);
+    skipped.m_updateViewSkipped = true;
+    window.Push(skipped);
+    window.Push(skipped);
+
+    Cesium::TilesetRollingStreamingStatistics rolling = window.GetRolling();
+    ASSERT_EQ(rolling.m_skippedUpdateViews, 2u);
+    ASSERT_TRUE(window.GetLatest().m_updateViewSkipped);
+}
@@ -0,0 +1,357 @@
+#pragma once
+
+#include "Cesium/Systems/DeterministicTaskQueue.h"
+#include "Cesium/Systems/GenericAssetAccessor.h"
+#include "Cesium/Systems/GenericIOManager.h"
+#include "Cesium/Systems/TaskProcessor.h"
+#include <AzCore/std/containers/deque.h>
+#include <CesiumAsync/AsyncSystem.h>
+#include <Cesium3DTilesSelection/CreditSystem.h>
+#include <Cesium3DTilesSelection/IPrepareRendererResources.h>
+#include <Cesium3DTilesSelection/Tileset.h>
+#include <Cesium3DTilesSelection/TilesetExternals.h>
+#include <spdlog/logger.h>
+#include <spdlog/sinks/null_sink.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace CesiumTests
+{
+    // Serves synthetic files from memory. With a latency, the requests are answered after that many calls to AdvanceFrame(), so
+    // the tile loads take several frames like they do over a network. The requests are not thread safe, so the tileset must run on
+    // a deterministic task queue.
+    class InMemoryIOManager final : public Cesium::GenericIOManager
+    {
+    public:
+        InMemoryIOManager()
+            : m_latencyFrames{ 0 }
+        {
+        }
+
+        explicit InMemoryIOManager(const std::string& tilesetJson)
+            : m_latencyFrames{ 0 }
+        {
+            AddFile("tileset.json", tilesetJson.data(), tilesetJson.size());
+        }
+
+        void AddFile(const std::string& path, const void* data, std::size_t size)
+        {
+            const std::byte* begin = reinterpret_cast<const std::byte*>(data);
+            m_files[path] = Cesium::IOContent(begin, begin + size);
+        }
+
+        // served for the paths without a file of their own, so every tile of a large tileset can have its own uri
+        void SetDefaultFile(const void* data, std::size_t size)
+        {
+            const std::byte* begin = reinterpret_cast<const std::byte*>(data);
+            m_defaultFile = Cesium::IOContent(begin, begin + size);
+        }
+
+        void SetLatency(std::uint32_t latencyFrames)
+        {
+            m_latencyFrames = latencyFrames;
+        }
+
+        // answer the requests that have waited for the latency
+        void AdvanceFrame()
+        {
+            for (PendingRequest& request : m_pendingRequests)
+            {
+                --request.m_remainingFrames;
+            }
+
+            while (!m_pendingRequests.empty() && m_pendingRequests.front().m_remainingFrames == 0)
+            {
+                PendingRequest request = std::move(m_pendingRequests.front());
+                m_pendingRequests.pop_front();
+                request.m_promise.resolve(std::move(request.m_content));
+            }
+        }
+
+        std::size_t GetPendingRequestCount() const
+        {
+            return m_pendingRequests.size();
+        }
+
+        AZStd::string GetParentPath([[maybe_unused]] const AZStd::string& path) override
+        {
+            return "";
+        }
+
+        // a file added with a query only answers that query, the others answer any query like a static file server
+        Cesium::IOContent GetFileContent(const Cesium::IORequestParameter& request) override
+        {
+            std::string path = request.m_path.c_str();
+            auto file = m_files.find(path);
+            if (file == m_files.end())
+            {
+                file = m_files.find(path.substr(0, path.find('?')));
+            }
+
+            if (file == m_files.end())
+            {
+                return m_defaultFile;
+            }
+
+            return file->second;
+        }
+
+        Cesium::IOContent GetFileContent(Cesium::IORequestParameter&& request) override
+        {
+            return GetFileContent(request);
+        }
+
+        CesiumAsync::Future<Cesium::IOContent> GetFileContentAsync(
+            const CesiumAsync::AsyncSystem& asyncSystem, const Cesium::IORequestParameter& request) override
+        {
+            if (m_latencyFrames == 0)
+            {
+                return asyncSystem.createResolvedFuture(GetFileContent(request));
+            }
+
+            // every request has the same latency, so the queue stays sorted by the remaining frames
+            CesiumAsync::Promise<Cesium::IOContent> promise = asyncSystem.createPromise<Cesium::IOContent>();
+            CesiumAsync::Future<Cesium::IOContent> future = promise.getFuture();
+            m_pendingRequests.push_back(PendingRequest{ m_latencyFrames, std::move(promise), GetFileContent(request) });
+            return future;
+        }
+
+        CesiumAsync::Future<Cesium::IOContent> GetFileContentAsync(
+            const CesiumAsync::AsyncSystem& asyncSystem, Cesium::IORequestParameter&& request) override
+        {
+            return GetFileContentAsync(asyncSystem, request);
+        }
+
+    private:
+        struct PendingRequest
+        {
+            std::uint32_t m_remainingFrames;
+            CesiumAsync::Promise<Cesium::IOContent> m_promise;
+            Cesium::IOContent m_content;
+        };
+
+        std::map<std::string, Cesium::IOContent> m_files;
+        Cesium::IOContent m_defaultFile;
+        AZStd::deque<PendingRequest> m_pendingRequests;
+        std::uint32_t m_latencyFrames;
+    };
+
+    class NullRendererResources final : public Cesium3DTilesSelection::IPrepareRendererResources
+    {
+    public:
+        void* prepareInLoadThread([[maybe_unused]] const CesiumGltf::Model& model, [[maybe_unused]] const glm::dmat4& transform) override
+        {
+            return nullptr;
+        }
+
+        void* prepareInMainThread([[maybe_unused]] Cesium3DTilesSelection::Tile& tile, [[maybe_unused]] void* pLoadThreadResult) override
+        {
+            return nullptr;
+        }
+
+        void free(
+            [[maybe_unused]] Cesium3DTilesSelection::Tile& tile,
+            [[maybe_unused]] void* pLoadThreadResult,
+            [[maybe_unused]] void* pMainThreadResult) noexcept override
+        {
+        }
+
+        void* prepareRasterInLoadThread([[maybe_unused]] const CesiumGltf::ImageCesium& image) override
+        {
+            return nullptr;
+        }
+
+        void* prepareRasterInMainThread(
+            [[maybe_unused]] const Cesium3DTilesSelection::RasterOverlayTile& rasterTile, [[maybe_unused]] void* pLoadThreadResult) override
+        {
+            return nullptr;
+        }
+
+        void freeRaster(
+            [[maybe_unused]] const Cesium3DTilesSelection::RasterOverlayTile& rasterTile,
+            [[maybe_unused]] void* pLoadThreadResult,
+            [[maybe_unused]] void* pMainThreadResult) noexcept override
+        {
+        }
+
+        void attachRasterInMainThread(
+            [[maybe_unused]] const Cesium3DTilesSelection::Tile& tile,
+            [[maybe_unused]] std::int32_t overlayTextureCoordinateID,
+            [[maybe_unused]] const Cesium3DTilesSelection::RasterOverlayTile& rasterTile,
+            [[maybe_unused]] void* mainThreadRasterResources,
+            [[maybe_unused]] const glm::dvec2& translation,
+            [[maybe_unused]] const glm::dvec2& scale) override
+        {
+        }
+
+        void detachRasterInMainThread(
+            [[maybe_unused]] const Cesium3DTilesSelection::Tile& tile,
+            [[maybe_unused]] std::int32_t overlayTextureCoordinateID,
+            [[maybe_unused]] const Cesium3DTilesSelection::RasterOverlayTile& rasterTile,
+            [[maybe_unused]] void* mainThreadRasterResources) noexcept override
+        {
+        }
+    };
+
+    // a quadtree of boxes on the z = 0 plane. Without a content uri, the tiles are empty and only the traversal is measured.
+    // The {level}, {x} and {y} of the content uri are replaced by the coordinates of the tile
+    inline std::string CreateQuadtreeTileJson(
+        double centerX,
+        double centerY,
+        double halfSize,
+        double geometricError,
+        int depth,
+        const std::string& contentUri = "",
+        int level = 0,
+        int x = 0,
+        int y = 0)
+    {
+        std::string json = "{\"boundingVolume\":{\"box\":[" + std::to_string(centerX) + "," + std::to_string(centerY) + ",0," +
+            std::to_string(halfSize) + ",0,0,0," + std::to_string(halfSize) + ",0,0,0,10]},\"geometricError\":" +
+            std::to_string(geometricError) + ",\"refine\":\"REPLACE\"";
+        if (!contentUri.empty())
+        {
+            std::string tileUri = contentUri;
+            auto replace = [&tileUri](const std::string& placeholder, int value)
+            {
+                std::size_t position = tileUri.find(placeholder);
+                if (position != std::string::npos)
+                {
+                    tileUri.replace(position, placeholder.size(), std::to_string(value));
+                }
+            };
+
+            replace("{level}", level);
+            replace("{x}", x);
+            replace("{y}", y);
+            json += ",\"content\":{\"uri\":\"" + tileUri + "\"}";
+        }
+
+        if (depth > 0)
+        {
+            json += ",\"children\":[";
+            double childHalfSize = halfSize * 0.5;
+            for (int i = 0; i < 4; ++i)
+            {
+                double childX = centerX + ((i & 1) ? childHalfSize : -childHalfSize);
+                double childY = centerY + ((i & 2) ? childHalfSize : -childHalfSize);
+                json += (i > 0 ? "," : "") +
+                    CreateQuadtreeTileJson(
+                        childX, childY, childHalfSize, geometricError * 0.5, depth - 1, contentUri, level + 1, x * 2 + (i & 1),
+                        y * 2 + ((i >> 1) & 1));
+            }
+            json += "]";
+        }
+
+        return json + "}";
+    }
+
+    // a tileset json whose root is a quadtree of 20 km wide boxes centered on the origin
+    inline std::string CreateQuadtreeTilesetJson(int depth, const std::string& contentUri = "")
+    {
+        return "{\"asset\":{\"version\":\"1.0\"},\"geometricError\":20000,\"root\":" +
+            CreateQuadtreeTileJson(0.0, 0.0, 10000.0, 10000.0, depth, contentUri) + "}";
+    }
+
+    // a glb without meshes that only holds a binary buffer, so every tile counts bufferBytes in the tileset cache
+    inline std::string CreateBufferOnlyGlb(std::uint32_t bufferBytes)
+    {
+        std::string json = "{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":" + std::to_string(bufferBytes) + "}]}";
+        json.resize((json.size() + 3) & ~std::size_t{ 3 }, ' ');
+        std::uint32_t paddedBufferBytes = (bufferBytes + 3) & ~std::uint32_t{ 3 };
+
+        auto appendUint32 = [](std::string& glb, std::uint32_t value)
+        {
+            char bytes[sizeof(value)];
+            std::memcpy(bytes, &value, sizeof(value));
+            glb.append(bytes, sizeof(value));
+        };
+
+        std::string glb = "glTF";
+        appendUint32(glb, 2);
+        appendUint32(glb, static_cast<std::uint32_t>(12 + 8 + json.size() + 8 + paddedBufferBytes));
+        appendUint32(glb, static_cast<std::uint32_t>(json.size()));
+        glb += "JSON";
+        glb += json;
+        appendUint32(glb, paddedBufferBytes);
+        glb.append("BIN\0", 4);
+        glb.append(paddedBufferBytes, '\0');
+        return glb;
+    }
+
+    // A tileset over the files of the IO manager. Every task runs on a deterministic queue, so the frames of the tileset are
+    // reproducible. The asset accessor over the files can be wrapped, like by the snapshot accessor, before the tileset uses it
+    class SyntheticTileset final
+    {
+    public:
+        using AccessorWrapper =
+            std::function<std::shared_ptr<CesiumAsync::IAssetAccessor>(std::shared_ptr<CesiumAsync::IAssetAccessor>)>;
+
+        SyntheticTileset(
+            std::unique_ptr<InMemoryIOManager> ioManager, const std::string& contentType, const AccessorWrapper& wrapAccessor = nullptr)
+            : m_ioManager{ std::move(ioManager) }
+            , m_taskQueue{ std::make_unique<Cesium::DeterministicTaskQueue>() }
+            , m_asyncSystem{ std::make_unique<CesiumAsync::AsyncSystem>(std::make_shared<Cesium::TaskProcessor>(m_taskQueue.get())) }
+        {
+            std::shared_ptr<CesiumAsync::IAssetAccessor> assetAccessor =
+                std::make_shared<Cesium::GenericAssetAccessor>(m_ioManager.get(), contentType);
+            if (wrapAccessor)
+            {
+                assetAccessor = wrapAccessor(std::move(assetAccessor));
+            }
+
+            Cesium3DTilesSelection::TilesetExternals externals{
+                std::move(assetAccessor),
+                std::make_shared<NullRendererResources>(),
+                *m_asyncSystem,
+                std::make_shared<Cesium3DTilesSelection::CreditSystem>(),
+                std::make_shared<spdlog::logger>("benchmark", std::make_shared<spdlog::sinks::null_sink_mt>()),
+            };
+            m_tileset = std::make_unique<Cesium3DTilesSelection::Tileset>(externals, "tileset.json");
+        }
+
+        ~SyntheticTileset() noexcept
+        {
+            // answer the requests still in flight, so the tileset does not wait for them when it's destroyed
+            while (m_ioManager->GetPendingRequestCount() > 0)
+            {
+                AdvanceFrame();
+            }
+
+            m_tileset.reset();
+            m_taskQueue->RunPending();
+            m_asyncSystem.reset();
+            m_taskQueue.reset();
+            m_ioManager.reset();
+        }
+
+        // answer the requests that have waited for the latency, and run the tasks queued since the last frame
+        void AdvanceFrame()
+        {
+            m_ioManager->AdvanceFrame();
+            m_taskQueue->RunPending();
+        }
+
+        Cesium3DTilesSelection::Tileset& GetTileset()
+        {
+            return *m_tileset;
+        }
+
+        CesiumAsync::AsyncSystem& GetAsyncSystem()
+        {
+            return *m_asyncSystem;
+        }
+
+    private:
+        std::unique_ptr<InMemoryIOManager> m_ioManager;
+        std::unique_ptr<Cesium::DeterministicTaskQueue> m_taskQueue;
+        std::unique_ptr<CesiumAsync::AsyncSystem> m_asyncSystem;
+        std::unique_ptr<Cesium3DTilesSelection::Tileset> m_tileset;
+    };
+} // namespace CesiumTests
@@ -0,0 +1,209 @@
+#include "Cesium/Systems/ThreadAffinityPolicy.h"
+#include "Cesium/Systems/TaskProcessor.h"
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+class ThreadAffinityPolicyTest : public UnitTest::AllocatorsTestFixture
+{
+};
+
+TEST_F(ThreadAffinityPolicyTest, DefaultPolicyPinsWorkersToEveryCore)
+{
+    Cesium::ThreadAffinityPolicy policy;
+    auto workers = policy.CreateWorkerThreadDescs(4);
+    ASSERT_EQ(workers.size(), 4u);
+    for (std::size_t i = 0; i < workers.size(); ++i)
+    {
+        ASSERT_EQ(workers[i].m_cpuId, static_cast<int>(i));
+        ASSERT_EQ(workers[i].m_priority, Cesium::ThreadAffinityPolicy::DEFAULT_PRIORITY);
+    }
+
+    ASSERT_EQ(policy.CreateHttpThreadDescs(4).size(), 4u);
+    ASSERT_EQ(policy.CreateFileThreadDescs(4).size(), 2u);
+}
+
+TEST_F(ThreadAffinityPolicyTest, ReservedAndEfficiencyCoresAreSplit)
+{
+    Cesium::ThreadAffinityPolicy policy;
+    policy.m_reservedCores = 2;
+    policy.m_efficiencyCores = 2;
+    policy.m_workerPriority = 1;
+    policy.m_ioPriority = -1;
+
+    auto workers = policy.CreateWorkerThreadDescs(8);
+    ASSERT_EQ(workers.size(), 4u);
+    for (std::size_t i = 0; i < workers.size(); ++i)
+    {
+        ASSERT_EQ(workers[i].m_cpuId, static_cast<int>(i + 2));
+        ASSERT_EQ(workers[i].m_priority, 1);
+    }
+
+    auto httpThreads = policy.CreateHttpThreadDescs(8);
+    ASSERT_EQ(httpThreads.size(), 8u);
+    for (std::size_t i = 0; i < httpThreads.size(); ++i)
+    {
+        ASSERT_EQ(httpThreads[i].m_cpuId, static_cast<int>(6 + i % 2));
+        ASSERT_EQ(httpThreads[i].m_priority, -1);
+    }
+
+    auto fileThreads = policy.CreateFileThreadDescs(8);
+    ASSERT_EQ(fileThreads.size(), 2u);
+    ASSERT_EQ(fileThreads[0].m_cpuId, 6);
+    ASSERT_EQ(fileThreads[1].m_cpuId, 7);
+}
+
+TEST_F(ThreadAffinityPolicyTest, AlwaysLeaveOneCoreToCesium)
+{
+    Cesium::ThreadAffinityPolicy policy;
+    policy.m_reservedCores = 16;
+    policy.m_efficiencyCores = 16;
+
+    auto workers = policy.CreateWorkerThreadDescs(4);
+    ASSERT_EQ(workers.size(), 1u);
+    ASSERT_EQ(workers[0].m_cpuId, 3);
+
+    auto fileThreads = policy.CreateFileThreadDescs(4);
+    ASSERT_EQ(fileThreads[0].m_cpuId, 3);
+    ASSERT_EQ(fileThreads[1].m_cpuId, 3);
+}
+
+TEST_F(ThreadAffinityPolicyTest, UnpinnedThreadsHaveNoAffinity)
+{
+    Cesium::ThreadAffinityPolicy policy;
+    policy.m_pinThreads = false;
+    policy.m_workerThreadCount = 3;
+    auto workers = policy.CreateWorkerThreadDescs(8);
+    ASSERT_EQ(workers.size(), 3u);
+    for (const auto& worker : workers)
+    {
+        ASSERT_EQ(worker.m_cpuId, -1);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+// Simulates engine frames on the benchmark thread while the task processor is saturated with tile work, and reports the
+// standard deviation of the frame time. The argument is the number of reserved cores.
+class ThreadAffinityPolicyBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+public:
+    void SetUp(const ::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        CreateAllocators();
+    }
+
+    void SetUp(::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        CreateAllocators();
+    }
+
+    void TearDown(const ::benchmark::State& state) override
+    {
+        DestroyAllocators();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+    void TearDown(::benchmark::State& state) override
+    {
+        DestroyAllocators();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+protected:
+    static void CreateAllocators()
+    {
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+    }
+
+    static void DestroyAllocators()
+    {
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+    }
+
+    static void SimulateWork(std::chrono::microseconds duration)
+    {
+        auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end)
+        {
+        }
+    }
+
+    static constexpr std::size_t FRAME_COUNT = 60;
+    static constexpr std::chrono::microseconds FRAME_WORK{ 2000 };
+    static constexpr std::chrono::microseconds TASK_WORK{ 5000 };
+};
+
+BENCHMARK_DEFINE_F(ThreadAffinityPolicyBenchmark, FrameTimeVariance)(benchmark::State& state)
+{
+    Cesium::ThreadAffinityPolicy policy;
+    policy.m_reservedCores = static_cast<std::uint32_t>(state.range(0));
+    Cesium::TaskProcessor taskProcessor(policy);
+
+    double totalStdDev = 0.0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::atomic_bool stop{ false };
+        std::atomic<std::size_t> runningTasks{ 0 };
+        std::size_t taskCount = AZStd::thread::hardware_concurrency() * 2;
+        for (std::size_t i = 0; i < taskCount; ++i)
+        {
+            ++runningTasks;
+            taskProcessor.startTask(
+                [&stop, &runningTasks]()
+                {
+                    while (!stop)
+                    {
+                        SimulateWork(TASK_WORK);
+                    }
+
+                    --runningTasks;
+                });
+        }
+
+        std::vector<double> frameTimes;
+        frameTimes.reserve(FRAME_COUNT);
+        for (std::size_t frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            SimulateWork(FRAME_WORK);
+            frameTimes.emplace_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count());
+        }
+
+        stop = true;
+        while (runningTasks > 0)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        double mean = 0.0;
+        for (double frameTime : frameTimes)
+        {
+            mean += frameTime;
+        }
+        mean /= static_cast<double>(frameTimes.size());
+
+        double variance = 0.0;
+        for (double frameTime : frameTimes)
+        {
+            variance += (frameTime - mean) * (frameTime - mean);
+        }
+        totalStdDev += std::sqrt(variance / static_cast<double>(frameTimes.size()));
+    }
+
+    state.counters["FrameTimeStdDevUs"] = benchmark::Counter(totalStdDev, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_REGISTER_F(ThreadAffinityPolicyBenchmark, FrameTimeVariance)->Arg(0)->Arg(2)->Unit(benchmark::kMillisecond);
+#endif
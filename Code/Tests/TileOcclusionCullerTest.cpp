@@ -0,0 +1,390 @@
+#include "Cesium/TilesetUtility/TileOcclusionCuller.h"
+#include "Cesium/Systems/TileOccluderRegistry.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+#if defined(HAVE_BENCHMARK)
+#include "SyntheticTileset.h"
+#include <AzCore/Memory/PoolAllocator.h>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#endif
+
+namespace
+{
+    glm::dvec3 ToCartesian(double longitude, double latitude, double height)
+    {
+        return CesiumGeospatial::Ellipsoid::WGS84.cartographicToCartesian(CesiumGeospatial::Cartographic{ longitude, latitude, height });
+    }
+
+    // looking east from a point on the equator, where east is +y and up is +x
+    Cesium3DTilesSelection::ViewState CreateViewState(double longitude, double height)
+    {
+        glm::dvec3 up = CesiumGeospatial::Ellipsoid::WGS84.geodeticSurfaceNormal(CesiumGeospatial::Cartographic{ longitude, 0.0 });
+        glm::dvec3 east{ -std::sin(longitude), std::cos(longitude), 0.0 };
+        return Cesium3DTilesSelection::ViewState::create(
+            ToCartesian(longitude, 0.0, height), east, up, glm::dvec2{ 1920.0, 1080.0 }, glm::radians(90.0), glm::radians(60.0));
+    }
+
+    Cesium3DTilesSelection::BoundingVolume CreateRegion(
+        double west, double south, double east, double north, double minimumHeight, double maximumHeight)
+    {
+        return CesiumGeospatial::BoundingRegion{ CesiumGeospatial::GlobeRectangle{ west, south, east, north }, minimumHeight,
+                                                 maximumHeight };
+    }
+} // namespace
+
+class TileOcclusionCullerTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    // a ridge from 1.3 km to 3.8 km east of the camera, with solid ground up to 500 meters
+    static Cesium3DTilesSelection::BoundingVolume CreateRidge()
+    {
+        return CreateRegion(0.0002, -0.0005, 0.0006, 0.0005, 500.0, 600.0);
+    }
+};
+
+TEST_F(TileOcclusionCullerTest, TilesBehindTheHorizonAreCulled)
+{
+    Cesium::TileOcclusionCuller culler;
+    culler.Configure(true, false, false);
+    culler.SetViews({ CreateViewState(0.0, 100.0) }, glm::dmat4{ 1.0 });
+    culler.SetHorizonHeight(0.0);
+
+    // the horizon is about 36 km away, and a tile 64 km away must be above 50 meters to be seen
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0095, -0.0005, 0.0105, 0.0005, 0.0, 10.0)), Cesium::TileOcclusionCuller::CullResult::BelowHorizon);
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0095, -0.0005, 0.0105, 0.0005, 0.0, 1000.0)), Cesium::TileOcclusionCuller::CullResult::Visible);
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0015, -0.0005, 0.0025, 0.0005, 0.0, 10.0)), Cesium::TileOcclusionCuller::CullResult::Visible);
+    ASSERT_EQ(
+        culler.Cull(CreateRegion(3.1, -0.0005, 3.11, 0.0005, 0.0, 1000.0)), Cesium::TileOcclusionCuller::CullResult::BelowHorizon);
+
+    // lowering the horizon for the tiles below sea level keeps them
+    culler.SetHorizonHeight(-1000.0);
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0095, -0.0005, 0.0105, 0.0005, 0.0, 10.0)), Cesium::TileOcclusionCuller::CullResult::Visible);
+}
+
+TEST_F(TileOcclusionCullerTest, CornersBelowSeaLevelLowerTheHorizon)
+{
+    Cesium::TileOcclusionCuller culler;
+    culler.Configure(true, false, false);
+    culler.SetViews({ CreateViewState(0.0, 100.0) }, glm::dmat4{ 1.0 });
+    culler.SetHorizonHeight(0.0);
+
+    // a box down to 430 meters below sea level, like the shore of the Dead Sea, 64 km away. It is not a region, so only its
+    // corners tell how low it goes
+    glm::dvec3 up = CesiumGeospatial::Ellipsoid::WGS84.geodeticSurfaceNormal(CesiumGeospatial::Cartographic{ 0.01, 0.0 });
+    glm::dvec3 east{ -std::sin(0.01), std::cos(0.01), 0.0 };
+    glm::dvec3 north = glm::cross(up, east);
+    Cesium3DTilesSelection::BoundingVolume shore =
+        CesiumGeometry::OrientedBoundingBox{ ToCartesian(0.01, 0.0, -425.0), glm::dmat3{ east * 500.0, north * 500.0, up * 5.0 } };
+    ASSERT_EQ(culler.Cull(shore), Cesium::TileOcclusionCuller::CullResult::BelowHorizon);
+
+    double lowestHeight = culler.ComputeLowestHeight(shore);
+    ASSERT_NEAR(lowestHeight, -430.0, 1.0);
+    culler.SetHorizonHeight(lowestHeight - Cesium::TileOcclusionCuller::HORIZON_HEIGHT_MARGIN);
+    ASSERT_EQ(culler.Cull(shore), Cesium::TileOcclusionCuller::CullResult::Visible);
+
+    // a tileset that is not georeferenced is around the earth center, where there is no height
+    Cesium3DTilesSelection::BoundingVolume local = CesiumGeometry::OrientedBoundingBox{ glm::dvec3{ 0.0 }, glm::dmat3{ 10.0 } };
+    ASSERT_EQ(culler.ComputeLowestHeight(local), 0.0);
+}
+
+TEST_F(TileOcclusionCullerTest, GroundOfRegionHidesTilesBehindIt)
+{
+    Cesium::TileOcclusionCuller culler;
+    culler.Configure(false, true, false);
+    culler.SetViews({ CreateViewState(0.0, 50.0) }, glm::dmat4{ 1.0 });
+    ASSERT_TRUE(culler.AddOccluder(CreateRidge()));
+    ASSERT_EQ(culler.GetOwnOccluders().size(), 1u);
+
+    // the valley behind the ridge is hidden, but not a mountain that is higher than the ridge or a tile next to it
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0010, -0.0001, 0.0012, 0.0001, 0.0, 100.0)), Cesium::TileOcclusionCuller::CullResult::Occluded);
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0010, -0.0001, 0.0012, 0.0001, 0.0, 5000.0)), Cesium::TileOcclusionCuller::CullResult::Visible);
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0010, 0.0030, 0.0012, 0.0032, 0.0, 100.0)), Cesium::TileOcclusionCuller::CullResult::Visible);
+
+    // the other bounding volumes can be culled, but don't make occluders
+    Cesium3DTilesSelection::BoundingVolume sphere = CesiumGeometry::BoundingSphere{ ToCartesian(0.0011, 0.0, 50.0), 50.0 };
+    ASSERT_EQ(culler.Cull(sphere), Cesium::TileOcclusionCuller::CullResult::Occluded);
+    ASSERT_FALSE(culler.AddOccluder(sphere));
+    ASSERT_FALSE(culler.AddOccluder(CreateRegion(0.0, -0.5, 0.5, 0.5, 0.0, 100.0)));
+}
+
+TEST_F(TileOcclusionCullerTest, TileMustBeHiddenInEveryView)
+{
+    Cesium::TileOcclusionCuller culler;
+    culler.Configure(false, true, false);
+    culler.SetViews({ CreateViewState(0.0, 50.0), CreateViewState(0.0, 20000.0) }, glm::dmat4{ 1.0 });
+    ASSERT_TRUE(culler.AddOccluder(CreateRidge()));
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0010, -0.0001, 0.0012, 0.0001, 0.0, 100.0)), Cesium::TileOcclusionCuller::CullResult::Visible);
+
+    // nothing is culled when the culling is off
+    culler.Configure(false, false, true);
+    culler.SetViews({ CreateViewState(0.0, 50.0) }, glm::dmat4{ 1.0 });
+    ASSERT_TRUE(culler.AddOccluder(CreateRidge()));
+    ASSERT_EQ(culler.Cull(CreateRegion(0.0010, -0.0001, 0.0012, 0.0001, 0.0, 100.0)), Cesium::TileOcclusionCuller::CullResult::Visible);
+}
+
+TEST_F(TileOcclusionCullerTest, LargestOccludersAreKept)
+{
+    Cesium::TileOcclusionCuller culler;
+    culler.Configure(false, true, false);
+    culler.SetViews({ CreateViewState(0.0, 50.0) }, glm::dmat4{ 1.0 });
+
+    // the same regions further and further away
+    std::size_t regionCount = Cesium::TileOcclusionCuller::MAXIMUM_OCCLUDER_COUNT + 16;
+    for (std::size_t i = 0; i < regionCount; ++i)
+    {
+        double west = 0.001 * static_cast<double>(i + 1);
+        ASSERT_TRUE(culler.AddOccluder(CreateRegion(west, -0.0002, west + 0.0002, 0.0002, 0.0, 10.0)));
+    }
+
+    const AZStd::vector<Cesium::TileOccluder>& occluders = culler.GetOwnOccluders();
+    ASSERT_EQ(occluders.size(), Cesium::TileOcclusionCuller::MAXIMUM_OCCLUDER_COUNT);
+    double maximumDistance = glm::length(ToCartesian(0.001 * (Cesium::TileOcclusionCuller::MAXIMUM_OCCLUDER_COUNT + 0.5), 0.0, 0.0) -
+                                         ToCartesian(0.0, 0.0, 50.0));
+    for (const Cesium::TileOccluder& occluder : occluders)
+    {
+        ASSERT_LT(glm::length(occluder.m_center - ToCartesian(0.0, 0.0, 50.0)), maximumDistance);
+    }
+}
+
+TEST_F(TileOcclusionCullerTest, SharedOccludersHideTilesOfOtherTilesets)
+{
+    Cesium::TileOccluderRegistry registry;
+    Cesium::TileOccluderRegistry::SourceId terrain = registry.AddSource();
+    Cesium::TileOccluderRegistry::SourceId buildings = registry.AddSource();
+
+    Cesium::TileOcclusionCuller terrainCuller;
+    terrainCuller.Configure(false, false, true);
+    terrainCuller.SetViews({ CreateViewState(0.0, 50.0) }, glm::dmat4{ 1.0 });
+    ASSERT_TRUE(terrainCuller.AddOccluder(CreateRidge()));
+    registry.SubmitOccluders(terrain, terrainCuller.GetOwnOccluders());
+
+    // a tileset only sees the occluders of the others
+    AZStd::vector<Cesium::TileOccluder> occluders;
+    registry.CollectOccluders(terrain, occluders);
+    ASSERT_TRUE(occluders.empty());
+    registry.CollectOccluders(buildings, occluders);
+    ASSERT_EQ(occluders.size(), 1u);
+
+    // the buildings are placed with a transform, like a tileset that is not georeferenced
+    glm::dvec3 origin = ToCartesian(0.0011, 0.0, 0.0);
+    glm::dmat4 transform{ 1.0 };
+    transform[3] = glm::dvec4(origin, 1.0);
+    Cesium3DTilesSelection::ViewState viewState = CreateViewState(0.0, 50.0);
+    Cesium3DTilesSelection::ViewState localViewState = Cesium3DTilesSelection::ViewState::create(
+        viewState.getPosition() - origin, viewState.getDirection(), viewState.getUp(), viewState.getViewportSize(),
+        viewState.getHorizontalFieldOfView(), viewState.getVerticalFieldOfView());
+
+    Cesium::TileOcclusionCuller buildingCuller;
+    buildingCuller.Configure(false, true, false);
+    buildingCuller.SetViews({ localViewState }, transform);
+    buildingCuller.AddSharedOccluders(occluders);
+    Cesium3DTilesSelection::BoundingVolume building =
+        CesiumGeometry::OrientedBoundingBox{ glm::dvec3{ 20.0, 0.0, 0.0 }, glm::dmat3{ 20.0 } };
+    ASSERT_EQ(buildingCuller.Cull(building), Cesium::TileOcclusionCuller::CullResult::Occluded);
+
+    registry.RemoveSource(terrain);
+    occluders.clear();
+    registry.CollectOccluders(buildings, occluders);
+    ASSERT_TRUE(occluders.empty());
+}
+
+#if defined(HAVE_BENCHMARK)
+// A quadtree-like grid of terrain tiles east of a camera standing in a valley, with a ridge across the grid. The tiles behind the
+// ridge are hidden, and the far ones are behind the horizon. The argument selects the tests: 0 horizon, 1 occlusion, 2 both
+class TileOcclusionCullerBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+protected:
+    static std::vector<Cesium3DTilesSelection::BoundingVolume> CreateScene()
+    {
+        std::vector<Cesium3DTilesSelection::BoundingVolume> tiles;
+        for (std::size_t x = 0; x < GRID_SIZE; ++x)
+        {
+            for (std::size_t y = 0; y < GRID_SIZE; ++y)
+            {
+                // the tiles grow with the distance, like the selected tiles of a quadtree
+                double west = TILE_ANGLE * static_cast<double>(x * x + x);
+                double east = TILE_ANGLE * static_cast<double>((x + 1) * (x + 1) + x + 1);
+                double south = (static_cast<double>(y) - 0.5 * GRID_SIZE) * (east - west);
+                double north = south + (east - west);
+                bool isRidge = x == RIDGE_COLUMN;
+                tiles.emplace_back(CreateRegion(west, south, east, north, isRidge ? 400.0 : 0.0, isRidge ? 600.0 : 80.0));
+            }
+        }
+
+        return tiles;
+    }
+
+    static constexpr std::size_t GRID_SIZE = 32;
+    static constexpr std::size_t RIDGE_COLUMN = 4;
+    static constexpr double TILE_ANGLE = 0.00002;
+};
+
+BENCHMARK_DEFINE_F(TileOcclusionCullerBenchmark, CullTerrain)(benchmark::State& state)
+{
+    std::vector<Cesium3DTilesSelection::BoundingVolume> tiles = CreateScene();
+    std::vector<Cesium3DTilesSelection::ViewState> viewStates{ CreateViewState(0.0, 20.0) };
+    Cesium::TileOcclusionCuller culler;
+    culler.Configure(state.range(0) != 1, state.range(0) != 0, false);
+
+    std::size_t culledTiles = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        culler.SetViews(viewStates, glm::dmat4{ 1.0 });
+        culler.SetHorizonHeight(-Cesium::TileOcclusionCuller::HORIZON_HEIGHT_MARGIN);
+        for (const Cesium3DTilesSelection::BoundingVolume& tile : tiles)
+        {
+            culler.AddOccluder(tile);
+        }
+
+        culledTiles = 0;
+        for (const Cesium3DTilesSelection::BoundingVolume& tile : tiles)
+        {
+            culledTiles += culler.Cull(tile) != Cesium::TileOcclusionCuller::CullResult::Visible ? 1 : 0;
+        }
+
+        benchmark::DoNotOptimize(culledTiles);
+    }
+
+    state.SetItemsProcessed(state.iterations() * tiles.size());
+    state.counters["Tiles"] = static_cast<double>(tiles.size());
+    state.counters["TilesCulled"] = static_cast<double>(culledTiles);
+    state.counters["Occluders"] = static_cast<double>(culler.GetOwnOccluders().size());
+}
+
+BENCHMARK_REGISTER_F(TileOcclusionCullerBenchmark, CullTerrain)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMicrosecond);
+
+// A synthetic quadtree lying on the equator, seen from 2 meters above its west edge while looking east. The tiles are culled after
+// the selection, so the tiles refined and loaded are the same with and without culling. The argument enables the culling
+class TileOcclusionCullerTilesetBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+public:
+    void SetUp(const ::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        CreateTileset();
+    }
+
+    void SetUp(::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        CreateTileset();
+    }
+
+    void TearDown(const ::benchmark::State& state) override
+    {
+        DestroyTileset();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+    void TearDown(::benchmark::State& state) override
+    {
+        DestroyTileset();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+protected:
+    void CreateTileset()
+    {
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+        // the east north up frame at longitude 0 and latitude 0, so the quadtree is in ECEF
+        std::string tilesetJson = CesiumTests::CreateQuadtreeTilesetJson(TILESET_DEPTH);
+        tilesetJson.insert(
+            tilesetJson.find("\"root\":{") + 8, "\"transform\":[0,1,0,0,0,0,1,0,1,0,0,0," + std::to_string(EQUATORIAL_RADIUS) + ",0,0,1],");
+        m_tileset = std::make_unique<CesiumTests::SyntheticTileset>(
+            std::make_unique<CesiumTests::InMemoryIOManager>(tilesetJson), "application/json");
+        m_viewStates.emplace_back(CreateViewState(-10000.0 / EQUATORIAL_RADIUS, 2.0));
+
+        for (std::size_t i = 0; i < MAX_WARM_UP_FRAMES; ++i)
+        {
+            const auto& viewUpdate = m_tileset->GetTileset().updateView(m_viewStates);
+            m_tileset->AdvanceFrame();
+            if (viewUpdate.tilesLoadingLowPriority == 0 && viewUpdate.tilesLoadingMediumPriority == 0 &&
+                viewUpdate.tilesLoadingHighPriority == 0 && m_tileset->GetTileset().getRootTile() &&
+                m_tileset->GetTileset().computeLoadProgress() >= 100.0f)
+            {
+                break;
+            }
+        }
+    }
+
+    void DestroyTileset()
+    {
+        m_tileset.reset();
+        m_viewStates.clear();
+
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+    }
+
+    // return true if the tile or one of its descendants is rendered. The tiles refined are the ones not rendered in place of
+    // their rendered descendants
+    static bool CountTiles(
+        const Cesium3DTilesSelection::Tile& tile,
+        const std::unordered_set<const Cesium3DTilesSelection::Tile*>& renderedTiles,
+        std::size_t& tilesRefined,
+        std::size_t& tilesLoaded)
+    {
+        tilesLoaded += tile.getState() == Cesium3DTilesSelection::Tile::LoadState::Done ? 1 : 0;
+        bool rendersDescendants = false;
+        for (const Cesium3DTilesSelection::Tile& child : tile.getChildren())
+        {
+            rendersDescendants |= CountTiles(child, renderedTiles, tilesRefined, tilesLoaded);
+        }
+
+        tilesRefined += rendersDescendants ? 1 : 0;
+        return rendersDescendants || renderedTiles.count(&tile) > 0;
+    }
+
+    static constexpr int TILESET_DEPTH = 6;
+    static constexpr std::size_t MAX_WARM_UP_FRAMES = 1000;
+    static constexpr double EQUATORIAL_RADIUS = 6378137.0;
+
+    std::unique_ptr<CesiumTests::SyntheticTileset> m_tileset;
+    std::vector<Cesium3DTilesSelection::ViewState> m_viewStates;
+};
+
+BENCHMARK_DEFINE_F(TileOcclusionCullerTilesetBenchmark, CullSelection)(benchmark::State& state)
+{
+    Cesium::TileOcclusionCuller culler;
+    culler.Configure(state.range(0) != 0, state.range(0) != 0, false);
+
+    std::size_t tilesRendered = 0;
+    std::size_t tilesCulled = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto& viewUpdate = m_tileset->GetTileset().updateView(m_viewStates);
+        culler.Update(m_viewStates, glm::dmat4{ 1.0 }, viewUpdate.tilesToRenderThisFrame, {});
+        tilesRendered = viewUpdate.tilesToRenderThisFrame.size();
+        tilesCulled = culler.GetHorizonCulledTileCount() + culler.GetOcclusionCulledTileCount();
+        m_tileset->AdvanceFrame();
+    }
+
+    const auto& viewUpdate = m_tileset->GetTileset().updateView(m_viewStates);
+    std::unordered_set<const Cesium3DTilesSelection::Tile*> renderedTiles{ viewUpdate.tilesToRenderThisFrame.begin(),
+                                                                           viewUpdate.tilesToRenderThisFrame.end() };
+    std::size_t tilesRefined = 0;
+    std::size_t tilesLoaded = 0;
+    if (const Cesium3DTilesSelection::Tile* rootTile = m_tileset->GetTileset().getRootTile())
+    {
+        CountTiles(*rootTile, renderedTiles, tilesRefined, tilesLoaded);
+    }
+
+    state.counters["TilesRendered"] = static_cast<double>(tilesRendered);
+    state.counters["TilesCulled"] = static_cast<double>(tilesCulled);
+    state.counters["TilesRefined"] = static_cast<double>(tilesRefined);
+    state.counters["TilesLoaded"] = static_cast<double>(tilesLoaded);
+}
+
+BENCHMARK_REGISTER_F(TileOcclusionCullerTilesetBenchmark, CullSelection)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+#endif
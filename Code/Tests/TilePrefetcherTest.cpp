@@ -0,0 +1,215 @@
+#include "Cesium/TilesetUtility/TilePrefetcher.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+#if defined(HAVE_BENCHMARK)
+#include "Cesium/Systems/ViewStateProvider.h"
+#include "SyntheticTileset.h"
+#include <AzCore/Memory/PoolAllocator.h>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <memory>
+#include <string>
+#endif
+
+class TilePrefetcherTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static constexpr std::uint64_t MAXIMUM_PREFETCH_BYTES = 64ull * 1024ull * 1024ull;
+};
+
+TEST_F(TilePrefetcherTest, LookAheadShrinksOverByteCapAndRecovers)
+{
+    Cesium::TilePrefetcher prefetcher;
+    prefetcher.Configure(2.0f, MAXIMUM_PREFETCH_BYTES);
+    ASSERT_FLOAT_EQ(prefetcher.GetLookAhead(), 2.0f);
+
+    prefetcher.UpdateLookAheadScale(MAXIMUM_PREFETCH_BYTES + 1);
+    ASSERT_FLOAT_EQ(prefetcher.GetLookAhead(), 1.0f);
+    ASSERT_EQ(prefetcher.GetPrefetchedBytes(), MAXIMUM_PREFETCH_BYTES + 1);
+
+    // a prefetch that keeps exceeding the cap is turned off instead of shrinking forever
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        prefetcher.UpdateLookAheadScale(MAXIMUM_PREFETCH_BYTES * 2);
+    }
+    ASSERT_EQ(prefetcher.GetLookAhead(), 0.0f);
+
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        prefetcher.UpdateLookAheadScale(0);
+    }
+    ASSERT_FLOAT_EQ(prefetcher.GetLookAhead(), 2.0f);
+
+    prefetcher.UpdateLookAheadScale(MAXIMUM_PREFETCH_BYTES * 2);
+    prefetcher.Reset();
+    ASSERT_FLOAT_EQ(prefetcher.GetLookAhead(), 2.0f);
+    ASSERT_EQ(prefetcher.GetPrefetchedBytes(), 0u);
+}
+
+#if defined(HAVE_BENCHMARK)
+// A camera flying low and fast over a synthetic tileset whose tiles take several frames to load. The argument is the prefetch
+// look ahead in milliseconds, 0 disables the prefetch. The counters are the tiles rendered coarser than the screen space error in
+// the current view, summed over the flight, and the frames that have any of them
+class TilePrefetcherBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+public:
+    void SetUp(const ::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+    }
+
+    void SetUp(::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+    }
+
+    void TearDown(const ::benchmark::State& state) override
+    {
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+    void TearDown(::benchmark::State& state) override
+    {
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+protected:
+    void CreateTileset()
+    {
+        std::string tilesetJson = CesiumTests::CreateQuadtreeTilesetJson(TILESET_DEPTH, "tile.glb");
+        std::string tileGlb = CesiumTests::CreateBufferOnlyGlb(TILE_BYTES);
+        auto ioManager = std::make_unique<CesiumTests::InMemoryIOManager>(tilesetJson);
+        ioManager->AddFile("tile.glb", tileGlb.data(), tileGlb.size());
+        ioManager->SetLatency(IO_LATENCY_FRAMES);
+        m_tileset = std::make_unique<CesiumTests::SyntheticTileset>(std::move(ioManager), "application/octet-stream");
+        m_viewStateProvider.SetCameras({});
+        m_tilePrefetcher.Reset();
+    }
+
+    void DestroyTileset()
+    {
+        m_tileset.reset();
+    }
+
+    static Cesium::ViewportCamera GetCamera(std::size_t frame)
+    {
+        // forward along x, looking 30 degrees down
+        glm::dvec3 direction = glm::normalize(glm::dvec3{ 1.0, 0.0, -0.577 });
+        glm::dvec3 up = glm::normalize(glm::dvec3{ 0.0, 0.0, 1.0 } - direction.z * direction);
+
+        Cesium::ViewportCamera camera;
+        camera.m_position = glm::dvec3{ FLIGHT_START + CAMERA_SPEED * FRAME_TIME * static_cast<double>(frame), 0.0, CAMERA_ALTITUDE };
+        camera.m_direction = direction;
+        camera.m_up = up;
+        camera.m_viewportSize = glm::dvec2{ 1920.0, 1080.0 };
+        camera.m_horizontalFieldOfView = glm::radians(90.0);
+        camera.m_verticalFieldOfView = glm::radians(60.0);
+        return camera;
+    }
+
+    // a tile is blurry when it's rendered in the current view while its refined children should be
+    std::size_t CountBlurryTiles(
+        const std::vector<Cesium3DTilesSelection::ViewState>& viewStates, const std::vector<Cesium3DTilesSelection::Tile*>& tiles)
+    {
+        std::size_t blurryTiles = 0;
+        double maximumScreenSpaceError = m_tileset->GetTileset().getOptions().maximumScreenSpaceError;
+        for (const Cesium3DTilesSelection::Tile* tile : tiles)
+        {
+            if (tile->getChildren().empty())
+            {
+                continue;
+            }
+
+            for (const Cesium3DTilesSelection::ViewState& viewState : viewStates)
+            {
+                if (!viewState.isBoundingVolumeVisible(tile->getBoundingVolume()))
+                {
+                    continue;
+                }
+
+                double distance = std::sqrt(viewState.computeDistanceSquaredToBoundingVolume(tile->getBoundingVolume()));
+                if (viewState.computeScreenSpaceError(tile->getGeometricError(), distance) > maximumScreenSpaceError)
+                {
+                    ++blurryTiles;
+                    break;
+                }
+            }
+        }
+
+        return blurryTiles;
+    }
+
+    static constexpr int TILESET_DEPTH = 6;
+    static constexpr std::uint32_t TILE_BYTES = 64 * 1024;
+    static constexpr std::uint32_t IO_LATENCY_FRAMES = 6;
+    static constexpr std::size_t FLIGHT_FRAMES = 600;
+    static constexpr float FRAME_TIME = 1.0f / 60.0f;
+    static constexpr double FLIGHT_START = -4000.0;
+    static constexpr double CAMERA_SPEED = 400.0;
+    static constexpr double CAMERA_ALTITUDE = 500.0;
+    static constexpr std::uint64_t MAXIMUM_PREFETCH_BYTES = 64ull * 1024ull * 1024ull;
+
+    std::unique_ptr<CesiumTests::SyntheticTileset> m_tileset;
+    Cesium::ViewStateProvider m_viewStateProvider;
+    Cesium::TilePrefetcher m_tilePrefetcher;
+};
+
+BENCHMARK_DEFINE_F(TilePrefetcherBenchmark, ScriptedFlight)(benchmark::State& state)
+{
+    float lookAhead = static_cast<float>(state.range(0)) / 1000.0f;
+    m_tilePrefetcher.Configure(lookAhead, MAXIMUM_PREFETCH_BYTES);
+
+    std::size_t blurryTileFrames = 0;
+    std::size_t blurryFrames = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        CreateTileset();
+        state.ResumeTiming();
+
+        for (std::size_t frame = 0; frame < FLIGHT_FRAMES; ++frame)
+        {
+            m_tileset->AdvanceFrame();
+
+            m_viewStateProvider.SetCameras({ GetCamera(frame) }, FRAME_TIME);
+            const auto& viewStates = m_viewStateProvider.GetViewStates(glm::dmat4{ 1.0 });
+            std::vector<Cesium3DTilesSelection::ViewState> predictedViewStates;
+            if (m_tilePrefetcher.GetLookAhead() > 0.0f)
+            {
+                predictedViewStates = m_viewStateProvider.GetPredictedViewStates(glm::dmat4{ 1.0 }, m_tilePrefetcher.GetLookAhead());
+            }
+
+            std::vector<Cesium3DTilesSelection::ViewState> selectionViewStates = viewStates;
+            selectionViewStates.insert(selectionViewStates.end(), predictedViewStates.begin(), predictedViewStates.end());
+            const auto& viewUpdate = m_tileset->GetTileset().updateView(selectionViewStates);
+            if (lookAhead > 0.0f)
+            {
+                m_tilePrefetcher.Update(viewStates, predictedViewStates, viewUpdate.tilesToRenderThisFrame);
+            }
+
+            std::size_t blurryTiles = CountBlurryTiles(viewStates, viewUpdate.tilesToRenderThisFrame);
+            blurryTileFrames += blurryTiles;
+            blurryFrames += blurryTiles > 0 ? 1 : 0;
+        }
+
+        state.PauseTiming();
+        DestroyTileset();
+        state.ResumeTiming();
+    }
+
+    state.counters["BlurryTileFrames"] = benchmark::Counter(static_cast<double>(blurryTileFrames), benchmark::Counter::kAvgIterations);
+    state.counters["BlurryFrames"] = benchmark::Counter(static_cast<double>(blurryFrames), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_REGISTER_F(TilePrefetcherBenchmark, ScriptedFlight)->Arg(0)->Arg(500)->Arg(1000)->Arg(2000)->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,92 @@
+#include "Cesium/TilesetUtility/TileLoadLatencyTracker.h"
+#include "Cesium/TilesetUtility/TilesetDebugVisualizer.h"
+#include <AzCore/UnitTest/TestTypes.h>
+
+class TilesetDebugVisualizerTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static void RunFrame(
+        Cesium::TileLoadLatencyTracker& tracker,
+        const void* tile,
+        Cesium::TileLoadPhase phase,
+        Cesium::TileLoadLatencyTracker::Clock::time_point now)
+    {
+        tracker.BeginFrame();
+        tracker.Update(tile, phase, now);
+        tracker.EndFrame();
+    }
+
+    Cesium::TileLoadLatencyTracker::Clock::time_point m_start{};
+    int m_tile{ 0 };
+};
+
+TEST_F(TilesetDebugVisualizerTest, LatencyIsMeasuredFromFirstLoadingFrame)
+{
+    using namespace std::chrono_literals;
+    Cesium::TileLoadLatencyTracker tracker;
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Unloaded, m_start);
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Loading, m_start + 10ms);
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Loading, m_start + 20ms);
+    ASSERT_LT(tracker.GetLoadLatency(&m_tile), 0.0f);
+
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Loaded, m_start + 260ms);
+    ASSERT_FLOAT_EQ(tracker.GetLoadLatency(&m_tile), 250.0f);
+
+    // the latency stays while the tile is loaded
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Loaded, m_start + 500ms);
+    ASSERT_FLOAT_EQ(tracker.GetLoadLatency(&m_tile), 250.0f);
+}
+
+TEST_F(TilesetDebugVisualizerTest, LoadsInProgressWhenTrackingStartsAreUnknown)
+{
+    using namespace std::chrono_literals;
+    Cesium::TileLoadLatencyTracker tracker;
+    int loadedTile = 0;
+
+    tracker.BeginFrame();
+    tracker.Update(&m_tile, Cesium::TileLoadPhase::Loading, m_start);
+    tracker.Update(&loadedTile, Cesium::TileLoadPhase::Loaded, m_start);
+    tracker.EndFrame();
+
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Loaded, m_start + 100ms);
+    ASSERT_LT(tracker.GetLoadLatency(&m_tile), 0.0f);
+
+    // a reload after tracking started is measured
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Loading, m_start + 200ms);
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Loaded, m_start + 300ms);
+    ASSERT_FLOAT_EQ(tracker.GetLoadLatency(&m_tile), 100.0f);
+}
+
+TEST_F(TilesetDebugVisualizerTest, UnloadedAndMissingTilesAreForgotten)
+{
+    using namespace std::chrono_literals;
+    Cesium::TileLoadLatencyTracker tracker;
+    int otherTile = 0;
+
+    tracker.BeginFrame();
+    tracker.Update(&m_tile, Cesium::TileLoadPhase::Loaded, m_start);
+    tracker.Update(&otherTile, Cesium::TileLoadPhase::Loaded, m_start);
+    tracker.EndFrame();
+    ASSERT_EQ(tracker.GetTrackedTileCount(), 2u);
+
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Loaded, m_start + 10ms);
+    ASSERT_EQ(tracker.GetTrackedTileCount(), 1u);
+
+    RunFrame(tracker, &m_tile, Cesium::TileLoadPhase::Unloaded, m_start + 20ms);
+    ASSERT_EQ(tracker.GetTrackedTileCount(), 0u);
+}
+
+TEST_F(TilesetDebugVisualizerTest, LoadLatencyColorGoesFromGreenToRed)
+{
+    AZ::Color fast = Cesium::TilesetDebugVisualizer::GetLoadLatencyColor(0.0f, 1000.0f);
+    AZ::Color medium = Cesium::TilesetDebugVisualizer::GetLoadLatencyColor(500.0f, 1000.0f);
+    AZ::Color slow = Cesium::TilesetDebugVisualizer::GetLoadLatencyColor(5000.0f, 1000.0f);
+    AZ::Color unknown = Cesium::TilesetDebugVisualizer::GetLoadLatencyColor(-1.0f, 1000.0f);
+    ASSERT_TRUE(fast.IsClose(AZ::Color(0.0f, 1.0f, 0.0f, 1.0f)));
+    ASSERT_TRUE(medium.IsClose(AZ::Color(1.0f, 1.0f, 0.0f, 1.0f)));
+    ASSERT_TRUE(slow.IsClose(AZ::Color(1.0f, 0.0f, 0.0f, 1.0f)));
+    ASSERT_TRUE(unknown.IsClose(AZ::Color(0.5f, 0.5f, 0.5f, 1.0f)));
+
+    ASSERT_TRUE(Cesium::TilesetDebugVisualizer::GetDepthColor(1).IsClose(Cesium::TilesetDebugVisualizer::GetDepthColor(9)));
+    ASSERT_FALSE(Cesium::TilesetDebugVisualizer::GetDepthColor(1).IsClose(Cesium::TilesetDebugVisualizer::GetDepthColor(2)));
+}
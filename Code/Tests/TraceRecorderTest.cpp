@@ -0,0 +1,93 @@
+#include "Cesium/Systems/TraceRecorder.h"
+#include <AzCore/JSON/document.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+class TraceRecorderTest : public UnitTest::AllocatorsTestFixture
+{
+};
+
+TEST_F(TraceRecorderTest, DoNotRecordWhenStopped)
+{
+    Cesium::TraceRecorder recorder;
+    recorder.RecordInstant("Tile", "TileFirstVisible", "0/0/0");
+    ASSERT_TRUE(recorder.GetEvents().empty());
+
+    recorder.Start(4);
+    recorder.RecordInstant("Tile", "TileFirstVisible", "0/0/0");
+    recorder.Stop();
+    recorder.RecordInstant("Tile", "TileFirstVisible", "0/0/1");
+
+    auto events = recorder.GetEvents();
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_EQ(events[0].m_tag, "0/0/0");
+    ASSERT_TRUE(events[0].m_instant);
+}
+
+TEST_F(TraceRecorderTest, RingBufferKeepsNewestEvents)
+{
+    Cesium::TraceRecorder recorder;
+    recorder.Start(3);
+    for (std::int64_t i = 0; i < 5; ++i)
+    {
+        recorder.RecordComplete("Http", "HttpRequest", "", i, i + 1);
+    }
+
+    auto events = recorder.GetEvents();
+    ASSERT_EQ(events.size(), 3u);
+    ASSERT_EQ(events[0].m_timestamp, 2);
+    ASSERT_EQ(events[1].m_timestamp, 3);
+    ASSERT_EQ(events[2].m_timestamp, 4);
+    ASSERT_EQ(events[2].m_duration, 1);
+}
+
+TEST_F(TraceRecorderTest, ScopedEventRecordsToRegisteredRecorder)
+{
+    Cesium::TraceRecorder recorder;
+    Cesium::TraceRecorderInterface::Register(&recorder);
+
+    {
+        Cesium::ScopedTraceEvent traceEvent("File", "FileRead", "tileset.json");
+    }
+
+    recorder.Start(8);
+    {
+        Cesium::ScopedTraceEvent traceEvent("File", "FileRead", "tileset.json");
+    }
+
+    Cesium::TraceRecorderInterface::Unregister(&recorder);
+
+    auto events = recorder.GetEvents();
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_STREQ(events[0].m_category, "File");
+    ASSERT_STREQ(events[0].m_name, "FileRead");
+    ASSERT_EQ(events[0].m_tag, "tileset.json");
+    ASSERT_FALSE(events[0].m_instant);
+}
+
+TEST_F(TraceRecorderTest, ExportValidChromeTrace)
+{
+    Cesium::TraceRecorder recorder;
+    recorder.Start(8);
+    recorder.RecordComplete("Http", "HttpRequest", "https://example.com/tile?a=\"b\"", 10, 25);
+    recorder.RecordInstant("Tile", "TileFirstVisible", "");
+
+    AZStd::string json = recorder.ExportChromeTrace();
+    rapidjson::Document document;
+    document.Parse(json.c_str());
+    ASSERT_FALSE(document.HasParseError());
+
+    const auto& traceEvents = document["traceEvents"];
+    ASSERT_TRUE(traceEvents.IsArray());
+    ASSERT_EQ(traceEvents.Size(), 2u);
+
+    const auto& request = traceEvents[0];
+    ASSERT_STREQ(request["name"].GetString(), "HttpRequest");
+    ASSERT_STREQ(request["ph"].GetString(), "X");
+    ASSERT_EQ(request["ts"].GetInt64(), 10);
+    ASSERT_EQ(request["dur"].GetInt64(), 15);
+    ASSERT_STREQ(request["args"]["tile"].GetString(), "https://example.com/tile?a=\"b\"");
+
+    const auto& firstVisible = traceEvents[1];
+    ASSERT_STREQ(firstVisible["ph"].GetString(), "i");
+    ASSERT_FALSE(firstVisible.HasMember("args"));
+}
@@ -0,0 +1,541 @@
+#include "Cesium/Systems/ViewStateProvider.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+
+#if defined(HAVE_BENCHMARK)
+#include "SyntheticTileset.h"
+#include <AzCore/Memory/PoolAllocator.h>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#endif
+
+class ViewStateProviderTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static AZStd::vector<Cesium::ViewportCamera> CreateCameras(std::size_t count)
+    {
+        AZStd::vector<Cesium::ViewportCamera> cameras;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Cesium::ViewportCamera camera;
+            camera.m_position = glm::dvec3{ static_cast<double>(i) * 10.0, 0.0, 100.0 };
+            camera.m_direction = glm::dvec3{ 0.0, 1.0, 0.0 };
+            camera.m_up = glm::dvec3{ 0.0, 0.0, 1.0 };
+            camera.m_viewportSize = glm::dvec2{ 1920.0, 1080.0 };
+            camera.m_horizontalFieldOfView = glm::radians(90.0);
+            camera.m_verticalFieldOfView = glm::radians(60.0);
+            cameras.emplace_back(camera);
+        }
+
+        return cameras;
+    }
+};
+
+TEST_F(ViewStateProviderTest, TilesetsWithSameTransformShareViewStates)
+{
+    Cesium::ViewStateProvider provider;
+    provider.SetCameras(CreateCameras(2));
+
+    glm::dmat4 transform = glm::translate(glm::dmat4{ 1.0 }, glm::dvec3{ 5.0, 0.0, 0.0 });
+    const auto& first = provider.GetViewStates(transform);
+    const auto& second = provider.GetViewStates(glm::translate(glm::dmat4{ 1.0 }, glm::dvec3{ 5.0, 0.0, 0.0 }));
+    ASSERT_EQ(&first, &second);
+    ASSERT_EQ(first.size(), 2u);
+}
+
+TEST_F(ViewStateProviderTest, TransformIsAppliedToCameras)
+{
+    Cesium::ViewStateProvider provider;
+    provider.SetCameras(CreateCameras(1));
+
+    const auto& identity = provider.GetViewStates(glm::dmat4{ 1.0 });
+    glm::dmat4 transform = glm::translate(glm::dmat4{ 1.0 }, glm::dvec3{ 0.0, 0.0, 50.0 });
+    transform = glm::rotate(transform, glm::radians(90.0), glm::dvec3{ 0.0, 0.0, 1.0 });
+    const auto& transformed = provider.GetViewStates(transform);
+    ASSERT_NE(&identity, &transformed);
+
+    // the first reference stays valid after another transform is added
+    ASSERT_NEAR(identity[0].getPosition().z, 100.0, 1e-9);
+    ASSERT_NEAR(transformed[0].getPosition().z, 150.0, 1e-9);
+    ASSERT_NEAR(transformed[0].getDirection().x, -1.0, 1e-9);
+    ASSERT_NEAR(glm::length(transformed[0].getUp()), 1.0, 1e-9);
+
+    std::vector<Cesium3DTilesSelection::ViewState> expected;
+    Cesium::ViewStateProvider::CreateViewStates(provider.GetCameras(), transform, expected);
+    ASSERT_EQ(expected.size(), transformed.size());
+    ASSERT_EQ(expected[0].getPosition(), transformed[0].getPosition());
+    ASSERT_EQ(expected[0].getDirection(), transformed[0].getDirection());
+}
+
+TEST_F(ViewStateProviderTest, NewCamerasReplaceCachedViewStates)
+{
+    Cesium::ViewStateProvider provider;
+    provider.SetCameras(CreateCameras(1));
+    ASSERT_EQ(provider.GetViewStates(glm::dmat4{ 1.0 }).size(), 1u);
+
+    provider.SetCameras(CreateCameras(3));
+    ASSERT_EQ(provider.GetViewStates(glm::dmat4{ 1.0 }).size(), 3u);
+
+    provider.SetCameras({});
+    ASSERT_TRUE(provider.GetViewStates(glm::dmat4{ 1.0 }).empty());
+}
+
+TEST_F(ViewStateProviderTest, PredictedViewStatesFollowCameraMotion)
+{
+    Cesium::ViewStateProvider provider;
+    AZStd::vector<Cesium::ViewportCamera> cameras = CreateCameras(2);
+    provider.SetCameras(cameras);
+
+    // the first camera flies forward at 100 m/s, and the second one is parked
+    constexpr float frameTime = 0.1f;
+    for (int frame = 0; frame < 60; ++frame)
+    {
+        cameras[0].m_position.y += 100.0 * frameTime;
+        provider.SetCameras(cameras, frameTime);
+    }
+
+    const auto& predicted = provider.GetPredictedViewStates(glm::dmat4{ 1.0 }, 2.0f);
+    ASSERT_EQ(predicted.size(), 1u);
+    ASSERT_NEAR(predicted[0].getPosition().y, cameras[0].m_position.y + 200.0, 1e-3);
+    ASSERT_NEAR(predicted[0].getPosition().z, 100.0, 1e-9);
+    ASSERT_NEAR(glm::dot(predicted[0].getDirection(), predicted[0].getUp()), 0.0, 1e-9);
+
+    // the current view states are cached separately from the predicted ones
+    ASSERT_EQ(provider.GetViewStates(glm::dmat4{ 1.0 }).size(), 2u);
+}
+
+TEST_F(ViewStateProviderTest, ParkedOrReplacedCamerasAreNotPredicted)
+{
+    Cesium::ViewStateProvider provider;
+    AZStd::vector<Cesium::ViewportCamera> cameras = CreateCameras(1);
+    provider.SetCameras(cameras, 0.1f);
+    provider.SetCameras(cameras, 0.1f);
+    ASSERT_TRUE(provider.GetPredictedViewStates(glm::dmat4{ 1.0 }, 1.0f).empty());
+
+    cameras[0].m_position.x += 10.0;
+    provider.SetCameras(cameras, 0.1f);
+    ASSERT_EQ(provider.GetPredictedViewStates(glm::dmat4{ 1.0 }, 1.0f).size(), 1u);
+
+    // the cameras can't be matched with the previous frame anymore
+    provider.SetCameras(CreateCameras(2), 0.1f);
+    ASSERT_TRUE(provider.GetPredictedViewStates(glm::dmat4{ 1.0 }, 1.0f).empty());
+}
+
+TEST_F(ViewStateProviderTest, PrefetchViewsUseFirstViewport)
+{
+    Cesium::ViewStateProvider provider;
+    provider.SetCameras(CreateCameras(2));
+
+    AZStd::vector<Cesium::ViewportCamera> destination = CreateCameras(1);
+    destination[0].m_position = glm::dvec3{ 0.0, 5000.0, 100.0 };
+    destination[0].m_viewportSize = glm::dvec2{ 100.0, 100.0 };
+    Cesium::ViewStateProvider::PrefetchViewsId id = provider.AddPrefetchViews(destination);
+
+    const auto& prefetchViewStates = provider.GetPrefetchViewStates(glm::dmat4{ 1.0 });
+    ASSERT_EQ(prefetchViewStates.size(), 1u);
+    ASSERT_NEAR(prefetchViewStates[0].getPosition().y, 5000.0, 1e-9);
+    ASSERT_EQ(prefetchViewStates[0].getViewportSize(), glm::dvec2(1920.0, 1080.0));
+
+    provider.RemovePrefetchViews(id);
+    ASSERT_TRUE(provider.GetPrefetchViewStates(glm::dmat4{ 1.0 }).empty());
+}
+
+TEST_F(ViewStateProviderTest, PrefetchViewsAreReadyAfterAFrameWithoutPendingReports)
+{
+    Cesium::ViewStateProvider provider;
+    provider.SetCameras(CreateCameras(1));
+    Cesium::ViewStateProvider::PrefetchViewsId first = provider.AddPrefetchViews(CreateCameras(2));
+    Cesium::ViewStateProvider::PrefetchViewsId second = provider.AddPrefetchViews(CreateCameras(1));
+    ASSERT_FALSE(provider.IsPrefetchReady(first));
+
+    // the views of all the ids follow each other, so the third view is the one of the second id
+    provider.SetCameras(CreateCameras(1));
+    provider.ReportPrefetchPending(2);
+    provider.SetCameras(CreateCameras(1));
+    ASSERT_TRUE(provider.IsPrefetchReady(first));
+    ASSERT_FALSE(provider.IsPrefetchReady(second));
+
+    provider.SetCameras(CreateCameras(1));
+    ASSERT_TRUE(provider.IsPrefetchReady(second));
+
+    std::uint32_t version = provider.GetPrefetchViewsVersion();
+    provider.RemovePrefetchViews(first);
+    ASSERT_NE(provider.GetPrefetchViewsVersion(), version);
+    ASSERT_FALSE(provider.IsPrefetchReady(first));
+}
+
+TEST_F(ViewStateProviderTest, ScreenSpaceErrorMultiplierRelaxesViewStates)
+{
+    Cesium::ViewStateProvider provider;
+    AZStd::vector<Cesium::ViewportCamera> cameras = CreateCameras(2);
+    cameras[1].m_position = cameras[0].m_position;
+    cameras[1].m_detail.m_screenSpaceErrorMultiplier = 4.0;
+    provider.SetCameras(cameras);
+
+    // the frustum is the same, and the screen space error of every tile is divided by the multiplier
+    const auto& viewStates = provider.GetViewStates(glm::dmat4{ 1.0 });
+    ASSERT_EQ(viewStates[1].getViewportSize(), glm::dvec2(480.0, 270.0));
+    ASSERT_EQ(viewStates[1].getHorizontalFieldOfView(), viewStates[0].getHorizontalFieldOfView());
+    ASSERT_NEAR(viewStates[1].computeScreenSpaceError(10.0, 500.0), viewStates[0].computeScreenSpaceError(10.0, 500.0) / 4.0, 1e-9);
+    ASSERT_TRUE(provider.GetFovealViewStates(glm::dmat4{ 1.0 }).empty());
+}
+
+TEST_F(ViewStateProviderTest, FovealViewsKeepDetailAroundGazePoint)
+{
+    Cesium::ViewStateProvider provider;
+    AZStd::vector<Cesium::ViewportCamera> cameras = CreateCameras(1);
+    std::vector<Cesium3DTilesSelection::ViewState> fullDetailViewStates;
+    Cesium::ViewStateProvider::CreateViewStates(cameras, glm::dmat4{ 1.0 }, fullDetailViewStates);
+    double fullDetailError = fullDetailViewStates[0].computeScreenSpaceError(10.0, 500.0);
+
+    // looking at the right edge of the viewport
+    cameras[0].m_detail.m_foveated = true;
+    cameras[0].m_detail.m_gazePoint = glm::dvec2{ 1.0, 0.0 };
+    cameras[0].m_detail.m_fovealRadius = 0.25;
+    cameras[0].m_detail.m_peripheralScreenSpaceErrorMultiplier = 4.0;
+    provider.SetCameras(cameras);
+
+    const auto& viewStates = provider.GetViewStates(glm::dmat4{ 1.0 });
+    ASSERT_NEAR(viewStates[0].computeScreenSpaceError(10.0, 500.0), fullDetailError / 4.0, 1e-9);
+
+    // the first foveal view has the full detail, and the second one covers twice the area with half the detail
+    const auto& fovealViewStates = provider.GetFovealViewStates(glm::dmat4{ 1.0 });
+    ASSERT_EQ(fovealViewStates.size(), 2u);
+    ASSERT_NEAR(fovealViewStates[0].getDirection().x, glm::sqrt(0.5), 1e-9);
+    ASSERT_NEAR(fovealViewStates[0].getDirection().y, glm::sqrt(0.5), 1e-9);
+    ASSERT_NEAR(fovealViewStates[0].getHorizontalFieldOfView(), 2.0 * glm::atan(0.25), 1e-9);
+    ASSERT_NEAR(fovealViewStates[0].computeScreenSpaceError(10.0, 500.0), fullDetailError, 1e-9);
+    ASSERT_NEAR(fovealViewStates[1].getHorizontalFieldOfView(), 2.0 * glm::atan(0.5), 1e-9);
+    ASSERT_NEAR(fovealViewStates[1].computeScreenSpaceError(10.0, 500.0), fullDetailError / 2.0, 1e-9);
+
+    // a foveal area covering the viewport has no view
+    cameras[0].m_detail.m_fovealRadius = 0.75;
+    provider.SetCameras(cameras);
+    ASSERT_EQ(provider.GetFovealViewStates(glm::dmat4{ 1.0 }).size(), 1u);
+}
+
+TEST_F(ViewStateProviderTest, ViewportDetailVersionFollowsCameraDetail)
+{
+    Cesium::ViewStateProvider provider;
+    AZStd::vector<Cesium::ViewportCamera> cameras = CreateCameras(1);
+    cameras[0].m_detail.m_foveated = true;
+    provider.SetCameras(cameras);
+
+    std::uint32_t version = provider.GetViewportDetailVersion();
+    provider.SetCameras(cameras);
+    ASSERT_EQ(provider.GetViewportDetailVersion(), version);
+
+    cameras[0].m_detail.m_gazePoint = glm::dvec2{ 0.5, 0.5 };
+    provider.SetCameras(cameras);
+    ASSERT_NE(provider.GetViewportDetailVersion(), version);
+}
+
+TEST_F(ViewStateProviderTest, ViewportDetailIsKeptPerViewport)
+{
+    Cesium::ViewStateProvider provider;
+    Cesium::ViewportDetailConfiguration detail;
+    detail.m_screenSpaceErrorMultiplier = 2.0;
+    detail.m_priority = 0.5;
+    provider.SetViewportDetail(3, detail);
+    provider.SetViewportGazePoint(3, glm::dvec2{ 0.25, -0.25 });
+    ASSERT_EQ(provider.GetViewportDetail(3).m_screenSpaceErrorMultiplier, 2.0);
+    ASSERT_EQ(provider.GetViewportDetail(3).m_gazePoint, glm::dvec2(0.25, -0.25));
+    ASSERT_EQ(provider.GetViewportDetail(4).m_screenSpaceErrorMultiplier, 1.0);
+
+    provider.ClearViewportDetail(3);
+    ASSERT_EQ(provider.GetViewportDetail(3).m_priority, 1.0);
+
+    // the priority of a camera is never negative
+    AZStd::vector<Cesium::ViewportCamera> cameras = CreateCameras(2);
+    cameras[1].m_detail.m_priority = -1.0;
+    provider.SetCameras(cameras);
+    ASSERT_EQ(provider.GetViewPriority(0), 1.0);
+    ASSERT_EQ(provider.GetViewPriority(1), 0.0);
+}
+
+TEST_F(ViewStateProviderTest, DisabledViewportsHaveNoViewStates)
+{
+    Cesium::ViewStateProvider provider;
+    provider.SetViewportEnabled(3, false);
+    ASSERT_FALSE(provider.GetViewportDetail(3).m_enabled);
+    ASSERT_TRUE(provider.GetViewportDetail(4).m_enabled);
+
+    AZStd::vector<Cesium::ViewportCamera> cameras = CreateCameras(3);
+    cameras[1].m_detail.m_enabled = false;
+    provider.SetCameras(cameras);
+    const auto& viewStates = provider.GetViewStates(glm::dmat4{ 1.0 });
+    ASSERT_EQ(viewStates.size(), 2u);
+    ASSERT_NEAR(viewStates[1].getPosition().x, 20.0, 1e-9);
+    ASSERT_EQ(provider.GetCameras().size(), 2u);
+}
+
+TEST_F(ViewStateProviderTest, InactiveViewportsAreThrottled)
+{
+    Cesium::ViewStateProvider provider;
+    AZStd::vector<Cesium::ViewportCamera> cameras = CreateCameras(2);
+    cameras[1].m_active = false;
+    cameras[1].m_detail.m_screenSpaceErrorMultiplier = 2.0;
+    provider.SetCameras(cameras);
+
+    // the throttle multiplies the detail set for the viewport
+    const auto& viewStates = provider.GetViewStates(glm::dmat4{ 1.0 });
+    ASSERT_EQ(viewStates.size(), 2u);
+    ASSERT_EQ(viewStates[0].getViewportSize(), glm::dvec2(1920.0, 1080.0));
+    ASSERT_EQ(viewStates[1].getViewportSize(), glm::dvec2(240.0, 135.0));
+    ASSERT_EQ(provider.GetViewPriority(0), 1.0);
+    ASSERT_EQ(provider.GetViewPriority(1), Cesium::ViewStateProvider::DEFAULT_INACTIVE_PRIORITY);
+
+    // becoming active again restores the detail of the viewport
+    std::uint32_t version = provider.GetViewportDetailVersion();
+    cameras[1].m_active = true;
+    provider.SetCameras(cameras);
+    ASSERT_NE(provider.GetViewportDetailVersion(), version);
+    ASSERT_EQ(provider.GetViewStates(glm::dmat4{ 1.0 })[1].getViewportSize(), glm::dvec2(960.0, 540.0));
+
+    cameras[1].m_active = false;
+    provider.SetInactiveScreenSpaceErrorMultiplier(1.0);
+    provider.SetInactivePriority(-1.0);
+    provider.SetCameras(cameras);
+    ASSERT_EQ(provider.GetViewStates(glm::dmat4{ 1.0 })[1].getViewportSize(), glm::dvec2(960.0, 540.0));
+    ASSERT_EQ(provider.GetViewPriority(1), 0.0);
+
+    provider.SetDropInactiveViewports(true);
+    provider.SetCameras(cameras);
+    ASSERT_EQ(provider.GetViewStates(glm::dmat4{ 1.0 }).size(), 1u);
+}
+
+#if defined(HAVE_BENCHMARK)
+// N tilesets placed under a few georeferences, comparing view states built by every tileset with the per-frame shared provider
+class ViewStateProviderBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+public:
+    void SetUp(const ::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        CreateScene(state);
+    }
+
+    void SetUp(::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        CreateScene(state);
+    }
+
+    void TearDown(const ::benchmark::State& state) override
+    {
+        DestroyScene();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+    void TearDown(::benchmark::State& state) override
+    {
+        DestroyScene();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+protected:
+    void CreateScene(const ::benchmark::State& state)
+    {
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+        for (std::size_t i = 0; i < VIEWPORT_COUNT; ++i)
+        {
+            Cesium::ViewportCamera camera;
+            camera.m_position = glm::dvec3{ static_cast<double>(i) * 100.0, 0.0, 500.0 };
+            camera.m_direction = glm::dvec3{ 0.0, 1.0, 0.0 };
+            camera.m_up = glm::dvec3{ 0.0, 0.0, 1.0 };
+            camera.m_viewportSize = glm::dvec2{ 1920.0, 1080.0 };
+            camera.m_horizontalFieldOfView = glm::radians(90.0);
+            camera.m_verticalFieldOfView = glm::radians(60.0);
+            m_cameras.emplace_back(camera);
+        }
+
+        std::size_t tilesetCount = static_cast<std::size_t>(state.range(0));
+        for (std::size_t i = 0; i < tilesetCount; ++i)
+        {
+            double georeference = static_cast<double>(i % GEOREFERENCE_COUNT);
+            m_tilesetTransforms.emplace_back(glm::translate(glm::dmat4{ 1.0 }, glm::dvec3{ 6378137.0, georeference * 1000.0, 0.0 }));
+        }
+
+        m_tilesetViewStates.resize(tilesetCount);
+    }
+
+    void DestroyScene()
+    {
+        m_cameras = {};
+        m_tilesetTransforms = {};
+        m_tilesetViewStates = {};
+        m_provider.SetCameras({});
+
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+    }
+
+    static constexpr std::size_t VIEWPORT_COUNT = 4;
+    static constexpr std::size_t GEOREFERENCE_COUNT = 2;
+
+    AZStd::vector<Cesium::ViewportCamera> m_cameras;
+    std::vector<glm::dmat4> m_tilesetTransforms;
+    std::vector<std::vector<Cesium3DTilesSelection::ViewState>> m_tilesetViewStates;
+    Cesium::ViewStateProvider m_provider;
+};
+
+BENCHMARK_DEFINE_F(ViewStateProviderBenchmark, PerTilesetViewStates)(benchmark::State& state)
+{
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (std::size_t i = 0; i < m_tilesetTransforms.size(); ++i)
+        {
+            Cesium::ViewStateProvider::CreateViewStates(m_cameras, m_tilesetTransforms[i], m_tilesetViewStates[i]);
+            benchmark::DoNotOptimize(m_tilesetViewStates[i].data());
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(ViewStateProviderBenchmark, SharedViewStates)(benchmark::State& state)
+{
+    for ([[maybe_unused]] auto _ : state)
+    {
+        // SetCameras stands in for the viewport enumeration done once per frame by the system component
+        m_provider.SetCameras(m_cameras);
+        for (const glm::dmat4& transform : m_tilesetTransforms)
+        {
+            benchmark::DoNotOptimize(m_provider.GetViewStates(transform).data());
+        }
+    }
+}
+
+// A camera above a synthetic city, loading every tile of its view. The argument selects the full detail, a screen space error
+// multiplier of 4, a foveated viewport looking at its center, or an inactive viewport with the default throttle. The counters
+// are the tiles rendered and the bytes loaded
+class ViewportDetailBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+public:
+    void SetUp(const ::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+    }
+
+    void SetUp(::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+    }
+
+    void TearDown(const ::benchmark::State& state) override
+    {
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+    void TearDown(::benchmark::State& state) override
+    {
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+protected:
+    void CreateTileset()
+    {
+        std::string tilesetJson = CesiumTests::CreateQuadtreeTilesetJson(TILESET_DEPTH, "tile.glb");
+        std::string tileGlb = CesiumTests::CreateBufferOnlyGlb(TILE_BYTES);
+        auto ioManager = std::make_unique<CesiumTests::InMemoryIOManager>(tilesetJson);
+        ioManager->AddFile("tile.glb", tileGlb.data(), tileGlb.size());
+        m_tileset = std::make_unique<CesiumTests::SyntheticTileset>(std::move(ioManager), "application/octet-stream");
+    }
+
+    void DestroyTileset()
+    {
+        m_tileset.reset();
+    }
+
+    // the tiles rendered once nothing is loading anymore
+    std::size_t LoadUntilFullDetail(const Cesium::ViewportDetailConfiguration& detail, bool active)
+    {
+        // above the tileset, looking 30 degrees down
+        glm::dvec3 direction = glm::normalize(glm::dvec3{ 1.0, 0.0, -0.577 });
+        Cesium::ViewportCamera camera;
+        camera.m_position = glm::dvec3{ -2000.0, 0.0, 500.0 };
+        camera.m_direction = direction;
+        camera.m_up = glm::normalize(glm::dvec3{ 0.0, 0.0, 1.0 } - direction.z * direction);
+        camera.m_viewportSize = glm::dvec2{ 1920.0, 1080.0 };
+        camera.m_horizontalFieldOfView = glm::radians(90.0);
+        camera.m_verticalFieldOfView = glm::radians(60.0);
+        camera.m_detail = detail;
+        camera.m_active = active;
+        m_viewStateProvider.SetCameras({ camera });
+
+        // the selection combines the current and foveal views like TilesetComponent
+        std::vector<Cesium3DTilesSelection::ViewState> viewStates = m_viewStateProvider.GetViewStates(glm::dmat4{ 1.0 });
+        const auto& fovealViewStates = m_viewStateProvider.GetFovealViewStates(glm::dmat4{ 1.0 });
+        viewStates.insert(viewStates.end(), fovealViewStates.begin(), fovealViewStates.end());
+        std::size_t tilesRendered = 0;
+        for (std::size_t frame = 0; frame < MAXIMUM_FRAMES; ++frame)
+        {
+            m_tileset->AdvanceFrame();
+            const auto& viewUpdate = m_tileset->GetTileset().updateView(viewStates);
+            tilesRendered = viewUpdate.tilesToRenderThisFrame.size();
+            bool hasPendingLoads = viewUpdate.tilesLoadingLowPriority > 0 || viewUpdate.tilesLoadingMediumPriority > 0 ||
+                viewUpdate.tilesLoadingHighPriority > 0 || m_tileset->GetTileset().computeLoadProgress() < 100.0f;
+            if (!hasPendingLoads && tilesRendered > 0)
+            {
+                break;
+            }
+        }
+
+        return tilesRendered;
+    }
+
+    static constexpr int TILESET_DEPTH = 6;
+    static constexpr std::uint32_t TILE_BYTES = 64 * 1024;
+    static constexpr std::size_t MAXIMUM_FRAMES = 1000;
+
+    std::unique_ptr<CesiumTests::SyntheticTileset> m_tileset;
+    Cesium::ViewStateProvider m_viewStateProvider;
+};
+
+BENCHMARK_DEFINE_F(ViewportDetailBenchmark, LoadView)(benchmark::State& state)
+{
+    Cesium::ViewportDetailConfiguration detail;
+    if (state.range(0) == 1)
+    {
+        detail.m_screenSpaceErrorMultiplier = 4.0;
+    }
+    else if (state.range(0) == 2)
+    {
+        detail.m_foveated = true;
+    }
+
+    std::size_t tilesRendered = 0;
+    std::uint64_t bytesLoaded = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        CreateTileset();
+        state.ResumeTiming();
+
+        tilesRendered += LoadUntilFullDetail(detail, state.range(0) != 3);
+        bytesLoaded += static_cast<std::uint64_t>(m_tileset->GetTileset().getTotalDataBytes());
+
+        state.PauseTiming();
+        DestroyTileset();
+        state.ResumeTiming();
+    }
+
+    state.counters["TilesRendered"] = benchmark::Counter(static_cast<double>(tilesRendered), benchmark::Counter::kAvgIterations);
+    state.counters["BytesLoaded"] = benchmark::Counter(static_cast<double>(bytesLoaded), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_REGISTER_F(ViewStateProviderBenchmark, PerTilesetViewStates)->Arg(1)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ViewStateProviderBenchmark, SharedViewStates)->Arg(1)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ViewportDetailBenchmark, LoadView)->Arg(0)->Arg(1)->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,173 @@
+#include "Cesium/TilesetUtility/ViewUpdateCache.h"
+#include <AzCore/UnitTest/TestTypes.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+#if defined(HAVE_BENCHMARK)
+#include "SyntheticTileset.h"
+#include <AzCore/Memory/PoolAllocator.h>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#endif
+
+class ViewUpdateCacheTest : public UnitTest::AllocatorsTestFixture
+{
+protected:
+    static Cesium3DTilesSelection::ViewState CreateViewState(const glm::dvec3& position)
+    {
+        return Cesium3DTilesSelection::ViewState::create(
+            position, glm::dvec3{ 0.0, 0.0, -1.0 }, glm::dvec3{ 0.0, 1.0, 0.0 }, glm::dvec2{ 1920.0, 1080.0 }, glm::radians(90.0),
+            glm::radians(60.0));
+    }
+};
+
+TEST_F(ViewUpdateCacheTest, NothingIsSkippedBeforeFirstUpdate)
+{
+    Cesium::ViewUpdateCache cache;
+    std::vector<Cesium3DTilesSelection::ViewState> viewStates{ CreateViewState(glm::dvec3{ 0.0, 0.0, 100.0 }) };
+    ASSERT_FALSE(cache.CanSkipUpdate(viewStates));
+}
+
+TEST_F(ViewUpdateCacheTest, SameViewsWithoutPendingLoadsAreSkipped)
+{
+    Cesium::ViewUpdateCache cache;
+    std::vector<Cesium3DTilesSelection::ViewState> viewStates{ CreateViewState(glm::dvec3{ 0.0, 0.0, 100.0 }) };
+    cache.RecordUpdate(viewStates, true);
+    ASSERT_FALSE(cache.CanSkipUpdate(viewStates));
+
+    cache.RecordUpdate(viewStates, false);
+    ASSERT_TRUE(cache.CanSkipUpdate(viewStates));
+
+    cache.Invalidate();
+    ASSERT_FALSE(cache.CanSkipUpdate(viewStates));
+}
+
+TEST_F(ViewUpdateCacheTest, MovedOrAddedViewsAreNotSkipped)
+{
+    Cesium::ViewUpdateCache cache;
+    std::vector<Cesium3DTilesSelection::ViewState> viewStates{ CreateViewState(glm::dvec3{ 0.0, 0.0, 100.0 }) };
+    cache.RecordUpdate(viewStates, false);
+
+    std::vector<Cesium3DTilesSelection::ViewState> movedViewStates{ CreateViewState(glm::dvec3{ 0.0, 0.001, 100.0 }) };
+    ASSERT_FALSE(cache.CanSkipUpdate(movedViewStates));
+
+    viewStates.emplace_back(CreateViewState(glm::dvec3{ 0.0, 0.0, 200.0 }));
+    ASSERT_FALSE(cache.CanSkipUpdate(viewStates));
+
+    std::vector<Cesium3DTilesSelection::ViewState> noViewStates;
+    ASSERT_FALSE(cache.CanSkipUpdate(noViewStates));
+}
+
+#if defined(HAVE_BENCHMARK)
+// A parked camera over a synthetic tileset, comparing a full traversal every frame with the cached path of TilesetComponent
+class ViewUpdateCacheBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+{
+public:
+    void SetUp(const ::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        CreateTileset();
+    }
+
+    void SetUp(::benchmark::State& state) override
+    {
+        UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+        CreateTileset();
+    }
+
+    void TearDown(const ::benchmark::State& state) override
+    {
+        DestroyTileset();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+    void TearDown(::benchmark::State& state) override
+    {
+        DestroyTileset();
+        UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+    }
+
+protected:
+    void CreateTileset()
+    {
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+        m_tileset = std::make_unique<CesiumTests::SyntheticTileset>(
+            std::make_unique<CesiumTests::InMemoryIOManager>(CesiumTests::CreateQuadtreeTilesetJson(TILESET_DEPTH)), "application/json");
+        m_viewStates.emplace_back(Cesium3DTilesSelection::ViewState::create(
+            glm::dvec3{ 0.0, 0.0, 3000.0 }, glm::dvec3{ 0.0, 0.0, -1.0 }, glm::dvec3{ 0.0, 1.0, 0.0 }, glm::dvec2{ 1920.0, 1080.0 },
+            glm::radians(90.0), glm::radians(60.0)));
+
+        // load every tile the parked camera needs before measuring
+        for (std::size_t i = 0; i < MAX_WARM_UP_FRAMES; ++i)
+        {
+            const auto& viewUpdate = m_tileset->GetTileset().updateView(m_viewStates);
+            m_tileset->AdvanceFrame();
+            if (!HasPendingLoads(viewUpdate))
+            {
+                break;
+            }
+        }
+    }
+
+    void DestroyTileset()
+    {
+        m_tileset.reset();
+        m_viewStates.clear();
+
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+    }
+
+    bool HasPendingLoads(const Cesium3DTilesSelection::ViewUpdateResult& viewUpdate)
+    {
+        return viewUpdate.tilesLoadingLowPriority > 0 || viewUpdate.tilesLoadingMediumPriority > 0 ||
+            viewUpdate.tilesLoadingHighPriority > 0 || !m_tileset->GetTileset().getRootTile() ||
+            m_tileset->GetTileset().computeLoadProgress() < 100.0f;
+    }
+
+    static constexpr int TILESET_DEPTH = 6;
+    static constexpr std::size_t MAX_WARM_UP_FRAMES = 1000;
+
+    std::unique_ptr<CesiumTests::SyntheticTileset> m_tileset;
+    std::vector<Cesium3DTilesSelection::ViewState> m_viewStates;
+};
+
+BENCHMARK_DEFINE_F(ViewUpdateCacheBenchmark, FullUpdateView)(benchmark::State& state)
+{
+    std::size_t tilesRendered = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto& viewUpdate = m_tileset->GetTileset().updateView(m_viewStates);
+        tilesRendered = viewUpdate.tilesToRenderThisFrame.size();
+    }
+
+    state.counters["TilesRendered"] = static_cast<double>(tilesRendered);
+}
+
+BENCHMARK_DEFINE_F(ViewUpdateCacheBenchmark, CachedUpdateView)(benchmark::State& state)
+{
+    Cesium::ViewUpdateCache cache;
+    std::size_t skippedFrames = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        if (cache.CanSkipUpdate(m_viewStates))
+        {
+            m_tileset->GetAsyncSystem().dispatchMainThreadTasks();
+            ++skippedFrames;
+        }
+        else
+        {
+            const auto& viewUpdate = m_tileset->GetTileset().updateView(m_viewStates);
+            cache.RecordUpdate(m_viewStates, HasPendingLoads(viewUpdate));
+        }
+    }
+
+    state.counters["SkippedFrames"] = benchmark::Counter(static_cast<double>(skippedFrames), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_REGISTER_F(ViewUpdateCacheBenchmark, FullUpdateView)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ViewUpdateCacheBenchmark, CachedUpdateView)->Unit(benchmark::kMicrosecond);
+#endif
@@ -30,18 +30,51 @@ set(FILES
 
     Source/Cesium/Systems/GenericIOManager.h
     Source/Cesium/Systems/GenericIOManager.cpp
+    Source/Cesium/Systems/FutureBatch.h
+    Source/Cesium/Systems/HttpMetrics.h
+    Source/Cesium/Systems/HttpMetrics.cpp
     Source/Cesium/Systems/HttpManager.h
     Source/Cesium/Systems/HttpManager.cpp
     Source/Cesium/Systems/LocalFileManager.h
     Source/Cesium/Systems/LocalFileManager.cpp
+    Source/Cesium/Systems/LogMessageQueue.h
+    Source/Cesium/Systems/LogMessageQueue.cpp
+    Source/Cesium/Systems/LogRateLimiter.h
+    Source/Cesium/Systems/LogRateLimiter.cpp
     Source/Cesium/Systems/LoggerSink.h
     Source/Cesium/Systems/LoggerSink.cpp
+    Source/Cesium/Systems/TraceRecorder.h
+    Source/Cesium/Systems/TraceRecorder.cpp
+    Source/Cesium/Systems/DeterministicTaskQueue.h
+    Source/Cesium/Systems/DeterministicTaskQueue.cpp
+    Source/Cesium/Systems/VirtualClock.h
+    Source/Cesium/Systems/VirtualClock.cpp
+    Source/Cesium/Systems/ThreadAffinityPolicy.h
+    Source/Cesium/Systems/ThreadAffinityPolicy.cpp
+    Source/Cesium/Systems/ViewStateProvider.h
+    Source/Cesium/Systems/ViewStateProvider.cpp
+    Source/Cesium/Systems/CameraBookmarks.h
+    Source/Cesium/Systems/CameraBookmarks.cpp
+    Source/Cesium/Systems/DestinationPrefetch.h
+    Source/Cesium/Systems/DestinationPrefetch.cpp
+    Source/Cesium/Systems/MemoryTracker.h
+    Source/Cesium/Systems/MemoryTracker.cpp
+    Source/Cesium/Systems/MemoryBudget.h
+    Source/Cesium/Systems/MemoryBudget.cpp
+    Source/Cesium/Systems/LoadSlotArbiter.h
+    Source/Cesium/Systems/LoadSlotArbiter.cpp
+    Source/Cesium/Systems/TileOccluderRegistry.h
+    Source/Cesium/Systems/TileOccluderRegistry.cpp
     Source/Cesium/Systems/TaskProcessor.h
     Source/Cesium/Systems/TaskProcessor.cpp
     Source/Cesium/Systems/HttpAssetAccessor.h
     Source/Cesium/Systems/HttpAssetAccessor.cpp
     Source/Cesium/Systems/GenericAssetAccessor.h
     Source/Cesium/Systems/GenericAssetAccessor.cpp
+    Source/Cesium/Systems/SnapshotAssetAccessor.h
+    Source/Cesium/Systems/SnapshotAssetAccessor.cpp
+    Source/Cesium/Systems/ResponseSamplingAssetAccessor.h
+    Source/Cesium/Systems/ResponseSamplingAssetAccessor.cpp
     Source/Cesium/Systems/CriticalAssetManager.h
     Source/Cesium/Systems/CriticalAssetManager.cpp
     Source/Cesium/Systems/CesiumSystem.h
@@ -66,8 +99,30 @@ set(FILES
     Source/Cesium/TilesetUtility/TilesetCameraConfigurations.cpp
     Source/Cesium/TilesetUtility/GltfRasterMaterialBuilder.h
     Source/Cesium/TilesetUtility/GltfRasterMaterialBuilder.cpp
+    Source/Cesium/TilesetUtility/LoadPipelineThrottle.h
+    Source/Cesium/TilesetUtility/LoadPipelineThrottle.cpp
+    Source/Cesium/TilesetUtility/StreamingStatisticsWindow.h
+    Source/Cesium/TilesetUtility/StreamingStatisticsWindow.cpp
+    Source/Cesium/TilesetUtility/ScreenSpaceErrorController.h
+    Source/Cesium/TilesetUtility/ScreenSpaceErrorController.cpp
+    Source/Cesium/TilesetUtility/LoadConcurrencyController.h
+    Source/Cesium/TilesetUtility/LoadConcurrencyController.cpp
+    Source/Cesium/TilesetUtility/CacheTrimPolicy.h
+    Source/Cesium/TilesetUtility/CacheTrimPolicy.cpp
+    Source/Cesium/TilesetUtility/TilePrefetcher.h
+    Source/Cesium/TilesetUtility/TilePrefetcher.cpp
+    Source/Cesium/TilesetUtility/PrefetchViewScheduler.h
+    Source/Cesium/TilesetUtility/PrefetchViewScheduler.cpp
+    Source/Cesium/TilesetUtility/TileLoadLatencyTracker.h
+    Source/Cesium/TilesetUtility/TileLoadLatencyTracker.cpp
+    Source/Cesium/TilesetUtility/TilesetDebugVisualizer.h
+    Source/Cesium/TilesetUtility/TilesetDebugVisualizer.cpp
+    Source/Cesium/TilesetUtility/ViewUpdateCache.h
+    Source/Cesium/TilesetUtility/ViewUpdateCache.cpp
     Source/Cesium/TilesetUtility/RenderResourcesPreparer.h
     Source/Cesium/TilesetUtility/RenderResourcesPreparer.cpp
+    Source/Cesium/TilesetUtility/TileOcclusionCuller.h
+    Source/Cesium/TilesetUtility/TileOcclusionCuller.cpp
 
     Source/Cesium/EBus/CesiumSystemComponentBus.h
     Source/Cesium/EBus/CesiumSystemComponentBus.cpp
@@ -85,6 +140,16 @@ set(FILES
     Source/Cesium/EBus/GltfModelComponentBus.cpp
     Include/Cesium/EBus/TilesetComponentBus.h
     Source/Cesium/EBus/TilesetComponentBus.cpp
+    Include/Cesium/EBus/HttpMetricsBus.h
+    Source/Cesium/EBus/HttpMetricsBus.cpp
+    Include/Cesium/EBus/MemoryBudgetBus.h
+    Source/Cesium/EBus/MemoryBudgetBus.cpp
+    Include/Cesium/EBus/LoadSlotBus.h
+    Source/Cesium/EBus/LoadSlotBus.cpp
+    Include/Cesium/EBus/CameraBookmarkBus.h
+    Source/Cesium/EBus/CameraBookmarkBus.cpp
+    Include/Cesium/EBus/ViewportDetailBus.h
+    Source/Cesium/EBus/ViewportDetailBus.cpp
 
     Source/Cesium/Components/CesiumSystemComponent.h
     Source/Cesium/Components/CesiumSystemComponent.cpp
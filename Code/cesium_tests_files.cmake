@@ -4,4 +4,29 @@ set(FILES
     Tests/HttpManagerTest.cpp
     Tests/HttpAssetAccessorTest.cpp
     Tests/TaskProcessorTest.cpp
+    Tests/LoadPipelineThrottleTest.cpp
+    Tests/TraceRecorderTest.cpp
+    Tests/DeterministicExecutionTest.cpp
+    Tests/ThreadAffinityPolicyTest.cpp
+    Tests/MemoryTrackerTest.cpp
+    Tests/HttpMetricsTest.cpp
+    Tests/StreamingStatisticsWindowTest.cpp
+    Tests/LoggerSinkTest.cpp
+    Tests/TilesetDebugVisualizerTest.cpp
+    Tests/ScreenSpaceErrorControllerTest.cpp
+    Tests/LoadConcurrencyControllerTest.cpp
+    Tests/ViewUpdateCacheTest.cpp
+    Tests/ViewStateProviderTest.cpp
+    Tests/MemoryBudgetTest.cpp
+    Tests/LoadSlotArbiterTest.cpp
+    Tests/CacheTrimPolicyTest.cpp
+    Tests/TilePrefetcherTest.cpp
+    Tests/PrefetchViewSchedulerTest.cpp
+    Tests/CameraBookmarksTest.cpp
+    Tests/DestinationPrefetchTest.cpp
+    Tests/SnapshotAssetAccessorTest.cpp
+    Tests/ResponseSamplingAssetAccessorTest.cpp
+    Tests/FutureBatchTest.cpp
+    Tests/TileOcclusionCullerTest.cpp
+    Tests/SyntheticTileset.h
 )